@@ -1,8 +1,10 @@
 #!/usr/bin/env python3
 
 import os
+import re
 import sys
 import getopt
+import hashlib
 
 import xml.etree.ElementTree as ET
 
@@ -39,6 +41,9 @@ g_optl: list = [
     'version',  # -v, --version
     'output=',  # -o, --output
     'profile=', # -p, --profile
+    'stream',   # --stream
+    'cache=',   # --cache
+    'check',    # --check
 ]
 g_opt: dict = {
     'output': f'{g_path}/gload.h',
@@ -47,6 +52,10 @@ g_opt: dict = {
     'version-es': g_gles_version_list[-1],
     'version-sc': g_glsc_version_list[-1],
     'template': f'{g_path}/gload-template.h',
+    'xml': f'{g_path}/xml/gl.xml',
+    'stream': False,
+    'cache': None,
+    'check': False,
 }
 
 
@@ -87,6 +96,15 @@ def gl_getopt():
                 sys.exit(1)
             g_opt['profile'] = arg
 
+        elif opt == '--stream':
+            g_opt['stream'] = True
+
+        elif opt == '--cache':
+            g_opt['cache'] = arg
+
+        elif opt == '--check':
+            g_opt['check'] = True
+
         elif opt in ('-h', '--help'):
             print('help')
             sys.exit(0)
@@ -342,6 +360,11 @@ class glParse:
     feat: list[glFeat]
     ext: list[glExt]
 
+    # indexes by name, the registry is too large for list scans...
+    type_index: dict[str, glType]
+    enum_index: dict[str, glEnum]
+    cmd_index: dict[str, glCmd]
+
 
 def gl_loadxml(filepath: str) -> ET.ElementTree:
     tree: ET.ElementTree
@@ -354,62 +377,107 @@ def gl_loadxml(filepath: str) -> ET.ElementTree:
     return (tree)
 
 
-def gl_parsexml(tree: ET.ElementTree) -> glParse:
-    root: ET.ElementTree
+def gl_parsexml_new() -> glParse:
     parse: glParse
 
-    root = tree.getroot()
-    if root.tag != 'registry':
-        print(f'{__file__}: root error')
-        sys.exit(1)
     parse = glParse()
     parse.types = list()
     parse.enums = list()
     parse.cmds = list()
     parse.feat = list()
     parse.ext = list()
+    parse.type_index = dict()
+    parse.enum_index = dict()
+    parse.cmd_index = dict()
+    return (parse)
 
-    for child in root:
 
-        if child.tag == 'types':
-            for types in child.findall('type'):
-                type: glType
+def gl_parsexml_child(parse: glParse, child: ET.Element):
+    if child.tag == 'types':
+        for types in child.findall('type'):
+            type: glType
 
-                type = gl_parsexml_t(types)
-                if type not in parse.types:
-                    parse.types.append(type)
+            type = gl_parsexml_t(types)
+            if type.name not in parse.type_index:
+                parse.type_index[type.name] = type
+                parse.types.append(type)
 
-        elif child.tag == 'enums':
-            for enums in child.findall('enum'):
-                enum: glEnum
+    elif child.tag == 'enums':
+        for enums in child.findall('enum'):
+            enum: glEnum
 
-                enum = gl_parsexml_e(enums)
-                if enum not in parse.enums:
-                    parse.enums.append(enum)
+            enum = gl_parsexml_e(enums)
+            if enum.name not in parse.enum_index:
+                parse.enum_index[enum.name] = enum
+                parse.enums.append(enum)
 
-        elif child.tag == 'commands':
-            for cmds in child.findall('command'):
-                cmd: glCmd
+    elif child.tag == 'commands':
+        for cmds in child.findall('command'):
+            cmd: glCmd
 
-                cmd = gl_parsexml_c(cmds)
-                if cmd not in parse.cmds:
-                    parse.cmds.append(cmd)
+            cmd = gl_parsexml_c(cmds)
+            if cmd.name not in parse.cmd_index:
+                parse.cmd_index[cmd.name] = cmd
+                parse.cmds.append(cmd)
 
-        elif child.tag == 'feature':
-            feat: glFeat
+    elif child.tag == 'feature':
+        feat: glFeat
 
-            feat = gl_parsexml_f(child)
-            if feat is not None:
-                parse.feat.append(feat)
+        feat = gl_parsexml_f(child)
+        if feat is not None:
+            parse.feat.append(feat)
 
-        elif child.tag == 'extensions':
-            for exts in child.findall('extension'):
-                ext: glExt
+    elif child.tag == 'extensions':
+        for exts in child.findall('extension'):
+            ext: glExt
 
-                ext = gl_parsexml_ex(exts)
-                if ext is not None:
-                    parse.ext.append(ext)
+            ext = gl_parsexml_ex(exts)
+            if ext is not None:
+                parse.ext.append(ext)
 
+
+def gl_parsexml(tree: ET.ElementTree) -> glParse:
+    root: ET.ElementTree
+    parse: glParse
+
+    root = tree.getroot()
+    if root.tag != 'registry':
+        print(f'{__file__}: root error')
+        sys.exit(1)
+    parse = gl_parsexml_new()
+
+    for child in root:
+        gl_parsexml_child(parse, child)
+    return (parse)
+
+
+def gl_parsexml_stream(filepath: str) -> glParse:
+    parse: glParse
+    root: ET.Element
+    depth: int
+
+    # same as `gl_parsexml`, but each top-level element is freed once parsed...
+    parse = gl_parsexml_new()
+    root = None
+    depth = 0
+    try:
+        for event, element in ET.iterparse(filepath, events=('start', 'end')):
+            if event == 'start':
+                if depth == 0:
+                    root = element
+                    if root.tag != 'registry':
+                        print(f'{__file__}: root error')
+                        sys.exit(1)
+                depth += 1
+                continue
+
+            depth -= 1
+            if depth == 1:
+                gl_parsexml_child(parse, element)
+                root.remove(element)
+    except FileNotFoundError as err:
+        print(f'{__file__}: {err}')
+        sys.exit(1)
     return (parse)
 
 
@@ -417,7 +485,7 @@ def gl_parsexml(tree: ET.ElementTree) -> glParse:
 # SECTION: loader
 # ===============
 
-def opengl_loader(parse: glParse):
+def opengl_loader(parse: glParse) -> str:
     fstr: str
 
     with open(g_opt['template'], 'r') as f:
@@ -468,56 +536,99 @@ def opengl_loader(parse: glParse):
     fstr = fstr.replace('/* <<gload-typedef>> */', template)
 
     # <<gload-enums>>
-    template = gload_enums(parse.feat, parse.enums)
+    template = gload_enums(parse.feat, parse.enum_index)
     template += '\n'
-    template += gload_enums(parse.ext, parse.enums)
+    template += gload_enums(parse.ext, parse.enum_index)
     template = template.replace('#', '# ')
     fstr = fstr.replace('/* <<gload-enums>> */', template)
 
     # <<gload-funcptr>>
-    template = gload_funcptr(parse.feat, parse.cmds)
+    template = gload_funcptr(parse.feat, parse.cmd_index)
     template += '\n'
-    template += gload_funcptr(parse.ext, parse.cmds)
+    template += gload_funcptr(parse.ext, parse.cmd_index)
     template = template.replace('#', '# ')
     fstr = fstr.replace('/* <<gload-funcptr>> */', template)
 
     # <<glaod-nameaddr>>
-    template = gload_nameaddr(parse.feat, parse.cmds)
+    template = gload_nameaddr(parse.feat, parse.cmd_index)
     template += '\n'
-    template += gload_nameaddr(parse.ext, parse.cmds)
+    template += gload_nameaddr(parse.ext, parse.cmd_index)
     template = template.replace('#', '# ')
     fstr = fstr.replace('/* <<gload-nameaddr>> */', template)
 
     # <<gload-loadfunc>>
-    template = gload_loadfunc(parse.feat, parse.cmds)
+    template = gload_loadfunc(parse.feat, parse.cmd_index)
     template += '\n'
-    template += gload_loadfunc(parse.ext, parse.cmds)
+    template += gload_loadfunc(parse.ext, parse.cmd_index)
     template = template.replace('#', '# ')
     fstr = fstr.replace('/* <<gload-loadfunc>> */', template)
 
     # <<gload-declr-0>>
-    template = gload_declr(parse.feat, parse.cmds, 0)
+    template = gload_declr(parse.feat, parse.cmd_index, 0)
     template += '\n'
-    template += gload_declr(parse.ext, parse.cmds, 0)
+    template += gload_declr(parse.ext, parse.cmd_index, 0)
     template = template.replace('#', '# ')
     fstr = fstr.replace('/* <<gload-declr-0>> */', template)
 
     # <<gload-declr-1>>
-    template = gload_declr(parse.feat, parse.cmds, 1)
+    template = gload_declr(parse.feat, parse.cmd_index, 1)
     template += '\n'
-    template += gload_declr(parse.ext, parse.cmds, 1)
+    template += gload_declr(parse.ext, parse.cmd_index, 1)
     template = template.replace('#', '# ')
     fstr = fstr.replace('/* <<gload-declr-1>> */', template)
 
     # <<gload-declr-2>>
-    template = gload_declr(parse.feat, parse.cmds, 2)
+    template = gload_declr(parse.feat, parse.cmd_index, 2)
     template += '\n'
-    template += gload_declr(parse.ext, parse.cmds, 2)
+    template += gload_declr(parse.ext, parse.cmd_index, 2)
     template = template.replace('#', '# ')
     fstr = fstr.replace('/* <<gload-declr-2>> */', template)
 
-    with open(g_opt['output'], 'w') as f:
-        f.write(fstr)
+    # <<gload-formats>>
+    template = gload_formats(parse.enums)
+    fstr = fstr.replace('/* <<gload-formats>> */', template)
+
+    # <<gload-enum-names-0>>
+    template = gload_enumnames(parse.feat, parse.ext, parse.enum_index, 0)
+    fstr = fstr.replace('/* <<gload-enum-names-0>> */', template)
+
+    # <<gload-enum-names-1>>
+    template = gload_enumnames(parse.feat, parse.ext, parse.enum_index, 1)
+    fstr = fstr.replace('/* <<gload-enum-names-1>> */', template)
+
+    # <<gload-enum-names-2>>
+    template = gload_enumnames(parse.feat, parse.ext, parse.enum_index, 2)
+    fstr = fstr.replace('/* <<gload-enum-names-2>> */', template)
+
+    # <<gload-enum-names-3>>
+    template = gload_enumnames(parse.feat, parse.ext, parse.enum_index, 3)
+    fstr = fstr.replace('/* <<gload-enum-names-3>> */', template)
+
+    # <<gload-enum-names-4>>
+    template = gload_enumnames(parse.feat, parse.ext, parse.enum_index, 4)
+    fstr = fstr.replace('/* <<gload-enum-names-4>> */', template)
+
+    # <<gload-enum-names-5>>
+    template = gload_enumnames(parse.feat, parse.ext, parse.enum_index, 5)
+    fstr = fstr.replace('/* <<gload-enum-names-5>> */', template)
+
+    # <<gload-immediate-0>>
+    template = gload_immediate(parse.feat, parse.cmd_index, 0)
+    fstr = fstr.replace('/* <<gload-immediate-0>> */', template)
+
+    # <<gload-immediate-1>>
+    template = gload_immediate(parse.feat, parse.cmd_index, 1)
+    fstr = fstr.replace('/* <<gload-immediate-1>> */', template)
+
+    # <<gload-usdt-0>>
+    template = gload_usdt(parse.feat + parse.ext, parse.cmd_index, 0)
+    fstr = fstr.replace('/* <<gload-usdt-0>> */', template)
+
+    # <<gload-usdt-1>>
+    template = gload_usdt(parse.feat + parse.ext, parse.cmd_index, 1)
+    fstr = fstr.replace('/* <<gload-usdt-1>> */', template)
+
+    return (fstr)
 
 
 # =================
@@ -529,7 +640,7 @@ def gload_profile_macro() -> str:
 
     # GLOAD_GL_PROFILE macro...
     result = '#if !defined (GLOAD_GL_PROFILE)\n'
-    result += f'# define GLOAD_GL_PROFILE \"{g_opt['profile']}\"\n'
+    result += f'# define GLOAD_GL_PROFILE \"{g_opt["profile"]}\"\n'
     result += '#endif /* GLOAD_GL_PROFILE */'
 
     return (result.strip())
@@ -539,17 +650,17 @@ def gload_glversion_macro() -> str:
 
     # GLOAD_GL_VERSION macro...
     result = '#if !defined (GLOAD_GL_VERSION)\n'
-    result += f'# define GLOAD_GL_VERSION \"{g_opt['version']}\"\n'
+    result += f'# define GLOAD_GL_VERSION \"{g_opt["version"]}\"\n'
     result += '#endif /* GLOAD_GL_VERSION */\n'
 
     # GLOAD_GLES_VERSION macro...
     result += '#if !defined (GLOAD_GLES_VERSION)\n'
-    result += f'# define GLOAD_GLES_VERSION \"{g_opt['version-es']}\"\n'
+    result += f'# define GLOAD_GLES_VERSION \"{g_opt["version-es"]}\"\n'
     result += '#endif /* GLOAD_GLES_VERSION */\n'
 
     # GLOAD_GLSC_VERSION macro...
     result += '#if !defined (GLOAD_GLSC_VERSION)\n'
-    result += f'# define GLOAD_GLSC_VERSION \"{g_opt['version-sc']}\"\n'
+    result += f'# define GLOAD_GLSC_VERSION \"{g_opt["version-sc"]}\"\n'
     result += '#endif /* GLOAD_GLSC_VERSION */'
 
     return (result.strip())
@@ -580,7 +691,7 @@ def gload_typedefs(types: list[glType]) -> str:
     return (result.strip())
 
 
-def gload_funcptr(lst, cmds: list[glCmd]) -> str:
+def gload_funcptr(lst, cmds: dict[str, glCmd]) -> str:
     result: str
 
     result = str()
@@ -598,7 +709,7 @@ def gload_funcptr(lst, cmds: list[glCmd]) -> str:
                 cmd: glCmd
                 func: str
 
-                cmd = next(cmd for cmd in cmds if cmd.name == c_str)
+                cmd = cmds[c_str]
                 func = f'typedef {cmd.proto.ptype}'
                 func += f' (APIENTRYP PFN{cmd.name.upper()}PROC) ('
                 for param in cmd.params:
@@ -613,7 +724,7 @@ def gload_funcptr(lst, cmds: list[glCmd]) -> str:
     return (result.strip())
 
 
-def gload_enums(lst, enums: list[glEnum]) -> str:
+def gload_enums(lst, enums: dict[str, glEnum]) -> str:
     result: str
 
     result = str()
@@ -629,17 +740,19 @@ def gload_enums(lst, enums: list[glEnum]) -> str:
             for e_str in req.enums:
                 enum: glEnum
 
-                enum = next(enum for enum in enums if enum.name == e_str)
+                enum = enums[e_str]
                 result += f'# define {enum.name} {enum.value}\n'
 
         result += f'#\n#endif /* {child.name} */\n'
     return (result.strip())
 
 
-def gload_declr(lst, cmds: list[glCmd], mode: int) -> str:
+def gload_declr(lst, cmds: dict[str, glCmd], mode: int) -> str:
     result: str
+    seen: set[str]
 
     result = str()
+    seen = set()
     for child in lst:
         # check if 'cmds' list of current child's requiremens is greater than 0...
         # ...if not, we don't bother adding it to gload.h...
@@ -657,13 +770,14 @@ def gload_declr(lst, cmds: list[glCmd], mode: int) -> str:
                 cmd: glCmd
                 func: str
 
-                cmd = next(cmd for cmd in cmds if cmd.name == c_str)
+                cmd = cmds[c_str]
 
                 if mode == 0:
                     func = f'PFN{cmd.name.upper()}PROC '
                     func += f'gload_{cmd.name};\n'
-                    if result.find(func) != -1:
+                    if func in seen:
                         result += 'extern '
+                    seen.add(func)
                     result += func
 
                 elif mode == 1:
@@ -685,7 +799,7 @@ def gload_declr(lst, cmds: list[glCmd], mode: int) -> str:
     return (result.strip())
 
 
-def gload_nameaddr(lst, cmds: list[glCmd]) -> str:
+def gload_nameaddr(lst, cmds: dict[str, glCmd]) -> str:
     result: str
 
     result = str()
@@ -703,14 +817,14 @@ def gload_nameaddr(lst, cmds: list[glCmd]) -> str:
                 cmd: glCmd
                 name: str
 
-                cmd = next(cmd for cmd in cmds if cmd.name == c_str)
+                cmd = cmds[c_str]
                 name = f'   {{ \"{cmd.name}\", (void **) &gload_{cmd.name} }},\n'
                 result += name
         result += f'\n#endif /* {child.name} */\n'
     return (result.strip())
 
 
-def gload_loadfunc(lst, cmds: list[glCmd]) -> str:
+def gload_loadfunc(lst, cmds: dict[str, glCmd]) -> str:
     result: str
 
     result = str()
@@ -728,7 +842,7 @@ def gload_loadfunc(lst, cmds: list[glCmd]) -> str:
                 cmd: glCmd
                 name: str
 
-                cmd = next(cmd for cmd in cmds if cmd.name == c_str)
+                cmd = cmds[c_str]
                 name = f'   if defined (!gload_{cmd.name} && '
                 name += f'!(gload_{cmd.name} = '
                 name += f'(PFN{cmd.name.upper()}PROC) load(\"{cmd.name}\"))) '
@@ -738,6 +852,345 @@ def gload_loadfunc(lst, cmds: list[glCmd]) -> str:
     return (result.strip())
 
 
+# Source: https://registry.khronos.org/OpenGL/extensions/ (texture compression extensions)
+g_format_blocks: list = [
+    (r'ASTC_(\d+)x(\d+)$', None),
+    (r'(S3TC_DXT1|RGTC1|R11_EAC|ETC1_RGB8|RGB8_ETC2|SRGB8_ETC2|PUNCHTHROUGH_ALPHA1_ETC2)$', 8),
+    (r'(S3TC_DXT3|S3TC_DXT5|RGTC2|RG11_EAC|BPTC_UNORM|BPTC_SIGNED_FLOAT|BPTC_UNSIGNED_FLOAT|ETC2_EAC)$', 16),
+]
+
+# packed formats, in bytes per texel...
+g_format_packed: dict = {
+    'R3_G3_B2': 1, 'RGB2': 1, 'RGBA2': 1, 'RGB4': 2, 'RGB5': 2, 'RGB565': 2, 'RGBA4': 2, 'RGB5_A1': 2,
+    'RGB10': 4, 'RGB10_A2': 4, 'RGB10_A2UI': 4, 'RGB12': 6, 'R11F_G11F_B10F': 4, 'RGB9_E5': 4,
+    'SRGB8_ALPHA8': 4, 'DEPTH_COMPONENT24': 4, 'DEPTH24_STENCIL8': 4, 'DEPTH32F_STENCIL8': 8,
+    'STENCIL_INDEX1': 1, 'STENCIL_INDEX4': 1,
+    # unsized formats, assuming 8-bit channels and padded depth...
+    'RED': 1, 'RG': 2, 'RGB': 3, 'RGBA': 4, 'SRGB': 3, 'SRGB_ALPHA': 4, 'ALPHA': 1, 'LUMINANCE': 1,
+    'LUMINANCE_ALPHA': 2, 'INTENSITY': 1, 'DEPTH_COMPONENT': 4, 'DEPTH_STENCIL': 4, 'STENCIL_INDEX': 1,
+}
+
+g_format_channels: dict = {
+    'R': 1, 'RG': 2, 'RGB': 3, 'RGBA': 4, 'SRGB': 3, 'ALPHA': 1, 'LUMINANCE': 1, 'LUMINANCE_ALPHA': 2, 'INTENSITY': 1,
+    'DEPTH_COMPONENT': 1, 'STENCIL_INDEX': 1,
+}
+
+
+def gl_format_size(name: str):
+    base: str
+    match: re.Match
+
+    # strip the prefix and the vendor suffix...
+    base = re.sub(r'_(EXT|ARB|OES|NV|APPLE|ANGLE|SGIX|KHR|MESA)$', '', name[3:])
+
+    if base.startswith('COMPRESSED_') or base.startswith('ETC1_'):
+        for pattern, size in g_format_blocks:
+            match = re.search(pattern, base)
+            if match is None:
+                continue
+            if size is None:
+                return (int(match.group(1)), int(match.group(2)), 16)
+            return (4, 4, size)
+        return (None)
+
+    if base in g_format_packed:
+        return (1, 1, g_format_packed[base])
+
+    match = re.fullmatch(r'LUMINANCE(\d+)_ALPHA(\d+)', base)
+    if match is not None:
+        return (1, 1, (int(match.group(1)) + int(match.group(2)) + 7) // 8)
+
+    match = re.fullmatch(r'([A-Z_]+?)(\d+)(F|I|UI|_SNORM)?', base)
+    if match is not None and match.group(1) in g_format_channels:
+        return (1, 1, (g_format_channels[match.group(1)] * int(match.group(2)) + 7) // 8)
+    return (None)
+
+
+def gload_formats(enums: list[glEnum]) -> str:
+    result: str
+    formats: dict
+
+    # one entry per value of the (sized) internal format groups, sorted for binary searches...
+    formats = dict()
+    for enum in enums:
+        size: tuple
+
+        if not enum.group or not {'InternalFormat', 'SizedInternalFormat'} & set(enum.group.split(',')):
+            continue
+        size = gl_format_size(enum.name)
+        if size is None:
+            continue
+        # keep the core name of the aliased values...
+        if int(enum.value, 16) in formats and len(formats[int(enum.value, 16)][0]) <= len(enum.name):
+            continue
+        formats[int(enum.value, 16)] = (enum.name, size)
+
+    result = str()
+    for value in sorted(formats):
+        name, size = formats[value]
+        result += f'    {{ 0x{value:04X}, {size[0]}, {size[1]}, {size[2]} }}, /* {name} */\n'
+    return (result.rstrip())
+
+
+def gload_enumnames(lst, exts: list[glExt], enums: dict[str, glEnum], mode: int) -> str:
+    result: str
+    best: dict
+    groups: list[str]
+    entries: list
+    offsets: dict[str, int]
+    offset: int
+    names: dict[str, int]
+    vendors: list[str]
+    aliases: list[int]
+
+    # the enums of the core features only, and a single name per value and group:
+    # aliases (i.e. vendor suffixes) are folded into the shortest name...
+    best = dict()
+    for child in lst:
+        for req in child.req:
+            for e_str in req.enums:
+                enum: glEnum
+                value: int
+
+                enum = enums[e_str]
+                value = int(enum.value, 0)
+                if value < 0 or value > 0xFFFFFFFF:
+                    continue
+                for group in (enum.group.split(',') if enum.group else ['']):
+                    key = (value, group)
+                    if key not in best or (len(e_str), e_str) < (len(best[key]), best[key]):
+                        best[key] = e_str
+
+    groups = sorted(set(group for _, group in best))
+    offsets = dict()
+    offset = 0
+    for e_str in sorted(set(best.values())):
+        offsets[e_str] = offset
+        offset += len(e_str) + 1
+    if offset > 0xFFFF or len(best) > 0xFFFF:
+        raise Exception('enum names don\'t fit 16-bit offsets')
+
+    # sorted by value, the preferred name of a value first...
+    entries = sorted(((value, len(e_str), e_str, groups.index(group)) for (value, group), e_str in best.items()))
+    names = dict()
+    for index, (_, _, e_str, _) in enumerate(entries):
+        names.setdefault(e_str, index)
+
+    # vendor suffixes are the ones of the registry extensions (GL_<vendor>_...), and a suffixed name
+    # only resolves to its core name when the registry declares it with the same value...
+    vendors = sorted(set(ext.name.split('_')[1] for ext in exts if ext.name.count('_') > 1))
+    if len(vendors) > 0x100:
+        raise Exception('vendor suffixes don\'t fit 8 bits')
+    aliases = list()
+    for e_str, enum in enums.items():
+        base, _, suffix = e_str.rpartition('_')
+        if e_str in names or suffix not in vendors or base not in names:
+            continue
+        try:
+            if int(enum.value, 0) != entries[names[base]][0]:
+                continue
+        except (TypeError, ValueError):
+            continue
+        aliases.append(names[base] << 8 | vendors.index(suffix))
+    aliases.sort()
+
+    result = str()
+    if mode == 0:
+        for e_str in offsets:
+            result += f'    "{e_str}\\0"\n'
+    elif mode == 1:
+        for group in groups:
+            result += f'    "{group}",\n'
+    elif mode == 2:
+        for value, _, e_str, group in entries:
+            result += f'    {{ 0x{value:04X}, {group}, {offsets[e_str]} }}, /* {e_str} */\n'
+    elif mode == 3:
+        # an entry of every name, in the order of the names...
+        indexes = [str(names[e_str]) for e_str in sorted(names)]
+        for i in range(0, len(indexes), 16):
+            result += '    ' + ', '.join(indexes[i:i + 16]) + ',\n'
+    elif mode == 4:
+        for vendor in vendors:
+            result += f'    "{vendor}",\n'
+    elif mode == 5:
+        for i in range(0, len(aliases), 8):
+            result += '    ' + ', '.join(f'0x{alias:06X}' for alias in aliases[i:i + 8]) + ',\n'
+    return (result.rstrip())
+
+
+# immediate-mode attributes: helper, default components...
+g_immediate_attribs: dict = {
+    'Vertex': ('gloadImmediate_vertex', ['0.0f', '0.0f', '0.0f', '1.0f']),
+    'Color': ('gloadImmediate_color', ['0.0f', '0.0f', '0.0f', '1.0f']),
+    'TexCoord': ('gloadImmediate_texcoord', ['0.0f', '0.0f']),
+}
+
+# ...and the conversion of a component to float, by type suffix (colors of integer types are normalized,
+# signed ones clamped to -1 since the most negative value maps below it)
+g_immediate_types: dict = {
+    'b': 'gloadImmediate_snorm((GLfloat) {0} / 127.0f)',
+    's': 'gloadImmediate_snorm((GLfloat) {0} / 32767.0f)',
+    'i': 'gloadImmediate_snorm((GLfloat) ((GLdouble) {0} / 2147483647.0))',
+    'ub': '(GLfloat) {0} / 255.0f',
+    'us': '(GLfloat) {0} / 65535.0f',
+    'ui': '(GLfloat) ((GLdouble) {0} / 4294967295.0)',
+}
+
+
+def gload_immediate(lst, cmds: dict[str, glCmd], mode: int) -> str:
+    result: str
+    names: list[str]
+    seen: set[str]
+
+    # every variant once, in the order of its first requirement; its index is the one of its original procedure...
+    names = list()
+    seen = set()
+    for child in lst:
+        for req in child.req:
+            for c_str in req.cmds:
+                if c_str not in seen and re.match(r'gl(Vertex|Color|TexCoord)[1-4](b|s|i|f|d|ub|us|ui)v?$', c_str):
+                    seen.add(c_str)
+                    names.append(c_str)
+
+    result = str()
+    if mode == 0:
+        result += f'static void *g_immediate_procs[{len(names)}];\n\n'
+
+    for index, c_str in enumerate(names):
+        cmd: glCmd
+        match: re.Match
+        helper: str
+        comps: list[str]
+        params: str
+        args: str
+
+        match = re.match(r'gl(Vertex|Color|TexCoord)([1-4])(b|s|i|f|d|ub|us|ui)(v?)$', c_str)
+        cmd = cmds[c_str]
+
+        if mode == 0:
+            helper, comps = g_immediate_attribs[match.group(1)]
+            comps = list(comps)
+            for i in range(min(int(match.group(2)), len(comps))):
+                comp = f'v[{i}]' if match.group(4) else f'p{i}'
+                if match.group(1) == 'Color' and match.group(3) in g_immediate_types:
+                    comps[i] = g_immediate_types[match.group(3)].format(comp)
+                else:
+                    comps[i] = f'(GLfloat) {comp}'
+            # unsigned bytes are stored as they are...
+            if match.group(1) == 'Color' and match.group(3) == 'ub':
+                helper = 'gloadImmediate_colorub'
+                comps = [f'v[{i}]' if match.group(4) else f'p{i}' for i in range(int(match.group(2)))]
+                comps += ['255'] * (4 - len(comps))
+
+            if match.group(4):
+                params = f'{cmd.params[0].ptype} v'
+                args = 'v'
+            else:
+                params = ', '.join(f'{param.ptype} p{i}' for i, param in enumerate(cmd.params))
+                args = ', '.join(f'p{i}' for i in range(len(cmd.params)))
+            # ...forwarded to the original procedure while the emulator isn't initialized
+            result += f'static void APIENTRY    gloadImmediate_{cmd.name}({params}) '
+            result += f'{{ if (!g_immediate.init) {{ ((PFN{cmd.name.upper()}PROC) g_immediate_procs[{index}])({args}); }} '
+            result += f'else {{ {helper}({", ".join(comps)}); }} }}\n'
+
+        elif mode == 1:
+            result += f'    {{ (void **) &gload_{cmd.name}, (void *) gloadImmediate_{cmd.name} }},\n'
+    return (result.rstrip())
+
+
+def gload_usdt(lst, cmds: dict[str, glCmd], mode: int) -> str:
+    result: str
+    names: list[str]
+    seen: set[str]
+
+    # every command once, in the order of its first requirement; its index is the command ID...
+    names = list()
+    seen = set()
+    for child in lst:
+        for req in child.req:
+            for c_str in req.cmds:
+                if c_str not in seen:
+                    seen.add(c_str)
+                    names.append(c_str)
+
+    result = str()
+    if mode == 0:
+        result += f'static void *g_usdt_procs[{len(names)}];\n\n'
+
+    for index, c_str in enumerate(names):
+        cmd: glCmd
+        params: str
+        args: str
+        call: str
+        entry: str
+        leave: str
+
+        cmd = cmds[c_str]
+
+        if mode == 0:
+            params = ', '.join(f'{param.ptype} p{i}' for i, param in enumerate(cmd.params)) or 'void'
+            args = ', '.join(f'p{i}' for i in range(len(cmd.params)))
+            call = f'((PFN{cmd.name.upper()}PROC) g_usdt_procs[{index}])({args})'
+            entry = f'GLOAD_INTERNAL_PROBE(call_entry, {index}, \"{cmd.name}\");'
+            leave = f'GLOAD_INTERNAL_PROBE(call_return, {index}, \"{cmd.name}\");'
+
+            # thunks of procedures returning a value keep it across the return probe...
+            if cmd.proto.ptype == 'void':
+                result += f'static void APIENTRY gload_usdt_{cmd.name}({params}) '
+                result += f'{{ {entry} {call}; {leave} }}\n'
+            else:
+                result += f'static {cmd.proto.ptype} APIENTRY gload_usdt_{cmd.name}({params}) '
+                result += f'{{ {cmd.proto.ptype} r; {entry} r = {call}; {leave} return (r); }}\n'
+
+        elif mode == 1:
+            result += f'    {{ (void **) &gload_{cmd.name}, (void *) gload_usdt_{cmd.name} }},\n'
+    return (result.rstrip())
+
+
+# ==============
+# SECTION: cache
+# ==============
+
+def gl_cache_key() -> str:
+    key: hashlib.sha256
+
+    # everything the output depends on: the registry, the template, this script and its options...
+    key = hashlib.sha256()
+    for filepath in (g_opt['xml'], g_opt['template'], __file__):
+        with open(filepath, 'rb') as f:
+            key.update(hashlib.sha256(f.read()).digest())
+    for opt in ('profile', 'version', 'version-es', 'version-sc'):
+        key.update(f'{opt}={g_opt[opt]}\n'.encode())
+    return (key.hexdigest())
+
+
+def gl_cache_hash(filepath: str) -> str:
+    try:
+        with open(filepath, 'rb') as f:
+            return (hashlib.sha256(f.read()).hexdigest())
+    except FileNotFoundError:
+        return (None)
+
+
+def gl_cache_valid(key: str) -> bool:
+    lines: list[str]
+
+    # the cache holds the key of the inputs and the hash of the output it generated...
+    try:
+        with open(g_opt['cache'], 'r') as f:
+            lines = f.read().split()
+    except FileNotFoundError:
+        return (False)
+    if len(lines) != 2 or lines[0] != key:
+        return (False)
+    return (lines[1] == gl_cache_hash(g_opt['output']))
+
+
+def gl_cache_store(key: str):
+    with open(g_opt['cache'], 'w') as f:
+        f.write(f'{key}\n{gl_cache_hash(g_opt["output"])}\n')
+
+
 # =============
 # SECTION: main
 # =============
@@ -746,9 +1199,31 @@ if __name__ == '__main__':
     gl_getopt()
 
     try:
-        tree = gl_loadxml(f'{g_path}/xml/gl.xml')
-        parse = gl_parsexml(tree)
-        opengl_loader(parse)
+        key = None
+        if g_opt['cache'] and not g_opt['check']:
+            key = gl_cache_key()
+            if gl_cache_valid(key):
+                sys.exit(0)
+
+        if g_opt['stream']:
+            parse = gl_parsexml_stream(g_opt['xml'])
+        else:
+            tree = gl_loadxml(g_opt['xml'])
+            parse = gl_parsexml(tree)
+        fstr = opengl_loader(parse)
+
+        # --check compares against the existing output instead of writing it...
+        if g_opt['check']:
+            with open(g_opt['output'], 'r') as f:
+                if f.read() != fstr:
+                    print(f'{__file__}: {g_opt["output"]} is out of date')
+                    sys.exit(1)
+            sys.exit(0)
+
+        with open(g_opt['output'], 'w') as f:
+            f.write(fstr)
+        if key is not None:
+            gl_cache_store(key)
     except Exception as err:
         print(f'{__file__}: {err}')
         sys.exit(1)
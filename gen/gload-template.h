@@ -89,6 +89,368 @@
  *              Enables error-logging to standard-output/standard-error.
  *              Enabled by default if GLOAD_VERBOSE is defined.
  *
+ *      #define GLOAD_STREAM_BUFFER
+ *          - TYPE:
+ *              OPTIONAL
+ *          - DESCRIPTION:
+ *              Enables the `t_gloadStreamBuffer` API: a persistently mapped buffer split into
+ *              per-frame regions, guarded by fences (GL_ARB_buffer_storage, OpenGL 4.4, GL_EXT_buffer_storage on OpenGLES).
+ *              NOTE:
+ *                  When buffer storage is not available, or the buffer has a single region, the stream buffer falls back
+ *                  to orphaning the buffer with `glBufferData` and uploading with `glBufferSubData`.
+ *
+ *      #define GLOAD_STREAM_BUFFER_MAX_REGIONS
+ *          - TYPE:
+ *              OPTIONAL (DEFAULT: 4)
+ *          - DESCRIPTION:
+ *              Maximum number of per-frame regions a single `t_gloadStreamBuffer` can be split into.
+ *
+ *      #define GLOAD_IMMEDIATE
+ *          - TYPE:
+ *              OPTIONAL
+ *          - DESCRIPTION:
+ *              Enables the immediate-mode emulator (`gloadImmediateInit`): `glBegin`/`glEnd`,
+ *              `glVertex*`, `glColor*` and `glTexCoord*` are accumulated on the CPU and drawn
+ *              in batches from a stream buffer with a built-in shader (OpenGL 3.0+, core profiles included).
+ *              NOTE:
+ *                  Defining this option also defines GLOAD_STREAM_BUFFER.
+ *
+ *      #define GLOAD_IMMEDIATE_MAX_VERTICES
+ *          - TYPE:
+ *              OPTIONAL (DEFAULT: 16384)
+ *          - DESCRIPTION:
+ *              Number of vertices the immediate-mode emulator accumulates before it flushes a batch.
+ *              The batch storage is allocated by `gloadImmediateInit`.
+ *
+ *      #define GLOAD_PROGRAM_CACHE
+ *          - TYPE:
+ *              OPTIONAL
+ *          - DESCRIPTION:
+ *              Enables the `t_gloadProgramCache` API: linked programs are stored in a memory-mapped
+ *              cache file with `glGetProgramBinary` and restored with `glProgramBinary` (GL_ARB_get_program_binary).
+ *              NOTE:
+ *                  Without GL_ARB_get_program_binary, programs are always compiled from sources.
+ *
+ *      #define GLOAD_PROGRAM_BUILDER
+ *          - TYPE:
+ *              OPTIONAL
+ *          - DESCRIPTION:
+ *              Enables the `t_gloadProgramBuilder` API: asynchronous program builds polled with
+ *              `GL_COMPLETION_STATUS_KHR` (GL_KHR_parallel_shader_compile, GL_ARB_parallel_shader_compile),
+ *              or linked by worker threads on shared contexts when the extensions aren't available.
+ *              NOTE:
+ *                  Worker threads use pthreads on GNU/Linux and MacOS (-lpthread).
+ *
+ *      #define GLOAD_PROGRAM_BUILDER_MAX_STAGES
+ *          - TYPE:
+ *              OPTIONAL (DEFAULT: 6)
+ *          - DESCRIPTION:
+ *              Maximum number of shader stages of a program submitted to a `t_gloadProgramBuilder`.
+ *
+ *      #define GLOAD_TEXTURE_UPLOADER
+ *          - TYPE:
+ *              OPTIONAL
+ *          - DESCRIPTION:
+ *              Enables the `t_gloadTextureUploader` API: pixel data submitted from any thread is copied into
+ *              a persistently mapped pixel-unpack buffer ring, uploaded with `glTextureSubImage*` on the
+ *              rendering thread and retired with fences.
+ *              NOTE:
+ *                  Without GL_ARB_buffer_storage, the ring is a pixel-unpack buffer mapped between the
+ *                  calls of `gloadTextureUploaderProcess` (OpenGL 3.2); only without buffer mapping and
+ *                  fences, the ring lives in CPU memory and is uploaded from there.
+ *                  The ring is protected with a mutex (-lpthread on GNU/Linux and MacOS).
+ *
+ *      #define GLOAD_TEXTURE_UPLOADER_MAX_REQUESTS
+ *          - TYPE:
+ *              OPTIONAL (DEFAULT: 256)
+ *          - DESCRIPTION:
+ *              Maximum number of uploads a single `t_gloadTextureUploader` can have in flight.
+ *
+ *      #define GLOAD_READBACK
+ *          - TYPE:
+ *              OPTIONAL
+ *          - DESCRIPTION:
+ *              Enables the `t_gloadReadback` API: `glReadPixels` into a ring of pixel-pack buffers,
+ *              fenced and mapped with `glMapBufferRange` a few frames later, without stalling the pipeline.
+ *              NOTE:
+ *                  Without pixel-pack buffers (OpenGL 3.0, GL_ARB_pixel_buffer_object), reads are synchronous.
+ *
+ *      #define GLOAD_READBACK_MAX_BUFFERS
+ *          - TYPE:
+ *              OPTIONAL (DEFAULT: 4)
+ *          - DESCRIPTION:
+ *              Maximum number of pixel-pack buffers a single `t_gloadReadback` can rotate through.
+ *
+ *      #define GLOAD_PIPELINE_STATE
+ *          - TYPE:
+ *              OPTIONAL
+ *          - DESCRIPTION:
+ *              Enables the `t_gloadPipelineState` API: immutable, hashed objects bundling blend, depth/stencil,
+ *              rasterizer, viewport and program state. Binding one emits only the calls for the state
+ *              that differs from the currently bound one.
+ *              NOTE:
+ *                  The bound state is tracked per process, not per context; call `gloadPipelineStateInvalidate`
+ *                  after switching contexts or changing the state with raw OpenGL calls.
+ *
+ *      #define GLOAD_DRAW_QUEUE
+ *          - TYPE:
+ *              OPTIONAL
+ *          - DESCRIPTION:
+ *              Enables the `t_gloadDrawQueue` API: indexed draws recorded with 64-bit sort keys,
+ *              radix-sorted and submitted in order, skipping redundant program, vertex array and texture binds.
+ *              Runs of draws sharing the same state are issued with `glMultiDrawElementsIndirect` when available
+ *              (OpenGL 4.3, GL_ARB_multi_draw_indirect).
+ *              NOTE:
+ *                  Defining this option also defines GLOAD_STREAM_BUFFER.
+ *
+ *      #define GLOAD_DRAW_QUEUE_MAX_TEXTURES
+ *          - TYPE:
+ *              OPTIONAL (DEFAULT: 4)
+ *          - DESCRIPTION:
+ *              Number of texture units a single `t_gloadDrawCommand` can bind.
+ *
+ *      #define GLOAD_VERTEX_ARRAY_CACHE
+ *          - TYPE:
+ *              OPTIONAL
+ *          - DESCRIPTION:
+ *              Enables the `t_gloadVertexArrayCache` API: one vertex array object per unique vertex layout,
+ *              looked up by a hash of the canonicalized layout, with vertex and index buffers bound separately
+ *              (OpenGL 4.5, GL_ARB_direct_state_access, or OpenGL 4.3, GL_ARB_vertex_attrib_binding).
+ *
+ *      #define GLOAD_VERTEX_LAYOUT_MAX_ATTRIBS
+ *          - TYPE:
+ *              OPTIONAL (DEFAULT: 16)
+ *          - DESCRIPTION:
+ *              Maximum number of attributes of a single `t_gloadVertexLayout`.
+ *
+ *      #define GLOAD_VERTEX_LAYOUT_MAX_BINDINGS
+ *          - TYPE:
+ *              OPTIONAL (DEFAULT: 8)
+ *          - DESCRIPTION:
+ *              Maximum number of vertex buffer bindings of a single `t_gloadVertexLayout`.
+ *
+ *      #define GLOAD_PROGRAM_REFLECTION
+ *          - TYPE:
+ *              OPTIONAL
+ *          - DESCRIPTION:
+ *              Enables the `t_gloadProgramReflection` API: uniforms, blocks and attributes of a linked program,
+ *              reflected once (`glGetProgramResource*`, or `glGetActiveUniform`/`glGetActiveAttrib` on older contexts)
+ *              into a perfect-hashed table addressed by name hashes, in place of `glGetUniformLocation` in the draw loop.
+ *
+ *      #define GLOAD_OBJECT_CACHE
+ *          - TYPE:
+ *              OPTIONAL
+ *          - DESCRIPTION:
+ *              Enables the sampler and framebuffer caches (`gloadObjectCacheInit`): sampler descriptions and sets of
+ *              framebuffer attachments are hashed into shared objects, evicted in LRU order. Framebuffers are released
+ *              automatically when one of their textures is deleted with `glDeleteTextures`.
+ *              NOTE:
+ *                  The caches are per process; framebuffers are only valid in the context they were created in.
+ *                  Objects returned since the last `gloadObjectCacheNextFrame` are never evicted, so names are valid
+ *                  until the end of the frame; a cache full of such objects fails the lookup.
+ *
+ *      #define GLOAD_OBJECT_CACHE_SAMPLERS
+ *          - TYPE:
+ *              OPTIONAL (DEFAULT: 64)
+ *          - DESCRIPTION:
+ *              Maximum number of cached sampler objects.
+ *
+ *      #define GLOAD_OBJECT_CACHE_FRAMEBUFFERS
+ *          - TYPE:
+ *              OPTIONAL (DEFAULT: 32)
+ *          - DESCRIPTION:
+ *              Maximum number of cached framebuffer objects.
+ *
+ *      #define GLOAD_OBJECT_CACHE_MAX_COLOR_ATTACHMENTS
+ *          - TYPE:
+ *              OPTIONAL (DEFAULT: 4)
+ *          - DESCRIPTION:
+ *              Maximum number of color attachments of a single `t_gloadFramebufferDesc`.
+ *
+ *      #define GLOAD_BINDLESS
+ *          - TYPE:
+ *              OPTIONAL
+ *          - DESCRIPTION:
+ *              Enables the `t_gloadBindless` API on top of GL_ARB_bindless_texture: textures are added once to a table of
+ *              64-bit handles kept in a shader storage buffer, and made resident on use within a per-frame working set.
+ *              Above the residency budget, the least recently used handles are made non-resident.
+ *              NOTE:
+ *                  The state of a texture (and sampler) can't be changed once its handle exists.
+ *
+ *      #define GLOAD_DELETION_QUEUE
+ *          - TYPE:
+ *              OPTIONAL
+ *          - DESCRIPTION:
+ *              Enables the `t_gloadDeletionQueue` API: deletions of buffers, textures and other objects are deferred until
+ *              the fence of their frame has signalled, then issued as a single `glDelete*` call per type.
+ *              Retired buffers go into a pool instead, and are handed back for new buffers of the same size and flags.
+ *
+ *      #define GLOAD_DELETION_QUEUE_FRAMES
+ *          - TYPE:
+ *              OPTIONAL (DEFAULT: 3)
+ *          - DESCRIPTION:
+ *              Maximum number of frames in flight; ending a frame waits for the oldest one above this number.
+ *
+ *      #define GLOAD_DELETION_QUEUE_POOL
+ *          - TYPE:
+ *              OPTIONAL (DEFAULT: 64)
+ *          - DESCRIPTION:
+ *              Maximum number of buffers kept for recycling; the next retired buffers are deleted.
+ *
+ *      #define GLOAD_BUFFER_ALLOCATOR
+ *          - TYPE:
+ *              OPTIONAL
+ *          - DESCRIPTION:
+ *              Enables the `t_gloadBufferAllocator` API: vertex, index and uniform allocations carved out of a single
+ *              large buffer by a constant-time TLSF-style offset allocator, aligned for their binding target, with
+ *              compaction through `glCopyBufferSubData` and fragmentation statistics.
+ *
+ *      #define GLOAD_RENDER_GRAPH
+ *          - TYPE:
+ *              OPTIONAL
+ *          - DESCRIPTION:
+ *              Enables the `t_gloadRenderGraph` API: compute and draw passes declare the buffers and textures they read
+ *              and write, and the graph issues the minimal `glMemoryBarrier` (or `glMemoryBarrierByRegion`) bits between
+ *              them instead of `GL_ALL_BARRIER_BITS`, optionally measuring the GPU time with a timer query.
+ *              Framebuffer attachments that no later pass reads are invalidated at the end of their pass, and cleared
+ *              ones before it, so tiled GPUs skip their loads and stores.
+ *
+ *      #define GLOAD_CONTEXT_POOL
+ *          - TYPE:
+ *              OPTIONAL
+ *          - DESCRIPTION:
+ *              Enables the `t_gloadContextPool` API: worker threads, each owning a hidden context shared with the
+ *              current one, run resource creation jobs (buffers, textures, programs) off the rendering thread.
+ *              Finished jobs are handed over with a fence the rendering context waits on with `glWaitSync`.
+ *              NOTE:
+ *                  The hidden contexts are created through EGL or GLX when the backend is selected, otherwise
+ *                  through user callbacks. Worker threads use pthreads on GNU/Linux and MacOS (-lpthread).
+ *                  With GLX, `XInitThreads` must be called before opening the display.
+ *
+ *      #define GLOAD_STALL_DETECTOR
+ *          - TYPE:
+ *              OPTIONAL
+ *          - DESCRIPTION:
+ *              Enables the `gloadStallDetector*` API: between `gloadStallDetectorBeginFrame` and `gloadStallDetectorEndFrame`,
+ *              calls known to synchronize the CPU with the GPU (`glGet*`, `glReadPixels` without a pixel-pack buffer, `glFinish`,
+ *              synchronized buffer mappings, query results read without checking their availability, `glClientWaitSync`
+ *              with a timeout) are timed and aggregated per call site, identified by return addresses.
+ *              NOTE:
+ *                  Diagnostic mode: every hooked call costs a branch, and a timed call a lock and a hash lookup.
+ *
+ *      #define GLOAD_STALL_DETECTOR_MAX_SITES
+ *          - TYPE:
+ *              OPTIONAL (DEFAULT: 256)
+ *          - DESCRIPTION:
+ *              Maximum number of call sites recorded; stalls from further call sites are only counted.
+ *
+ *      #define GLOAD_STALL_DETECTOR_DEPTH
+ *          - TYPE:
+ *              OPTIONAL (DEFAULT: 1)
+ *          - DESCRIPTION:
+ *              Number of return addresses identifying a call site. Above 1, the backtrace is captured with
+ *              `backtrace` (execinfo.h) on GNU/Linux and MacOS; other platforms only record the caller.
+ *
+ *      #define GLOAD_USDT
+ *          - TYPE:
+ *              OPTIONAL
+ *          - DESCRIPTION:
+ *              Route every loaded OpenGL procedure through a generated thunk firing the USDT probes
+ *              `gload:call_entry` and `gload:call_return` (command ID, command name), and fire
+ *              `gload:load_begin`, `gload:library_open` and `gload:load_end` while loading.
+ *              Detached probes are single `nop` instructions; attach them with `bpftrace` or `perf probe`.
+ *              NOTE:
+ *                  GNU/Linux only, ignored elsewhere; requires `sys/sdt.h` (systemtap-sdt-dev).
+ *
+ *      #define GLOAD_MEMORY_STATS
+ *          - TYPE:
+ *              OPTIONAL
+ *          - DESCRIPTION:
+ *              Enables the `gloadMemStats*` API: the allocation procedures (`glBufferData`, `glBufferStorage`,
+ *              `glTexImage*`, `glTexStorage*`, `glRenderbufferStorage*`, their DSA variants) and the matching `glDelete*`
+ *              are hooked to track the live bytes of buffers, textures and renderbuffers, with texel sizes taken from
+ *              a table generated from the internal format groups of the registry. The free video memory reported by
+ *              `GL_NVX_gpu_memory_info` or `GL_ATI_meminfo` is added when present.
+ *              NOTE:
+ *                  Sizes are estimated from the requested storage, without the driver's padding and alignment.
+ *                  Objects are tracked by name, for a single share group.
+ *                  The bound objects are followed per thread through the hooked `glBind*` procedures rather than queried,
+ *                  so that tracking adds no `glGet*` call: a thread making several contexts current in turn should
+ *                  allocate through the DSA procedures.
+ *
+ *      #define GLOAD_MEMORY_STATS_MAX_NAMES
+ *          - TYPE:
+ *              OPTIONAL (DEFAULT: 65536)
+ *          - DESCRIPTION:
+ *              Names above which objects are no longer tracked, only counted as untracked allocations.
+ *
+ *      #define GLOAD_TRACE
+ *          - TYPE:
+ *              OPTIONAL
+ *          - DESCRIPTION:
+ *              Enables the `gloadTrace*` API: CPU spans of every thread, GPU spans measured with `GL_TIMESTAMP` queries
+ *              and frame markers are written to a Chrome trace-event JSON file, loadable in `chrome://tracing` or Perfetto.
+ *              Each thread records into its own lock-free buffer, drained by a writer thread at every frame; GPU times
+ *              are moved onto the CPU clock by calibrating it against `glGetInteger64v(GL_TIMESTAMP)`.
+ *              NOTE:
+ *                  Events that don't fit into a full buffer are dropped and counted. Worker threads use pthreads
+ *                  on GNU/Linux and MacOS (-lpthread).
+ *
+ *      #define GLOAD_TRACE_BUFFER_EVENTS
+ *          - TYPE:
+ *              OPTIONAL (DEFAULT: 16384)
+ *          - DESCRIPTION:
+ *              Number of events buffered per thread between two frames, a power of two.
+ *
+ *      #define GLOAD_TRACE_GPU_QUERIES
+ *          - TYPE:
+ *              OPTIONAL (DEFAULT: 256)
+ *          - DESCRIPTION:
+ *              Maximum number of GPU spans in flight, i.e. waiting for their timestamps.
+ *
+ *      #define GLOAD_DEBUG_OUTPUT
+ *          - TYPE:
+ *              OPTIONAL
+ *          - DESCRIPTION:
+ *              Enables the `gloadDebugOutput*` API: an asynchronous `glDebugMessageCallback` that only counts the messages
+ *              per ID and copies the first one of each ID and interval into a lock-free ring, drained by a thread that
+ *              forwards them (with their repeat count) to a user callback or `stderr`. `GL_DEBUG_TYPE_PERFORMANCE` messages
+ *              are also aggregated by ID, to rank the slow paths reported by the driver.
+ *              NOTE:
+ *                  Requires OpenGL 4.3 or `GL_KHR_debug`. Worker threads use pthreads on GNU/Linux and MacOS (-lpthread).
+ *
+ *      #define GLOAD_DEBUG_OUTPUT_MESSAGES
+ *          - TYPE:
+ *              OPTIONAL (DEFAULT: 256)
+ *          - DESCRIPTION:
+ *              Number of messages queued between two drains, a power of two; further messages are dropped.
+ *
+ *      #define GLOAD_DEBUG_OUTPUT_MAX_IDS
+ *          - TYPE:
+ *              OPTIONAL (DEFAULT: 1024)
+ *          - DESCRIPTION:
+ *              Number of distinct message IDs tracked, a power of two; messages of further IDs are dropped.
+ *
+ *      #define GLOAD_DEBUG_OUTPUT_INTERVAL
+ *          - TYPE:
+ *              OPTIONAL (DEFAULT: 1000)
+ *          - DESCRIPTION:
+ *              Interval in milliseconds within which a message ID is forwarded once; repeats are only counted.
+ *
+ *      #define GLOAD_DEBUG_OUTPUT_MESSAGE_LENGTH
+ *          - TYPE:
+ *              OPTIONAL (DEFAULT: 256)
+ *          - DESCRIPTION:
+ *              Maximum length of the copied messages, including the null terminator; longer ones are truncated.
+ *
+ *      #define GLOAD_ENUM_NAMES
+ *          - TYPE:
+ *              OPTIONAL
+ *          - DESCRIPTION:
+ *              Enables `gloadEnumName` and `gloadEnumValue`: conversions between the enums of the core OpenGL, OpenGL ES
+ *              and OpenGL SC versions and their names, through tables generated from the registry (about 79 KB),
+ *              sorted for binary searches. Values shared by several enums are told apart by their registry group.
+ *
  *
  *  Constants (MUST NOT be defined by user):
  *
@@ -318,6 +680,30 @@ GLAPI int   gloadLoadGLLoader(t_gloadLoader);
  * */
 GLAPI void  *gloadGetProcAddress(const char *);
 
+/* `gloadIsExtensionSupported`:
+ *
+ * Check if the current OpenGL context exposes an extension.
+ * Uses `glGetStringi` on OpenGL 3.0+ contexts and `glGetString(GL_EXTENSIONS)` otherwise.
+ * NOTE:
+ *  This function requires a current context and loaded OpenGL functions.
+ *
+ * - param: `const char *name` - name of the extension (i.e. "GL_ARB_buffer_storage")
+ * - return: `true` if the extension is supported, `false` otherwise.
+ * */
+GLAPI int   gloadIsExtensionSupported(const char *);
+
+/* `gloadIsVersionSupported`:
+ *
+ * Check if the version of the current OpenGL (or OpenGLES) context is at least `major`.`minor`.
+ * NOTE:
+ *  This function requires a current context and loaded OpenGL functions.
+ *
+ * - param: `int major` - major version number
+ * - param: `int minor` - minor version number
+ * - return: `true` if the context version is greater or equal, `false` otherwise.
+ * */
+GLAPI int   gloadIsVersionSupported(int, int);
+
 /* SECTION:
  *  OpenGL API
  * * * * * * */
@@ -331,298 +717,11689 @@ GLAPI void  *gloadGetProcAddress(const char *);
 /* <<gload-declr-1>> */
 /* <<gload-declr-2>> */
 #
-# if defined (__cplusplus)
+# if (defined (GLOAD_IMMEDIATE) || defined (GLOAD_DRAW_QUEUE)) && !defined (GLOAD_STREAM_BUFFER)
+#  define GLOAD_STREAM_BUFFER 1
+# endif /* GLOAD_IMMEDIATE, GLOAD_DRAW_QUEUE, GLOAD_STREAM_BUFFER */
+#
+# if defined (GLOAD_STREAM_BUFFER)
+#  if !defined (GLOAD_STREAM_BUFFER_MAX_REGIONS)
+#   define GLOAD_STREAM_BUFFER_MAX_REGIONS 4
+#  endif /* GLOAD_STREAM_BUFFER_MAX_REGIONS */
 
-}
+/* SECTION:
+ *  gload stream buffer API
+ * * * * * * * * * * * * * */
 
-# endif /* __cplusplus */
-#
-# if defined (GLOAD_IMPLEMENTATION)
-#
-#  if !defined (__cplusplus)
-#   include <stdio.h>
-#   include <stdint.h>
-#   include <stddef.h>
-#  else
-#   include <cstdio>
-#   include <cstdint>
-#   include <cstddef>
-#   include <string>
-#  endif /* __cplusplus */
-#
-#  if defined (GLOAD_LINUX) || defined (GLOAD_APPLE)
-#   include <dlfcn.h>
-#  endif /* GLOAD_LINUX, GLOAD_APPLE*/
-#  if defined (GLOAD_WIN32)
-#   include <libloaderapi.h>
-#  endif /* GLOAD_WIN32 */
+/* `t_gloadStreamBuffer` - single buffer object split into `count` per-frame regions.
+ *
+ * While `persistent` is set, the buffer is created with `glBufferStorage` and stays
+ * mapped for its entire lifetime; every region is guarded by a fence, so the CPU only waits
+ * when it wraps around onto a region the GPU is still reading from.
+ * Otherwise, `mapping` points to a CPU-side copy of a single region which is uploaded
+ * with `glBufferSubData` into storage orphaned by `glBufferData` at the start of every frame.
+ * */
+typedef struct s_gloadStreamBuffer {
+    GLuint      buffer;
+    GLenum      target;
+    GLsizeiptr  region;
+    GLuint      count;
+    GLuint      index;
+    GLsizeiptr  head;
+    GLsizeiptr  tail;
+    GLubyte     *mapping;
+    int         persistent;
+    GLsync      fences[GLOAD_STREAM_BUFFER_MAX_REGIONS];
+
+    /* statistics */
+    GLuint64    bytes;
+    GLuint64    frames;
+    GLuint64    waits;
+}   t_gloadStreamBuffer;
+
+/* `gloadStreamBufferCreate`:
+ *
+ * Create a stream buffer of `count` regions, `region` bytes each.
+ * The buffer is left bound to `target`.
+ *
+ * - param: `t_gloadStreamBuffer *stream` - stream buffer to initialize
+ * - param: `GLenum target` - buffer binding target (i.e. `GL_ARRAY_BUFFER`, `GL_UNIFORM_BUFFER`)
+ * - param: `GLsizeiptr region` - size of a single per-frame region in bytes
+ * - param: `GLuint count` - number of regions (1 - GLOAD_STREAM_BUFFER_MAX_REGIONS, at least 2 to map it persistently)
+ * - return: `true` on success, `false` on failure.
+ * */
+GLAPI int   gloadStreamBufferCreate(t_gloadStreamBuffer *, GLenum, GLsizeiptr, GLuint);
+
+/* `gloadStreamBufferDestroy`:
+ *
+ * Unmap and delete the buffer and every pending fence of the stream buffer.
+ *
+ * - param: `t_gloadStreamBuffer *stream` - stream buffer to destroy
+ * */
+GLAPI void  gloadStreamBufferDestroy(t_gloadStreamBuffer *);
+
+/* `gloadStreamBufferMap`:
+ *
+ * Reserve `size` bytes in the current region and return a pointer to write them to.
+ * The written data becomes visible to the GPU after `gloadStreamBufferUnmap`.
+ *
+ * - param: `t_gloadStreamBuffer *stream` - stream buffer
+ * - param: `GLsizeiptr size` - number of bytes to reserve
+ * - param: `GLsizeiptr align` - alignment of the reservation (i.e. GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT), 0 for none
+ * - param: `GLintptr *offset` - offset of the reservation within the buffer object, to use in draw/bind calls
+ * - return: pointer to the reserved memory on success, null if the region is full.
+ * */
+GLAPI void  *gloadStreamBufferMap(t_gloadStreamBuffer *, GLsizeiptr, GLsizeiptr, GLintptr *);
+
+/* `gloadStreamBufferUnmap`:
+ *
+ * Publish the last reservation returned from `gloadStreamBufferMap`.
+ *
+ * - param: `t_gloadStreamBuffer *stream` - stream buffer
+ * */
+GLAPI void  gloadStreamBufferUnmap(t_gloadStreamBuffer *);
+
+/* `gloadStreamBufferNextFrame`:
+ *
+ * Fence the current region and advance to the next one, waiting on its fence if the GPU
+ * hasn't finished reading from it yet. Should be called once per frame, after the draws
+ * that source the current region were issued.
+ *
+ * - param: `t_gloadStreamBuffer *stream` - stream buffer
+ * */
+GLAPI void  gloadStreamBufferNextFrame(t_gloadStreamBuffer *);
+
+# endif /* GLOAD_STREAM_BUFFER */
 #
-#  if !defined (GLOAD_DLSYM) && !(defined (GLOAD_GLX) || defined (GLOAD_EGL) || defined (GLOAD_WGL))
-#   define GLOAD_DLSYM 1
-#  endif /* GLOAD_DLSYM, GLOAD_GLX, GLOAD_EGL, GLOAD_WGL */
+# if defined (GLOAD_IMMEDIATE)
+#  if !defined (GLOAD_IMMEDIATE_MAX_VERTICES)
+#   define GLOAD_IMMEDIATE_MAX_VERTICES 16384
+#  endif /* GLOAD_IMMEDIATE_MAX_VERTICES */
+
+/* SECTION:
+ *  gload immediate-mode API
+ * * * * * * * * * * * * * */
+
+/* `gloadImmediateInit`:
+ *
+ * Install the immediate-mode emulator over the loaded OpenGL functions.
+ * From now on, `glBegin`/`glEnd` and every `glVertex*`, `glColor*` and `glTexCoord*` variant are accumulated
+ * on the CPU (texture coordinates keep `s` and `t` only);
+ * quads, strips, fans and polygons are converted to indexed triangles (line strips and loops to indexed lines).
+ * The batch is drawn when the primitive type or any tracked state changes (`glBindTexture`, `glUseProgram`,
+ * `glEnable`, `glBlendFunc`, `glViewport`, `glClear`, `glDraw*`, `glFlush`, ...) or when it's full.
+ * If no program is bound, the batch is drawn with a built-in shader;
+ * otherwise the bound program is used with attributes: 0 - position, 1 - color, 2 - texture coordinates.
+ * NOTE:
+ *  Call this function after `gloadLoadGL`/`gloadLoadGLLoader`, with the context current.
+ *  Call `gloadImmediateFlush` (or `glFlush`) before swapping the buffers.
+ *
+ * - return: `true` on success, `false` on failure.
+ * */
+GLAPI int   gloadImmediateInit(void);
+
+/* `gloadImmediateTerminate`:
+ *
+ * Flush the pending batch, restore the original OpenGL functions and delete the emulator's objects.
+ * Hooks another one was installed on top of stay in place and call their original functions from now on.
+ * */
+GLAPI void  gloadImmediateTerminate(void);
+
+/* `gloadImmediateFlush`:
+ *
+ * Draw every vertex accumulated since the last flush.
+ * */
+GLAPI void  gloadImmediateFlush(void);
+
+/* `gloadImmediateMatrix`:
+ *
+ * Set the model-view-projection matrix used by the built-in shader.
+ * The emulator doesn't implement the legacy matrix stack, so this replaces `glOrtho`, `glLoadMatrix` etc.
+ *
+ * - param: `const GLfloat *mvp` - column-major 4x4 matrix, null resets it to identity
+ * */
+GLAPI void  gloadImmediateMatrix(const GLfloat *);
+
+# endif /* GLOAD_IMMEDIATE */
 #
-#  if defined (GLOAD_DLSYM)
-#   if defined (GLOAD_GLX)
-#    error "Multiple backends selected: GLOAD_DLSYM and GLOAD_GLX."
-#   endif /* GLOAD_GLX */
-#   if defined (GLOAD_EGL)
-#    error "Multiple backends selected: GLOAD_DLSYM and GLOAD_EGL."
-#   endif /* GLOAD_EGL */
-#   if defined (GLOAD_WGL)
-#    error "Multiple backends selected: GLOAD_DLSYM and GLOAD_WGL."
-#   endif /* GLOAD_WGL */
-#  endif /* GLOAD_DLSYM */
-#
-#  if defined (GLOAD_GLX)
-#   if defined (GLOAD_DLSYM)
-#    error "Multiple backends selected: GLOAD_GLX and GLOAD_DLSYM."
-#   endif /* GLOAD_DLSYM */
-#   if defined (GLOAD_EGL)
-#    error "Multiple backends selected: GLOAD_GLX and GLOAD_EGL."
-#   endif /* GLOAD_EGL */
-#   if defined (GLOAD_WGL)
-#    error "Multiple backends selected: GLOAD_GLX and GLOAD_WGL."
-#   endif /* GLOAD_WGL */
-#
-#   include <GL/glx.h>
-#   include <GL/glxext.h>
-#  endif /* GLOAD_GLX */
+# if defined (GLOAD_PROGRAM_CACHE)
+
+/* SECTION:
+ *  gload program cache API
+ * * * * * * * * * * * * * */
+
+/* `t_gloadProgramCache` - on-disk cache of linked program binaries.
+ *
+ * Programs are keyed on a hash of their stages and sources (checked against a second hash and their length
+ * on a hit, so a collision can't load the wrong binary), and the cache file is only valid
+ * for the driver (`GL_VENDOR`, `GL_RENDERER`, `GL_VERSION`) it was written with.
+ * The file is memory-mapped on open; programs linked during the run are written back on close.
+ *
+ * Statistics:
+ *  - `hits`, `misses` - programs loaded with `glProgramBinary` / compiled from sources (failed links included)
+ *  - `load_ns`, `compile_ns` - time spent on each path, in nanoseconds
+ * The startup time saved can be estimated as `hits * (compile_ns / misses) - load_ns`.
+ * */
+typedef struct s_gloadProgramCache {
+    char        *path;
+    void        *mapping;
+    GLuint64    size;
+    GLuint64    driver;
+    int         supported;
+    void        *index;
+    GLuint      capacity;
+    GLuint      count;
+    void        *pending;
+
+    /* statistics */
+    GLuint      hits;
+    GLuint      misses;
+    GLuint64    load_ns;
+    GLuint64    compile_ns;
+}   t_gloadProgramCache;
+
+/* `gloadProgramCacheOpen`:
+ *
+ * Open (and memory-map) the cache file. A missing file, or one written by a different driver,
+ * results in an empty cache.
+ * NOTE:
+ *  This function requires a current context and loaded OpenGL functions.
+ *
+ * - param: `t_gloadProgramCache *cache` - cache to initialize
+ * - param: `const char *path` - path to the cache file
+ * - return: `true` on success, `false` on failure.
+ * */
+GLAPI int   gloadProgramCacheOpen(t_gloadProgramCache *, const char *);
+
+/* `gloadProgramCacheClose`:
+ *
+ * Write the programs linked since `gloadProgramCacheOpen` to the cache file and release the cache.
+ *
+ * - param: `t_gloadProgramCache *cache` - cache to close
+ * - return: `true` on success, `false` if the cache file couldn't be written.
+ * */
+GLAPI int   gloadProgramCacheClose(t_gloadProgramCache *);
+
+/* `gloadProgramCacheLink`:
+ *
+ * Create a program from `count` shader stages.
+ * On a cache hit, the program is created with `glProgramBinary`; otherwise its shaders are compiled,
+ * linked and, with GL_ARB_get_program_binary, retrieved with `glGetProgramBinary` to be stored on close.
+ * NOTE:
+ *  Binding locations must be specified in the sources (`layout (location = ...)`),
+ *  since the program is linked before the caller can access it.
+ *
+ * - param: `t_gloadProgramCache *cache` - cache
+ * - param: `GLsizei count` - number of stages
+ * - param: `const GLenum *types` - type of every stage (i.e. `GL_VERTEX_SHADER`)
+ * - param: `const GLchar *const *sources` - null-terminated source of every stage
+ * - return: name of the linked program on success, 0 on failure.
+ * */
+GLAPI GLuint    gloadProgramCacheLink(t_gloadProgramCache *, GLsizei, const GLenum *, const GLchar *const *);
+
+# endif /* GLOAD_PROGRAM_CACHE */
 #
-#  if defined (GLOAD_EGL)
-#   if defined (GLOAD_DLSYM)
-#    error "Multiple backends selected: GLOAD_EGL and GLOAD_DLSYM."
-#   endif /* GLOAD_DLSYM */
-#   if defined (GLOAD_GLX)
-#    error "Multiple backends selected: GLOAD_EGL and GLOAD_GLX."
-#   endif /* GLOAD_GLX */
-#   if defined (GLOAD_WGL)
-#    error "Multiple backends selected: GLOAD_EGL and GLOAD_WGL."
-#   endif /* GLOAD_WGL */
+# if defined (GLOAD_PROGRAM_BUILDER)
+#  if !defined (GLOAD_PROGRAM_BUILDER_MAX_STAGES)
+#   define GLOAD_PROGRAM_BUILDER_MAX_STAGES 6
+#  endif /* GLOAD_PROGRAM_BUILDER_MAX_STAGES */
+
+/* SECTION:
+ *  gload program builder API
+ * * * * * * * * * * * * * * */
+
+/* `t_gloadProgramCallback` - called on the polling thread when a submitted program finished linking.
+ *
+ * - param: `GLuint program` - name of the program, owned by the callback (it's not deleted on failure)
+ * - param: `GLint status` - `GL_LINK_STATUS` of the program
+ * - param: `void *user` - user pointer passed to `gloadProgramBuilderSubmit`
+ * */
+typedef void    (*t_gloadProgramCallback)(GLuint, GLint, void *);
+
+/* `t_gloadMakeCurrent` - make a context current on the calling thread (i.e. a wrapper around `eglMakeCurrent`).
+ *
+ * - param: `void *context` - context to bind, null to release the current one
+ * - return: `true` on success, `false` on failure.
+ * */
+typedef int     (*t_gloadMakeCurrent)(void *);
+
+/* `t_gloadProgramBuilder` - queue of programs linked asynchronously.
+ *
+ * With GL_KHR_parallel_shader_compile (or GL_ARB_parallel_shader_compile), every program is compiled
+ * and linked on the calling thread, and the driver's compiler threads do the work in the background.
+ * Otherwise, the programs are built by worker threads, one per shared context passed to
+ * `gloadProgramBuilderCreate`, and handed over to the polling thread with fences.
+ * Without either, programs are linked synchronously on submission.
+ * Callbacks are called in FIFO order: the order of submission, or with worker threads,
+ * the order in which the workers finished the programs. A program that isn't finished yet holds back
+ * the callbacks of the programs after it.
+ * */
+typedef struct s_gloadProgramBuilder {
+    int         parallel;
+    void        *pending;
+    void        *pending_last;
+    void        *workers;
+
+    /* statistics */
+    GLuint      submitted;
+    GLuint      completed;
+    GLuint      failed;
+}   t_gloadProgramBuilder;
+
+/* `gloadProgramBuilderCreate`:
+ *
+ * Initialize the program builder.
+ * NOTE:
+ *  This function requires a current context and loaded OpenGL functions.
+ *  The shared contexts must not be current on any thread.
+ *  It fails if a worker thread can't make its context current.
+ *
+ * - param: `t_gloadProgramBuilder *builder` - builder to initialize
+ * - param: `GLuint threads` - number of driver compiler threads, 0 for the driver's maximum
+ * - param: `t_gloadMakeCurrent make_current` - procedure binding a shared context (may be null)
+ * - param: `void *const *contexts` - contexts shared with the current one, one per worker thread (may be null)
+ * - param: `GLuint count` - number of shared contexts
+ * - return: `true` on success, `false` on failure.
+ * */
+GLAPI int   gloadProgramBuilderCreate(t_gloadProgramBuilder *, GLuint, t_gloadMakeCurrent, void *const *, GLuint);
+
+/* `gloadProgramBuilderDestroy`:
+ *
+ * Finish every submitted program and stop the worker threads.
+ *
+ * - param: `t_gloadProgramBuilder *builder` - builder to destroy
+ * */
+GLAPI void  gloadProgramBuilderDestroy(t_gloadProgramBuilder *);
+
+/* `gloadProgramBuilderSubmit`:
+ *
+ * Submit a program of `count` shader stages to be compiled and linked.
+ * The sources are copied, so they can be released right after submission.
+ * NOTE:
+ *  Binding locations must be specified in the sources (`layout (location = ...)`).
+ *
+ * - param: `t_gloadProgramBuilder *builder` - builder
+ * - param: `GLsizei count` - number of stages (1 - GLOAD_PROGRAM_BUILDER_MAX_STAGES)
+ * - param: `const GLenum *types` - type of every stage (i.e. `GL_VERTEX_SHADER`)
+ * - param: `const GLchar *const *sources` - null-terminated source of every stage
+ * - param: `t_gloadProgramCallback callback` - procedure called once the program is linked
+ * - param: `void *user` - user pointer passed to the callback
+ * - return: `true` on success, `false` on failure.
+ * */
+GLAPI int   gloadProgramBuilderSubmit(t_gloadProgramBuilder *, GLsizei, const GLenum *, const GLchar *const *, t_gloadProgramCallback, void *);
+
+/* `gloadProgramBuilderPoll`:
+ *
+ * Call the callbacks of every program that finished linking, without blocking.
+ *
+ * - param: `t_gloadProgramBuilder *builder` - builder
+ * - return: number of programs still being built.
+ * */
+GLAPI GLuint    gloadProgramBuilderPoll(t_gloadProgramBuilder *);
+
+/* `gloadProgramBuilderFinish`:
+ *
+ * Block until every submitted program is linked and its callback was called.
+ *
+ * - param: `t_gloadProgramBuilder *builder` - builder
+ * */
+GLAPI void  gloadProgramBuilderFinish(t_gloadProgramBuilder *);
+
+# endif /* GLOAD_PROGRAM_BUILDER */
 #
-#   include <EGL/egl.h>
-#   include <EGL/eglext.h>
-#  endif /* GLOAD_EGL */
+# if defined (GLOAD_TEXTURE_UPLOADER)
+#  if !defined (GLOAD_TEXTURE_UPLOADER_MAX_REQUESTS)
+#   define GLOAD_TEXTURE_UPLOADER_MAX_REQUESTS 256
+#  endif /* GLOAD_TEXTURE_UPLOADER_MAX_REQUESTS */
+
+/* SECTION:
+ *  gload texture uploader API
+ * * * * * * * * * * * * * * */
+
+/* `t_gloadTextureUpload` - destination of a single texture upload.
+ *
+ * 1D uploads use `glTextureSubImage1D` (`target` is GL_TEXTURE_1D, `y`, `height` and `depth` are ignored),
+ * 2D uploads use `glTextureSubImage2D` (`depth` is ignored), 3D and array uploads use
+ * `glTextureSubImage3D` (`depth` > 0 and `target` of a 3D/array texture).
+ * Rows of the source pixels must be tightly packed.
+ * */
+typedef struct s_gloadTextureUpload {
+    GLuint      texture;
+    GLenum      target;
+    GLint       level;
+    GLint       x;
+    GLint       y;
+    GLint       z;
+    GLsizei     width;
+    GLsizei     height;
+    GLsizei     depth;
+    GLenum      format;
+    GLenum      type;
+}   t_gloadTextureUpload;
+
+/* `t_gloadTextureUploader` - ring of pixel-unpack memory shared between the submitting threads
+ * and the rendering thread.
+ *
+ * Every submission gets a ticket: a sequence number, which is complete when the upload has been
+ * executed by the GPU. Requests are issued in submission order once their pixels are copied.
+ * Without persistent mapping (`persistent` is false but `buffer` isn't 0), the ring is unmapped while
+ * `gloadTextureUploaderProcess` issues the uploads, so submissions wait for it.
+ *
+ * Statistics:
+ *  - `bytes`, `uploads` - amount of data and number of uploads issued to OpenGL
+ *  - `stalls` - number of submissions that had to wait for space in the ring
+ * */
+typedef struct s_gloadTextureUploader {
+    GLuint      buffer;
+    GLubyte     *mapping;
+    GLsizeiptr  capacity;
+    int         persistent;
+    int         dsa;
+    void        *state;
+
+    /* statistics */
+    GLuint64    bytes;
+    GLuint64    uploads;
+    GLuint64    stalls;
+}   t_gloadTextureUploader;
+
+/* `gloadTextureUploaderCreate`:
+ *
+ * Create a texture uploader with a ring of `capacity` bytes.
+ * NOTE:
+ *  This function requires a current context and loaded OpenGL functions.
+ *
+ * - param: `t_gloadTextureUploader *uploader` - uploader to initialize
+ * - param: `GLsizeiptr capacity` - size of the ring in bytes; limits the size of a single upload
+ * - return: `true` on success, `false` on failure.
+ * */
+GLAPI int   gloadTextureUploaderCreate(t_gloadTextureUploader *, GLsizeiptr);
+
+/* `gloadTextureUploaderDestroy`:
+ *
+ * Wait for every upload in flight and release the uploader.
+ * Must be called on the rendering thread, after the submitting threads are done.
+ *
+ * - param: `t_gloadTextureUploader *uploader` - uploader to destroy
+ * */
+GLAPI void  gloadTextureUploaderDestroy(t_gloadTextureUploader *);
+
+/* `gloadTextureUploaderSubmit`:
+ *
+ * Copy `size` bytes of `pixels` into the ring and queue an upload into `upload->texture`.
+ * Can be called from any thread. Doesn't call into OpenGL.
+ *
+ * - param: `t_gloadTextureUploader *uploader` - uploader
+ * - param: `const t_gloadTextureUpload *upload` - destination of the upload
+ * - param: `const void *pixels` - tightly packed source pixels
+ * - param: `GLsizeiptr size` - size of the source pixels in bytes
+ * - param: `int wait` - if the ring is full: `true` to wait for space, `false` to fail
+ *   (never wait on the rendering thread, since it's the one freeing the space)
+ * - return: ticket of the upload on success, 0 on failure.
+ * */
+GLAPI GLuint64  gloadTextureUploaderSubmit(t_gloadTextureUploader *, const t_gloadTextureUpload *, const void *, GLsizeiptr, int);
+
+/* `gloadTextureUploaderProcess`:
+ *
+ * Issue the copied uploads and retire the ones the GPU has finished.
+ * Must be called on the rendering thread, i.e. once per frame.
+ * NOTE:
+ *  The texture bindings are restored, but the unpack pixel-store state (`GL_UNPACK_ALIGNMENT`,
+ *  `GL_UNPACK_ROW_LENGTH`, `GL_UNPACK_SKIP_*`, ...) is left at its defaults and
+ *  `GL_PIXEL_UNPACK_BUFFER` is unbound.
+ *
+ * - param: `t_gloadTextureUploader *uploader` - uploader
+ * */
+GLAPI void  gloadTextureUploaderProcess(t_gloadTextureUploader *);
+
+/* `gloadTextureUploaderIsComplete`:
+ *
+ * Check whether an upload has been executed by the GPU. Can be called from any thread.
+ *
+ * - param: `t_gloadTextureUploader *uploader` - uploader
+ * - param: `GLuint64 ticket` - ticket returned from `gloadTextureUploaderSubmit`
+ * - return: `true` if the upload is complete, `false` otherwise.
+ * */
+GLAPI int   gloadTextureUploaderIsComplete(t_gloadTextureUploader *, GLuint64);
+
+# endif /* GLOAD_TEXTURE_UPLOADER */
 #
-#  if defined (GLOAD_WGL)
-#   if defined (GLOAD_DLSYM)
-#    error "Multiple backends selected: GLOAD_WGL and GLOAD_DLSYM."
-#   endif /* GLOAD_DLSYM */
-#   if defined (GLOAD_GLX)
-#    error "Multiple backends selected: GLOAD_WGL and GLOAD_GLX."
-#   endif /* GLOAD_EGL */
-#   if defined (GLOAD_WGL)
-#    error "Multiple backends selected: GLOAD_WGL and GLOAD_WGL."
-#   endif /* GLOAD_WGL */
+# if defined (GLOAD_READBACK)
+#  if !defined (GLOAD_READBACK_MAX_BUFFERS)
+#   define GLOAD_READBACK_MAX_BUFFERS 4
+#  endif /* GLOAD_READBACK_MAX_BUFFERS */
+
+/* SECTION:
+ *  gload readback API
+ * * * * * * * * * * */
+
+/* `t_gloadReadback` - ring of pixel-pack buffers.
+ *
+ * Reads are queued with `gloadReadbackRead` and handed back in the same order with `gloadReadbackMap`.
+ * With `count` buffers, up to `count` reads can be in flight, i.e. 2 for double and 3 for triple buffering.
+ *
+ * Statistics:
+ *  - `bytes`, `reads` - amount of data and number of reads mapped back
+ *  - `waits` - number of `gloadReadbackMap` calls that had to wait for the GPU
+ *  - `drops` - number of `gloadReadbackRead` calls rejected because every buffer was in flight
+ *  - `failures` - number of reads lost because waiting for their fence failed
+ * */
+typedef struct s_gloadReadback {
+    GLuint      buffers[GLOAD_READBACK_MAX_BUFFERS];
+    GLsync      fences[GLOAD_READBACK_MAX_BUFFERS];
+    GLsizeiptr  sizes[GLOAD_READBACK_MAX_BUFFERS];
+    GLsizeiptr  capacity;
+    GLuint      count;
+    GLuint      head;
+    GLuint      tail;
+    GLuint      pending;
+    GLubyte     *memory;
+    int         mapped;
+
+    /* statistics */
+    GLuint64    bytes;
+    GLuint64    reads;
+    GLuint64    waits;
+    GLuint64    drops;
+    GLuint64    failures;
+}   t_gloadReadback;
+
+/* `gloadReadbackCreate`:
+ *
+ * Create a readback ring of `count` buffers, `capacity` bytes each.
+ * NOTE:
+ *  This function requires a current context and loaded OpenGL functions.
+ *
+ * - param: `t_gloadReadback *readback` - readback ring to initialize
+ * - param: `GLsizeiptr capacity` - size of a single buffer in bytes; limits the size of a single read
+ * - param: `GLuint count` - number of buffers (1 - GLOAD_READBACK_MAX_BUFFERS)
+ * - return: `true` on success, `false` on failure.
+ * */
+GLAPI int   gloadReadbackCreate(t_gloadReadback *, GLsizeiptr, GLuint);
+
+/* `gloadReadbackDestroy`:
+ *
+ * Delete every buffer and pending fence of the readback ring.
+ *
+ * - param: `t_gloadReadback *readback` - readback ring to destroy
+ * */
+GLAPI void  gloadReadbackDestroy(t_gloadReadback *);
+
+/* `gloadReadbackRead`:
+ *
+ * Queue a read of a rectangle of the current read framebuffer (`glReadBuffer`).
+ * Rows of the result are tightly packed.
+ * NOTE:
+ *  The pack pixel-store state (`GL_PACK_ALIGNMENT`, `GL_PACK_ROW_LENGTH`, `GL_PACK_SKIP_*`)
+ *  is left at its defaults.
+ *
+ * - param: `t_gloadReadback *readback` - readback ring
+ * - param: `GLint x`, `GLint y`, `GLsizei width`, `GLsizei height` - rectangle to read
+ * - param: `GLenum format`, `GLenum type` - format of the result, as in `glReadPixels`
+ * - return: `true` on success, `false` if every buffer is in flight, the read doesn't fit or its fence can't be created.
+ * */
+GLAPI int   gloadReadbackRead(t_gloadReadback *, GLint, GLint, GLsizei, GLsizei, GLenum, GLenum);
+
+/* `gloadReadbackMap`:
+ *
+ * Map the result of the oldest read in flight.
+ * The pointer stays valid until `gloadReadbackUnmap`.
+ *
+ * - param: `t_gloadReadback *readback` - readback ring
+ * - param: `int wait` - `true` to wait for the GPU, `false` to return null if the read hasn't finished yet
+ * - param: `GLsizeiptr *size` - size of the result in bytes (can be null)
+ * - return: pointer to the result on success, null if nothing is ready or the read failed.
+ *   A failed read is removed from the ring and counted in `failures`.
+ * */
+GLAPI const void    *gloadReadbackMap(t_gloadReadback *, int, GLsizeiptr *);
+
+/* `gloadReadbackUnmap`:
+ *
+ * Release the result returned from `gloadReadbackMap`, making its buffer available for another read.
+ *
+ * - param: `t_gloadReadback *readback` - readback ring
+ * */
+GLAPI void  gloadReadbackUnmap(t_gloadReadback *);
+
+# endif /* GLOAD_READBACK */
 #
-#   include <wingdi.h>
-#  endif /* GLOAD_WGL */
+# if defined (GLOAD_PIPELINE_STATE)
+
+/* SECTION:
+ *  gload pipeline state API
+ * * * * * * * * * * * * * */
+
+/* `GLOAD_PIPELINE_*` - bits of `t_gloadPipelineDesc.flags`.
+ * */
+#  define GLOAD_PIPELINE_BLEND          0x0001
+#  define GLOAD_PIPELINE_DEPTH_TEST     0x0002
+#  define GLOAD_PIPELINE_DEPTH_WRITE    0x0004
+#  define GLOAD_PIPELINE_STENCIL_TEST   0x0008
+#  define GLOAD_PIPELINE_CULL_FACE      0x0010
+#  define GLOAD_PIPELINE_POLYGON_OFFSET 0x0020
+#  define GLOAD_PIPELINE_SCISSOR_TEST   0x0040
+#  define GLOAD_PIPELINE_WRITE_RED      0x0100
+#  define GLOAD_PIPELINE_WRITE_GREEN    0x0200
+#  define GLOAD_PIPELINE_WRITE_BLUE     0x0400
+#  define GLOAD_PIPELINE_WRITE_ALPHA    0x0800
+#  define GLOAD_PIPELINE_WRITE_COLOR    0x0F00
+
+/* `t_gloadPipelineDesc` - description of a pipeline state.
+ *
+ * Parameters of a disabled test are ignored, i.e. `depth_func` without `GLOAD_PIPELINE_DEPTH_TEST`,
+ * and so is a viewport with `viewport[2]` (width) of 0.
+ * Use `gloadPipelineStateDefaults` to initialize the description with the OpenGL defaults.
+ * */
+typedef struct s_gloadPipelineDesc {
+    GLbitfield  flags;
+
+    /* blend */
+    GLenum      blend_src_rgb;
+    GLenum      blend_dst_rgb;
+    GLenum      blend_src_alpha;
+    GLenum      blend_dst_alpha;
+    GLenum      blend_op_rgb;
+    GLenum      blend_op_alpha;
+    GLfloat     blend_color[4];
+
+    /* depth/stencil */
+    GLenum      depth_func;
+    GLenum      stencil_func;
+    GLint       stencil_ref;
+    GLuint      stencil_read_mask;
+    GLuint      stencil_write_mask;
+    GLenum      stencil_fail;
+    GLenum      stencil_depth_fail;
+    GLenum      stencil_pass;
+
+    /* rasterizer */
+    GLenum      cull_face;
+    GLenum      front_face;
+    GLenum      polygon_mode;
+    GLfloat     polygon_offset_factor;
+    GLfloat     polygon_offset_units;
+
+    /* viewport */
+    GLint       viewport[4];
+    GLint       scissor[4];
+
+    /* program */
+    GLuint      program;
+}   t_gloadPipelineDesc;
+
+/* `t_gloadPipelineState` - immutable pipeline state, created with `gloadPipelineStateCreate`.
+ * Pipeline states with equal descriptions have equal hashes.
+ * */
+typedef struct s_gloadPipelineState {
+    t_gloadPipelineDesc desc;
+    GLuint64            hash;
+}   t_gloadPipelineState;
+
+/* `gloadPipelineStateDefaults`:
+ *
+ * Initialize a pipeline description with the default state of OpenGL.
+ *
+ * - param: `t_gloadPipelineDesc *desc` - description to initialize
+ * */
+GLAPI void  gloadPipelineStateDefaults(t_gloadPipelineDesc *);
+
+/* `gloadPipelineStateCreate`:
+ *
+ * Create an immutable pipeline state from a description.
+ *
+ * - param: `t_gloadPipelineState *state` - pipeline state to initialize
+ * - param: `const t_gloadPipelineDesc *desc` - description of the state
+ * - return: `true` on success, `false` on failure.
+ * */
+GLAPI int   gloadPipelineStateCreate(t_gloadPipelineState *, const t_gloadPipelineDesc *);
+
+/* `gloadPipelineStateBind`:
+ *
+ * Apply a pipeline state, emitting only the calls for the state that differs from the bound one.
+ * NOTE:
+ *  The first bind after `gloadPipelineStateInvalidate` applies the whole state.
+ *  On OpenGLES polygon modes are ignored, since `GL_FILL` is the only one.
+ *
+ * - param: `const t_gloadPipelineState *state` - pipeline state to bind
+ * - return: number of OpenGL calls emitted.
+ * */
+GLAPI GLuint    gloadPipelineStateBind(const t_gloadPipelineState *);
+
+/* `gloadPipelineStateInvalidate`:
+ *
+ * Forget the bound pipeline state, i.e. after switching contexts or changing the state with raw OpenGL calls.
+ * */
+GLAPI void  gloadPipelineStateInvalidate(void);
+
+# endif /* GLOAD_PIPELINE_STATE */
 #
-#  if defined (GLOAD_VERBOSE)
-#   define GLOAD_VERBOSE_INFO 1
-#   define GLOAD_VERBOSE_WARN 1
-#   define GLOAD_VERBOSE_ERROR 1
-#  endif /* GLOAD_VERBOSE */
+# if defined (GLOAD_DRAW_QUEUE)
+#  if !defined (GLOAD_DRAW_QUEUE_MAX_TEXTURES)
+#   define GLOAD_DRAW_QUEUE_MAX_TEXTURES 4
+#  endif /* GLOAD_DRAW_QUEUE_MAX_TEXTURES */
+
+/* SECTION:
+ *  gload draw queue API
+ * * * * * * * * * * * */
+
+struct s_gloadDrawCommand;
+
+/* `t_gloadDrawCallback` - called right before a draw is issued, i.e. to set per-draw uniforms.
+ *
+ * - param: `const struct s_gloadDrawCommand *command` - command being drawn
+ * */
+typedef void (*t_gloadDrawCallback)(const struct s_gloadDrawCommand *);
+
+/* `t_gloadDrawCommand` - single indexed draw.
+ *
+ * `textures` are bound to units 0 - GLOAD_DRAW_QUEUE_MAX_TEXTURES, with `texture_target`.
+ * `base_instance` can index per-draw data through an instanced vertex attribute (or `gl_BaseInstance`);
+ * it's ignored without OpenGL 4.2 (GL_ARB_base_instance).
+ * Commands without a `callback` that share program, vertex array, textures, `mode` and `type` are
+ * issued with a single `glMultiDrawElementsIndirect` on OpenGL 4.3 (GL_ARB_multi_draw_indirect).
+ * */
+typedef struct s_gloadDrawCommand {
+    GLuint64            key;
+    GLuint              program;
+    GLuint              vao;
+    GLenum              texture_target;
+    GLuint              textures[GLOAD_DRAW_QUEUE_MAX_TEXTURES];
+    GLenum              mode;
+    GLsizei             count;
+    GLenum              type;
+    GLintptr            offset;
+    GLsizei             instances;
+    GLint               base_vertex;
+    GLuint              base_instance;
+    t_gloadDrawCallback callback;
+    void                *user;
+}   t_gloadDrawCommand;
+
+/* `t_gloadDrawQueue` - commands recorded for the next submission.
+ *
+ * Statistics (accumulated over every submission):
+ *  - `draws` - number of commands issued
+ *  - `multidraws` - number of `glMultiDrawElementsIndirect` calls issued
+ *  - `program_binds`, `vao_binds`, `texture_binds` - number of binds issued
+ *  - `sort_ns` - time spent sorting, in nanoseconds
+ * */
+typedef struct s_gloadDrawQueue {
+    t_gloadDrawCommand  *commands;
+    GLuint              count;
+    GLuint              capacity;
+    void                *scratch;
+    t_gloadStreamBuffer indirect;
+    int                 multidraw;
+    int                 multibind;
+    int                 base_instance;
+
+    /* statistics */
+    GLuint64            draws;
+    GLuint64            multidraws;
+    GLuint64            program_binds;
+    GLuint64            vao_binds;
+    GLuint64            texture_binds;
+    GLuint64            sort_ns;
+}   t_gloadDrawQueue;
+
+/* `gloadDrawQueueKey`:
+ *
+ * Build a sort key, grouping draws by program, then vertex array, then texture set, then depth.
+ * NOTE:
+ *  Program and vertex array names are truncated to 12 bits, the texture set is hashed to 16 bits
+ *  and depth is quantized to 24 bits: equal keys are only a hint of equal state.
+ *
+ * - param: `GLuint program` - program of the draw
+ * - param: `GLuint vao` - vertex array of the draw
+ * - param: `const GLuint *textures` - texture set of the draw (GLOAD_DRAW_QUEUE_MAX_TEXTURES names, can be null)
+ * - param: `GLfloat depth` - view depth of the draw, in range 0.0 - 1.0 (front to back)
+ * - return: sort key.
+ * */
+GLAPI GLuint64  gloadDrawQueueKey(GLuint, GLuint, const GLuint *, GLfloat);
+
+/* `gloadDrawQueueCreate`:
+ *
+ * Create a draw queue.
+ * NOTE:
+ *  This function requires a current context and loaded OpenGL functions.
+ *
+ * - param: `t_gloadDrawQueue *queue` - draw queue to initialize
+ * - param: `GLuint capacity` - initial number of commands; the queue grows as needed, but at most `capacity`
+ *   commands per submission are issued with multi-draws
+ * - return: `true` on success, `false` on failure.
+ * */
+GLAPI int   gloadDrawQueueCreate(t_gloadDrawQueue *, GLuint);
+
+/* `gloadDrawQueueDestroy`:
+ *
+ * Release the draw queue.
+ *
+ * - param: `t_gloadDrawQueue *queue` - draw queue to destroy
+ * */
+GLAPI void  gloadDrawQueueDestroy(t_gloadDrawQueue *);
+
+/* `gloadDrawQueuePush`:
+ *
+ * Record a draw command. Doesn't call into OpenGL.
+ *
+ * - param: `t_gloadDrawQueue *queue` - draw queue
+ * - param: `const t_gloadDrawCommand *command` - command to record (copied)
+ * - return: `true` on success, `false` on failure.
+ * */
+GLAPI int   gloadDrawQueuePush(t_gloadDrawQueue *, const t_gloadDrawCommand *);
+
+/* `gloadDrawQueueSubmit`:
+ *
+ * Sort the recorded commands by their keys, issue them and empty the queue.
+ * Commands with equal keys keep the order they were recorded in.
+ * NOTE:
+ *  Program, vertex array and texture bindings are left as set by the last command.
+ *
+ * - param: `t_gloadDrawQueue *queue` - draw queue
+ * */
+GLAPI void  gloadDrawQueueSubmit(t_gloadDrawQueue *);
+
+# endif /* GLOAD_DRAW_QUEUE */
 #
-#  if defined (__cplusplus)
+# if defined (GLOAD_VERTEX_ARRAY_CACHE)
+#  if !defined (GLOAD_VERTEX_LAYOUT_MAX_ATTRIBS)
+#   define GLOAD_VERTEX_LAYOUT_MAX_ATTRIBS 16
+#  endif /* GLOAD_VERTEX_LAYOUT_MAX_ATTRIBS */
+#  if !defined (GLOAD_VERTEX_LAYOUT_MAX_BINDINGS)
+#   define GLOAD_VERTEX_LAYOUT_MAX_BINDINGS 8
+#  endif /* GLOAD_VERTEX_LAYOUT_MAX_BINDINGS */
+#  define GLOAD_VERTEX_LAYOUT_KEY_SIZE (2 + GLOAD_VERTEX_LAYOUT_MAX_ATTRIBS * 7 + GLOAD_VERTEX_LAYOUT_MAX_BINDINGS * 2)
+
+/* SECTION:
+ *  gload vertex array cache API
+ * * * * * * * * * * * * * * * */
+
+/* `t_gloadVertexAttrib` - format of a single vertex attribute.
+ *
+ * `integer` selects the format call: 0 for `glVertexArrayAttribFormat`, 1 for `glVertexArrayAttribIFormat`
+ * and 2 for `glVertexArrayAttribLFormat`.
+ * */
+typedef struct s_gloadVertexAttrib {
+    GLuint      location;
+    GLint       size;
+    GLenum      type;
+    GLboolean   normalized;
+    GLuint      integer;
+    GLuint      binding;
+    GLuint      offset;
+}   t_gloadVertexAttrib;
+
+/* `t_gloadVertexLayout` - vertex layout: attributes and the strides and divisors of their buffer bindings.
+ * Order of the attributes doesn't matter.
+ * */
+typedef struct s_gloadVertexLayout {
+    GLuint              attrib_count;
+    t_gloadVertexAttrib attribs[GLOAD_VERTEX_LAYOUT_MAX_ATTRIBS];
+    GLuint              binding_count;
+    GLsizei             strides[GLOAD_VERTEX_LAYOUT_MAX_BINDINGS];
+    GLuint              divisors[GLOAD_VERTEX_LAYOUT_MAX_BINDINGS];
+}   t_gloadVertexLayout;
+
+/* `t_gloadVertexArray` - cached vertex array of a layout, owned by its `t_gloadVertexArrayCache`.
+ * Pointers returned from `gloadVertexArrayCacheGet` stay valid until the cache is destroyed.
+ *
+ * `vao` is the name of the vertex array, `key` the canonical form of the layout (attributes sorted by location,
+ * unused fields zeroed), and the buffers are the ones currently attached to the vertex array.
+ * */
+typedef struct s_gloadVertexArray {
+    GLuint      vao;
+    GLuint64    hash;
+    GLuint      key[GLOAD_VERTEX_LAYOUT_KEY_SIZE];
+    GLuint      buffers[GLOAD_VERTEX_LAYOUT_MAX_BINDINGS];
+    GLintptr    offsets[GLOAD_VERTEX_LAYOUT_MAX_BINDINGS];
+    GLuint      index_buffer;
+}   t_gloadVertexArray;
+
+/* `t_gloadVertexArrayCache` - vertex array objects of a single context, keyed by layout.
+ * NOTE:
+ *  Vertex array objects aren't shared between contexts; use one cache per context.
+ *
+ * Statistics:
+ *  - `hits`, `misses` - number of lookups that found / created a vertex array
+ *  - `buffer_binds` - number of vertex and index buffer binding calls issued
+ * */
+typedef struct s_gloadVertexArrayCache {
+    void        *index;
+    GLuint      capacity;
+    GLuint      count;
+    int         dsa;
+    int         multibind;
+    GLuint      bound;
+
+    /* statistics */
+    GLuint64    hits;
+    GLuint64    misses;
+    GLuint64    buffer_binds;
+}   t_gloadVertexArrayCache;
+
+/* `gloadVertexArrayCacheCreate`:
+ *
+ * Create an empty vertex array cache for the current context.
+ * NOTE:
+ *  This function requires a current context and loaded OpenGL functions.
+ *
+ * - param: `t_gloadVertexArrayCache *cache` - cache to initialize
+ * - return: `true` on success, `false` if the context supports neither OpenGL 4.3 nor GL_ARB_vertex_attrib_binding.
+ * */
+GLAPI int   gloadVertexArrayCacheCreate(t_gloadVertexArrayCache *);
+
+/* `gloadVertexArrayCacheDestroy`:
+ *
+ * Delete every cached vertex array and release the cache.
+ *
+ * - param: `t_gloadVertexArrayCache *cache` - cache to destroy
+ * */
+GLAPI void  gloadVertexArrayCacheDestroy(t_gloadVertexArrayCache *);
+
+/* `gloadVertexArrayCacheGet`:
+ *
+ * Find the vertex array of a layout, creating and setting it up on the first use.
+ * Look the layout up once, i.e. when loading a mesh, and keep the result for `gloadVertexArrayCacheBind`.
+ *
+ * - param: `t_gloadVertexArrayCache *cache` - cache
+ * - param: `const t_gloadVertexLayout *layout` - vertex layout
+ * - return: vertex array on success, null on failure.
+ * */
+GLAPI t_gloadVertexArray  *gloadVertexArrayCacheGet(t_gloadVertexArrayCache *, const t_gloadVertexLayout *);
+
+/* `gloadVertexArrayCacheBind`:
+ *
+ * Bind a vertex array returned from `gloadVertexArrayCacheGet` along with its vertex and index buffers.
+ * Buffers already attached to the vertex array aren't bound again.
+ * NOTE:
+ *  With a vertex array bound by other means in between, call with a null `array` to reset the binding tracked by the cache.
+ *
+ * - param: `t_gloadVertexArrayCache *cache` - cache
+ * - param: `t_gloadVertexArray *array` - vertex array of the layout
+ * - param: `const GLuint *buffers` - vertex buffer of every binding (one name per binding of the layout)
+ * - param: `const GLintptr *offsets` - offset into every vertex buffer (can be null for all zeroes)
+ * - param: `GLuint index_buffer` - index buffer, 0 for none
+ * - return: name of the bound vertex array on success, 0 on failure.
+ * */
+GLAPI GLuint    gloadVertexArrayCacheBind(t_gloadVertexArrayCache *, t_gloadVertexArray *, const GLuint *, const GLintptr *, GLuint);
+
+# endif /* GLOAD_VERTEX_ARRAY_CACHE */
+#
+# if defined (GLOAD_PROGRAM_REFLECTION)
+
+/* SECTION:
+ *  gload program reflection API
+ * * * * * * * * * * * * * * * */
+
+/* `t_gloadProgramResource` - single reflected resource.
+ *
+ * `kind` is one of `GL_UNIFORM`, `GL_UNIFORM_BLOCK`, `GL_SHADER_STORAGE_BLOCK` and `GL_PROGRAM_INPUT`.
+ * `location` is the uniform or attribute location, or the index of the block.
+ * `binding` and `data_size` are only set for blocks.
+ * Arrays can be found by both "name" and "name[0]".
+ * */
+typedef struct s_gloadProgramResource {
+    GLuint64    handle;
+    const char  *name;
+    GLenum      kind;
+    GLenum      type;
+    GLint       size;
+    GLint       location;
+    GLint       binding;
+    GLint       data_size;
+}   t_gloadProgramResource;
+
+/* `t_gloadProgramReflection` - resources of a program, in a perfect hash table:
+ * a lookup reads the displacement of its bucket, then a single slot.
+ * */
+typedef struct s_gloadProgramReflection {
+    GLuint                  program;
+    t_gloadProgramResource  *resources;
+    GLuint                  count;
+    GLuint                  *table;
+    GLuint                  mask;
+    GLuint                  *displace;
+    GLuint                  buckets;
+    char                    *names;
+}   t_gloadProgramReflection;
+
+/* `gloadProgramReflectionHash`:
+ *
+ * Compute the handle of a resource name (64-bit FNV-1a).
+ * NOTE:
+ *  In C++11 and newer, `gloadProgramReflectionHashConst` computes the same handle at compile time.
+ *
+ * - param: `const char *name` - name of the resource
+ * - return: handle of the name.
+ * */
+GLAPI GLuint64  gloadProgramReflectionHash(const char *);
+
+#  if defined (__cplusplus) && __cplusplus >= 201103L
+static constexpr GLuint64   gloadProgramReflectionHashConst(const char *name, GLuint64 hash = 0xcbf29ce484222325ull) {
+    return (*name ? gloadProgramReflectionHashConst(name + 1, (hash ^ (GLubyte) *name) * 0x100000001b3ull) : hash);
+}
+#  endif /* __cplusplus */
+
+/* `gloadProgramReflectionCreate`:
+ *
+ * Reflect the resources of a linked program.
+ * NOTE:
+ *  This function requires a current context and loaded OpenGL functions.
+ *
+ * - param: `t_gloadProgramReflection *reflection` - reflection to initialize
+ * - param: `GLuint program` - linked program
+ * - return: `true` on success, `false` on failure.
+ * */
+GLAPI int   gloadProgramReflectionCreate(t_gloadProgramReflection *, GLuint);
+
+/* `gloadProgramReflectionDestroy`:
+ *
+ * Release the reflection. The program itself is left untouched.
+ *
+ * - param: `t_gloadProgramReflection *reflection` - reflection to destroy
+ * */
+GLAPI void  gloadProgramReflectionDestroy(t_gloadProgramReflection *);
+
+/* `gloadProgramReflectionFind`:
+ *
+ * Find a resource by its handle.
+ *
+ * - param: `const t_gloadProgramReflection *reflection` - reflection
+ * - param: `GLenum kind` - kind of the resource (i.e. `GL_UNIFORM`)
+ * - param: `GLuint64 handle` - handle of the name, from `gloadProgramReflectionHash`
+ * - return: the resource on success, null if the program has no such resource.
+ * */
+GLAPI const t_gloadProgramResource  *gloadProgramReflectionFind(const t_gloadProgramReflection *, GLenum, GLuint64);
+
+/* `gloadProgramReflectionLocation`:
+ *
+ * Find the location of a uniform by its handle, to use with `glProgramUniform*` or `glUniform*`.
+ *
+ * - param: `const t_gloadProgramReflection *reflection` - reflection
+ * - param: `GLuint64 handle` - handle of the name, from `gloadProgramReflectionHash`
+ * - return: location of the uniform, -1 if the program has no such uniform.
+ * */
+GLAPI GLint gloadProgramReflectionLocation(const t_gloadProgramReflection *, GLuint64);
+
+# endif /* GLOAD_PROGRAM_REFLECTION */
+#
+# if defined (GLOAD_OBJECT_CACHE)
+#  if !defined (GLOAD_OBJECT_CACHE_SAMPLERS)
+#   define GLOAD_OBJECT_CACHE_SAMPLERS 64
+#  endif /* GLOAD_OBJECT_CACHE_SAMPLERS */
+#  if !defined (GLOAD_OBJECT_CACHE_FRAMEBUFFERS)
+#   define GLOAD_OBJECT_CACHE_FRAMEBUFFERS 32
+#  endif /* GLOAD_OBJECT_CACHE_FRAMEBUFFERS */
+#  if !defined (GLOAD_OBJECT_CACHE_MAX_COLOR_ATTACHMENTS)
+#   define GLOAD_OBJECT_CACHE_MAX_COLOR_ATTACHMENTS 4
+#  endif /* GLOAD_OBJECT_CACHE_MAX_COLOR_ATTACHMENTS */
+
+/* SECTION:
+ *  gload object cache API
+ * * * * * * * * * * * * */
+
+/* `t_gloadSamplerDesc` - parameters of a sampler object.
+ * Use `gloadSamplerDefaults` to initialize the description with the OpenGL defaults.
+ * `max_anisotropy` is ignored without OpenGL 4.6 or GL_EXT_texture_filter_anisotropic.
+ * */
+typedef struct s_gloadSamplerDesc {
+    GLenum      min_filter;
+    GLenum      mag_filter;
+    GLenum      wrap_s;
+    GLenum      wrap_t;
+    GLenum      wrap_r;
+    GLfloat     min_lod;
+    GLfloat     max_lod;
+    GLfloat     lod_bias;
+    GLfloat     max_anisotropy;
+    GLenum      compare_mode;
+    GLenum      compare_func;
+    GLfloat     border_color[4];
+}   t_gloadSamplerDesc;
+
+/* `t_gloadFramebufferDesc` - texture attachments of a framebuffer object.
+ *
+ * Unused color attachments are 0. A `layer` of -1 attaches the whole level (`glFramebufferTexture`),
+ * any other value a single layer (`glFramebufferTextureLayer`).
+ * `depth_attachment` is `GL_DEPTH_ATTACHMENT`, `GL_STENCIL_ATTACHMENT` or `GL_DEPTH_STENCIL_ATTACHMENT`.
+ * */
+typedef struct s_gloadFramebufferDesc {
+    GLuint      colors[GLOAD_OBJECT_CACHE_MAX_COLOR_ATTACHMENTS];
+    GLint       color_levels[GLOAD_OBJECT_CACHE_MAX_COLOR_ATTACHMENTS];
+    GLint       color_layers[GLOAD_OBJECT_CACHE_MAX_COLOR_ATTACHMENTS];
+    GLuint      depth;
+    GLint       depth_level;
+    GLint       depth_layer;
+    GLenum      depth_attachment;
+}   t_gloadFramebufferDesc;
+
+/* `t_gloadObjectCacheStats` - statistics of the object caches.
+ * */
+typedef struct s_gloadObjectCacheStats {
+    GLuint64    sampler_hits;
+    GLuint64    sampler_misses;
+    GLuint64    framebuffer_hits;
+    GLuint64    framebuffer_misses;
+    GLuint64    evictions;
+    GLuint64    invalidations;
+}   t_gloadObjectCacheStats;
+
+/* `gloadObjectCacheInit`:
+ *
+ * Initialize the object caches and start tracking `glDeleteTextures`.
+ * NOTE:
+ *  This function requires a current context and loaded OpenGL functions (OpenGL 3.3 or GL_ARB_sampler_objects).
+ *
+ * - return: `true` on success, `false` on failure.
+ * */
+GLAPI int   gloadObjectCacheInit(void);
+
+/* `gloadObjectCacheTerminate`:
+ *
+ * Delete every cached object and stop tracking `glDeleteTextures`.
+ * */
+GLAPI void  gloadObjectCacheTerminate(void);
+
+/* `gloadObjectCacheNextFrame`:
+ *
+ * Start a new frame: objects returned before this call may be evicted by the next lookups.
+ * Objects are only evicted when the cache is full, so names can be kept across frames as long as they're looked up again.
+ * */
+GLAPI void  gloadObjectCacheNextFrame(void);
+
+/* `gloadObjectCacheGetStats`:
+ *
+ * - param: `t_gloadObjectCacheStats *stats` - statistics of the object caches
+ * */
+GLAPI void  gloadObjectCacheGetStats(t_gloadObjectCacheStats *);
+
+/* `gloadSamplerDefaults`:
+ *
+ * Initialize a sampler description with the default state of OpenGL.
+ *
+ * - param: `t_gloadSamplerDesc *desc` - description to initialize
+ * */
+GLAPI void  gloadSamplerDefaults(t_gloadSamplerDesc *);
+
+/* `gloadSamplerCacheGet`:
+ *
+ * Find the sampler object of a description, creating it on the first use.
+ * The sampler is owned by the cache; don't delete it. It stays valid until the next `gloadObjectCacheNextFrame`.
+ *
+ * - param: `const t_gloadSamplerDesc *desc` - sampler description
+ * - return: name of the sampler on success, 0 on failure or if every sampler of the cache is used in this frame.
+ * */
+GLAPI GLuint    gloadSamplerCacheGet(const t_gloadSamplerDesc *);
+
+/* `gloadFramebufferCacheGet`:
+ *
+ * Find the framebuffer object of a set of attachments, creating it on the first use.
+ * The framebuffer is owned by the cache; don't delete it. It stays valid until the next `gloadObjectCacheNextFrame`,
+ * or until one of its textures is deleted.
+ *
+ * - param: `const t_gloadFramebufferDesc *desc` - framebuffer attachments
+ * - return: name of the framebuffer on success, 0 on failure, if the attachments aren't framebuffer-complete
+ *           or if every framebuffer of the cache is used in this frame.
+ * */
+GLAPI GLuint    gloadFramebufferCacheGet(const t_gloadFramebufferDesc *);
+
+# endif /* GLOAD_OBJECT_CACHE */
+#
+# if defined (GLOAD_BINDLESS)
+
+/* SECTION:
+ *  gload bindless texture API
+ * * * * * * * * * * * * * * */
+
+/* `t_gloadBindlessTexture` - single entry of a bindless table.
+ * Free entries have `texture` 0; `frame` is the last frame the entry was used in.
+ * */
+typedef struct s_gloadBindlessTexture {
+    GLuint64    handle;
+    GLuint64    frame;
+    GLuint      texture;
+    GLuint      sampler;
+    GLuint      resident;
+}   t_gloadBindlessTexture;
+
+/* `t_gloadBindless` - table of bindless texture handles.
+ *
+ * Shaders read the handles from the shader storage buffer `buffer` (a copy of `handles`), indexed by slot,
+ * i.e. `layout(std430, binding = 0) readonly buffer Textures { sampler2D textures[]; };`.
+ * */
+typedef struct s_gloadBindless {
+    GLuint                  buffer;
+    t_gloadBindlessTexture  *textures;
+    GLuint64                *handles;
+    GLuint                  capacity;
+    GLuint                  count;
+    GLuint                  budget;
+    GLuint                  resident;
+    GLuint64                frame;
+    GLuint                  dirty_begin;
+    GLuint                  dirty_end;
+    int                     dsa;
+
+    /* statistics */
+    GLuint64                residencies;
+    GLuint64                evictions;
+    GLuint64                uploads;
+}   t_gloadBindless;
+
+/* `gloadBindlessCreate`:
+ *
+ * Create a table of `capacity` handles, with at most `budget` of them resident at once.
+ * NOTE:
+ *  This function requires a current context, loaded OpenGL functions, GL_ARB_bindless_texture
+ *  and shader storage buffers (OpenGL 4.3 or GL_ARB_shader_storage_buffer_object).
+ *
+ * - param: `t_gloadBindless *bindless` - table to initialize
+ * - param: `GLuint capacity` - number of slots
+ * - param: `GLuint budget` - maximum number of resident handles, 0 for `capacity`
+ * - return: `true` on success, `false` on failure.
+ * */
+GLAPI int   gloadBindlessCreate(t_gloadBindless *, GLuint, GLuint);
+
+/* `gloadBindlessDestroy`:
+ *
+ * Make every handle non-resident and release the table. The textures themselves are left untouched.
+ *
+ * - param: `t_gloadBindless *bindless` - table to destroy
+ * */
+GLAPI void  gloadBindlessDestroy(t_gloadBindless *);
+
+/* `gloadBindlessAdd`:
+ *
+ * Get the handle of a texture (with a sampler, if not 0) and store it in a free slot.
+ * The handle isn't resident until the slot is used.
+ *
+ * - param: `t_gloadBindless *bindless` - table
+ * - param: `GLuint texture` - texture
+ * - param: `GLuint sampler` - sampler, or 0 for the sampling state of the texture
+ * - return: slot of the texture on success, -1 on failure.
+ * */
+GLAPI GLint gloadBindlessAdd(t_gloadBindless *, GLuint, GLuint);
+
+/* `gloadBindlessRemove`:
+ *
+ * Make the handle of a slot non-resident and free the slot.
+ * NOTE:
+ *  Remove textures from the table before deleting them.
+ *
+ * - param: `t_gloadBindless *bindless` - table
+ * - param: `GLint slot` - slot to free
+ * */
+GLAPI void  gloadBindlessRemove(t_gloadBindless *, GLint);
+
+/* `gloadBindlessUse`:
+ *
+ * Add a slot to the working set of the current frame, making its handle resident if needed.
+ * Above the budget, handles not used during the current frame are made non-resident, least recently used first.
+ *
+ * - param: `t_gloadBindless *bindless` - table
+ * - param: `GLint slot` - slot used by the next draws
+ * - return: `true` on success, `false` on failure.
+ * */
+GLAPI int   gloadBindlessUse(t_gloadBindless *, GLint);
+
+/* `gloadBindlessTrim`:
+ *
+ * Make handles non-resident, least recently used first, until at most `resident` remain.
+ * Handles used during the current frame are kept; call this when the application detects memory pressure.
+ *
+ * - param: `t_gloadBindless *bindless` - table
+ * - param: `GLuint resident` - number of handles to keep resident
+ * - return: number of handles made non-resident.
+ * */
+GLAPI GLuint    gloadBindlessTrim(t_gloadBindless *, GLuint);
+
+/* `gloadBindlessBeginFrame`:
+ *
+ * Start a new frame: the working set is empty again.
+ *
+ * - param: `t_gloadBindless *bindless` - table
+ * */
+GLAPI void  gloadBindlessBeginFrame(t_gloadBindless *);
+
+/* `gloadBindlessBind`:
+ *
+ * Upload the handles changed since the last call and bind the table to a shader storage buffer binding point.
+ *
+ * - param: `t_gloadBindless *bindless` - table
+ * - param: `GLuint binding` - index of the binding point
+ * */
+GLAPI void  gloadBindlessBind(t_gloadBindless *, GLuint);
+
+# endif /* GLOAD_BINDLESS */
+#
+# if defined (GLOAD_DELETION_QUEUE)
+#  if !defined (GLOAD_DELETION_QUEUE_FRAMES)
+#   define GLOAD_DELETION_QUEUE_FRAMES 3
+#  endif /* GLOAD_DELETION_QUEUE_FRAMES */
+#  if !defined (GLOAD_DELETION_QUEUE_POOL)
+#   define GLOAD_DELETION_QUEUE_POOL 64
+#  endif /* GLOAD_DELETION_QUEUE_POOL */
+
+/* SECTION:
+ *  gload deletion queue API
+ * * * * * * * * * * * * * */
+
+/* `t_gloadDeletionQueue` - objects waiting for the GPU to be done with them.
+ *
+ * Objects queued during a frame are released once the fence of `gloadDeletionQueueEndFrame` has signalled.
+ *
+ * Statistics:
+ *  - `deleted`, `batches` - number of deleted objects and of `glDelete*` calls issued for them
+ *  - `recycled`, `allocated` - number of buffers taken from the pool and created by `gloadDeletionQueueAcquireBuffer`
+ *  - `stalls` - number of `gloadDeletionQueueEndFrame` calls that had to wait for the GPU
+ * */
+typedef struct s_gloadDeletionQueue {
+    void        *pending;
+    GLuint      count;
+    GLuint      capacity;
+    GLuint      *scratch;
+    void        *pool;
+    GLuint      pool_count;
+    GLsync      fences[GLOAD_DELETION_QUEUE_FRAMES];
+    GLuint64    frame;
+    GLuint64    completed;
+    int         storage;
+    int         dsa;
+
+    /* statistics */
+    GLuint64    deleted;
+    GLuint64    batches;
+    GLuint64    recycled;
+    GLuint64    allocated;
+    GLuint64    stalls;
+}   t_gloadDeletionQueue;
+
+/* `gloadDeletionQueueCreate`:
+ *
+ * Create an empty deletion queue.
+ * NOTE:
+ *  This function requires a current context and loaded OpenGL functions (OpenGL 3.2 or GL_ARB_sync).
+ *
+ * - param: `t_gloadDeletionQueue *queue` - queue to initialize
+ * - return: `true` on success, `false` on failure.
+ * */
+GLAPI int   gloadDeletionQueueCreate(t_gloadDeletionQueue *);
+
+/* `gloadDeletionQueueDestroy`:
+ *
+ * Wait for the GPU, then delete every queued and pooled object and release the queue.
+ *
+ * - param: `t_gloadDeletionQueue *queue` - queue to destroy
+ * */
+GLAPI void  gloadDeletionQueueDestroy(t_gloadDeletionQueue *);
+
+/* `gloadDeletionQueueDelete`:
+ *
+ * Queue objects for deletion at the end of the current frame.
+ *
+ * - param: `t_gloadDeletionQueue *queue` - queue
+ * - param: `GLenum kind` - type of the objects: `GL_BUFFER`, `GL_TEXTURE`, `GL_FRAMEBUFFER`, `GL_RENDERBUFFER`,
+ *          `GL_VERTEX_ARRAY`, `GL_SAMPLER` or `GL_QUERY`
+ * - param: `GLsizei n` - number of objects
+ * - param: `const GLuint *names` - names of the objects
+ * - return: `true` on success, `false` on failure.
+ * */
+GLAPI int   gloadDeletionQueueDelete(t_gloadDeletionQueue *, GLenum, GLsizei, const GLuint *);
+
+/* `gloadDeletionQueueRetireBuffer`:
+ *
+ * Queue a buffer created by `gloadDeletionQueueAcquireBuffer` to be recycled at the end of the current frame.
+ *
+ * - param: `t_gloadDeletionQueue *queue` - queue
+ * - param: `GLuint buffer` - buffer to retire
+ * - param: `GLsizeiptr size` - size of the buffer
+ * - param: `GLbitfield flags` - storage flags of the buffer
+ * - return: `true` on success, `false` on failure.
+ * */
+GLAPI int   gloadDeletionQueueRetireBuffer(t_gloadDeletionQueue *, GLuint, GLsizeiptr, GLbitfield);
+
+/* `gloadDeletionQueueAcquireBuffer`:
+ *
+ * Take a recycled buffer of the same size and flags, or create a new one.
+ * Without OpenGL 4.4 or GL_ARB_buffer_storage, buffers are mutable and `flags` only selects the usage hint.
+ *
+ * - param: `t_gloadDeletionQueue *queue` - queue
+ * - param: `GLsizeiptr size` - size of the buffer
+ * - param: `GLbitfield flags` - storage flags (`glBufferStorage`)
+ * - return: name of the buffer on success, 0 on failure.
+ * */
+GLAPI GLuint    gloadDeletionQueueAcquireBuffer(t_gloadDeletionQueue *, GLsizeiptr, GLbitfield);
+
+/* `gloadDeletionQueueEndFrame`:
+ *
+ * Insert the fence of the current frame and release the objects of completed frames.
+ * Waits for the oldest frame if more than GLOAD_DELETION_QUEUE_FRAMES are in flight.
+ *
+ * - param: `t_gloadDeletionQueue *queue` - queue
+ * */
+GLAPI void  gloadDeletionQueueEndFrame(t_gloadDeletionQueue *);
+
+/* `gloadDeletionQueueProcess`:
+ *
+ * Release the objects of completed frames, without waiting.
+ *
+ * - param: `t_gloadDeletionQueue *queue` - queue
+ * - return: number of objects still queued.
+ * */
+GLAPI GLuint    gloadDeletionQueueProcess(t_gloadDeletionQueue *);
+
+# endif /* GLOAD_DELETION_QUEUE */
+#
+# if defined (GLOAD_BUFFER_ALLOCATOR)
+
+/* SECTION:
+ *  gload buffer allocator API
+ * * * * * * * * * * * * * * */
+
+/* `t_gloadBufferAllocation` - range of the buffer of an allocator.
+ * `handle` identifies the allocation; its `offset` can change with `gloadBufferAllocatorDefragment`.
+ * Handles carry a generation, so a handle of a released allocation stays invalid after its block is reused.
+ * */
+typedef struct s_gloadBufferAllocation {
+    GLintptr    offset;
+    GLsizeiptr  size;
+    GLuint64    handle;
+}   t_gloadBufferAllocation;
+
+/* `t_gloadBufferAllocatorStats` - usage of an allocator.
+ * `fragmentation` is the part of the free space outside of the largest free block, from 0 to 1.
+ * */
+typedef struct s_gloadBufferAllocatorStats {
+    GLuint64    used;
+    GLuint64    free;
+    GLuint64    largest_free;
+    GLuint      allocations;
+    GLuint      free_blocks;
+    GLfloat     fragmentation;
+}   t_gloadBufferAllocatorStats;
+
+/* `t_gloadBufferAllocator` - offset allocator over a single buffer.
+ *
+ * Sizes are counted in units of `alignment` bytes, which keeps every offset aligned for `target`.
+ * Free blocks are kept in 256 size classes (5-bit exponent, 3-bit mantissa) with a two-level bitmap,
+ * so both allocation and release run in constant time.
+ * */
+typedef struct s_gloadBufferAllocator {
+    GLuint      buffer;
+    GLenum      target;
+    GLbitfield  flags;
+    GLsizeiptr  size;
+    GLuint      alignment;
+    GLuint      units;
+    void        *nodes;
+    GLuint      *generations;
+    GLuint      *free_nodes;
+    GLuint      free_count;
+    GLuint      capacity;
+    GLuint      max_allocations;
+    GLuint      bins[256];
+    GLubyte     bin_masks[32];
+    GLuint      bin_mask;
+    GLuint      used_units;
+    GLuint      allocations;
+    int         dsa;
+
+    /* statistics */
+    GLuint64    failures;
+    GLuint64    moves;
+}   t_gloadBufferAllocator;
+
+/* `gloadBufferAllocatorCreate`:
+ *
+ * Create an allocator over a new buffer of `size` bytes.
+ * Allocations are aligned to `GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT` for `GL_UNIFORM_BUFFER`,
+ * `GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT` for `GL_SHADER_STORAGE_BUFFER`, and 16 bytes otherwise.
+ * NOTE:
+ *  This function requires a current context and loaded OpenGL functions.
+ *  Without OpenGL 4.4 or GL_ARB_buffer_storage, the buffer is mutable and `flags` is ignored.
+ *
+ * - param: `t_gloadBufferAllocator *allocator` - allocator to initialize
+ * - param: `GLenum target` - main binding target of the buffer
+ * - param: `GLsizeiptr size` - size of the buffer in bytes
+ * - param: `GLbitfield flags` - storage flags of the buffer (`glBufferStorage`)
+ * - param: `GLuint max_allocations` - maximum number of live allocations
+ * - return: `true` on success, `false` on failure.
+ * */
+GLAPI int   gloadBufferAllocatorCreate(t_gloadBufferAllocator *, GLenum, GLsizeiptr, GLbitfield, GLuint);
+
+/* `gloadBufferAllocatorDestroy`:
+ *
+ * Delete the buffer and release the allocator.
+ *
+ * - param: `t_gloadBufferAllocator *allocator` - allocator to destroy
+ * */
+GLAPI void  gloadBufferAllocatorDestroy(t_gloadBufferAllocator *);
+
+/* `gloadBufferAllocatorAllocate`:
+ *
+ * Allocate a range of the buffer.
+ *
+ * - param: `t_gloadBufferAllocator *allocator` - allocator
+ * - param: `GLsizeiptr size` - size of the range in bytes
+ * - param: `t_gloadBufferAllocation *allocation` - allocated range
+ * - return: `true` on success, `false` if no free block is large enough or `max_allocations` are already live.
+ * */
+GLAPI int   gloadBufferAllocatorAllocate(t_gloadBufferAllocator *, GLsizeiptr, t_gloadBufferAllocation *);
+
+/* `gloadBufferAllocatorFree`:
+ *
+ * Release a range, merging it with its free neighbours.
+ *
+ * - param: `t_gloadBufferAllocator *allocator` - allocator
+ * - param: `const t_gloadBufferAllocation *allocation` - range to release
+ * */
+GLAPI void  gloadBufferAllocatorFree(t_gloadBufferAllocator *, const t_gloadBufferAllocation *);
+
+/* `gloadBufferAllocatorOffset`:
+ *
+ * - param: `const t_gloadBufferAllocator *allocator` - allocator
+ * - param: `GLuint64 handle` - handle of an allocation
+ * - return: current offset of the allocation in bytes, -1 if the handle is invalid or the allocation was released.
+ * */
+GLAPI GLintptr  gloadBufferAllocatorOffset(const t_gloadBufferAllocator *, GLuint64);
+
+/* `gloadBufferAllocatorDefragment`:
+ *
+ * Move every allocation to the front of a new buffer, in order, leaving a single free block at the end.
+ * The name of the buffer changes: bind it again and read the new offsets with `gloadBufferAllocatorOffset`.
+ * NOTE:
+ *  The copies are queued on the GPU; the old buffer is deleted after them.
+ *
+ * - param: `t_gloadBufferAllocator *allocator` - allocator
+ * - return: `true` on success, `false` on failure (the allocator is left untouched).
+ * */
+GLAPI int   gloadBufferAllocatorDefragment(t_gloadBufferAllocator *);
+
+/* `gloadBufferAllocatorGetStats`:
+ *
+ * - param: `const t_gloadBufferAllocator *allocator` - allocator
+ * - param: `t_gloadBufferAllocatorStats *stats` - usage of the allocator
+ * */
+GLAPI void  gloadBufferAllocatorGetStats(const t_gloadBufferAllocator *, t_gloadBufferAllocatorStats *);
+
+# endif /* GLOAD_BUFFER_ALLOCATOR */
+#
+# if defined (GLOAD_RENDER_GRAPH)
+
+/* SECTION:
+ *  gload render graph API
+ * * * * * * * * * * * * */
+
+/* `GLOAD_RENDER_GRAPH_*` - flags of passes and attachments.
+ *
+ * - `GLOAD_RENDER_GRAPH_BY_REGION` (pass): the pass only reads from fragment shaders what fragment shaders of previous
+ *   passes wrote at the same location of the framebuffer; allows `glMemoryBarrierByRegion`
+ * - `GLOAD_RENDER_GRAPH_KEEP` (attachment): the contents are used after the execution (i.e. presented, or read
+ *   by the next frame) and must be stored even if no later pass reads them
+ * - `GLOAD_RENDER_GRAPH_CLEAR` (attachment): the pass clears or entirely overwrites the attachment;
+ *   its previous contents are invalidated before the pass
+ * */
+#  define GLOAD_RENDER_GRAPH_BY_REGION 0x1
+#  define GLOAD_RENDER_GRAPH_KEEP 0x2
+#  define GLOAD_RENDER_GRAPH_CLEAR 0x4
+
+/* `t_gloadRenderGraphAccess` - use of a resource by a pass.
+ *
+ * `kind` is `GL_BUFFER` or `GL_TEXTURE`. `read` holds the barrier bits matching the way the pass reads the resource
+ * (i.e. `GL_TEXTURE_FETCH_BARRIER_BIT` for sampling, `GL_COMMAND_BARRIER_BIT` for indirect arguments),
+ * `write` the bits of its incoherent writes: `GL_SHADER_IMAGE_ACCESS_BARRIER_BIT`, `GL_SHADER_STORAGE_BARRIER_BIT`
+ * or `GL_ATOMIC_COUNTER_BARRIER_BIT`. Other writes (rendering, `glBufferSubData`, ...) are ordered by OpenGL itself.
+ * */
+typedef struct s_gloadRenderGraphAccess {
+    GLenum      kind;
+    GLuint      name;
+    GLbitfield  read;
+    GLbitfield  write;
+}   t_gloadRenderGraphAccess;
+
+/* `t_gloadRenderGraphAttachment` - attachment of the framebuffer a pass renders to.
+ *
+ * `attachment` is the attachment point (i.e. `GL_COLOR_ATTACHMENT0`, or `GL_DEPTH` for the default framebuffer),
+ * `kind` and `name` the attached `GL_TEXTURE` or `GL_RENDERBUFFER` (0 for the default framebuffer).
+ * Without a `GLOAD_RENDER_GRAPH_KEEP` flag, the attachment is transient: it is only stored for the later passes
+ * of the same execution that read it, or render to it without `GLOAD_RENDER_GRAPH_CLEAR`.
+ * */
+typedef struct s_gloadRenderGraphAttachment {
+    GLenum      attachment;
+    GLenum      kind;
+    GLuint      name;
+    GLbitfield  flags;
+}   t_gloadRenderGraphAttachment;
+
+/* `t_gloadRenderGraphCallback` - records the commands of a pass.
+ * */
+typedef void    (*t_gloadRenderGraphCallback)(void *);
+
+/* `t_gloadRenderGraph` - passes of a frame, with the state of the resources they share across frames.
+ *
+ * Statistics:
+ *  - `executed` - number of executed passes
+ *  - `barriers`, `region_barriers` - number of `glMemoryBarrier` and `glMemoryBarrierByRegion` calls
+ *  - `gpu_time` - GPU time of the last measured `gloadRenderGraphExecute`, in nanoseconds
+ *  - `invalidations`, `invalidated_bytes` - number of invalidations issued, and size of the attachments
+ *    invalidated at the end of their pass, whose store was skipped
+ * */
+typedef struct s_gloadRenderGraph {
+    void        *passes;
+    GLuint      pass_count;
+    GLuint      pass_capacity;
+    t_gloadRenderGraphAccess    *accesses;
+    GLuint      access_count;
+    GLuint      access_capacity;
+    t_gloadRenderGraphAttachment    *attachments;
+    GLuint      attachment_count;
+    GLuint      attachment_capacity;
+    void        *resources;
+    GLuint      resource_count;
+    GLuint      resource_capacity;
+    GLuint64    sequence;
+    GLuint64    issued[32];
+    GLuint64    issued_region[32];
+    GLuint      query;
+    int         query_pending;
+    int         barrier;
+    int         by_region;
+    int         invalidate;
+    int         dsa;
+
+    /* statistics */
+    GLuint64    executed;
+    GLuint64    barriers;
+    GLuint64    region_barriers;
+    GLuint64    gpu_time;
+    GLuint64    invalidations;
+    GLuint64    invalidated_bytes;
+}   t_gloadRenderGraph;
+
+/* `gloadRenderGraphCreate`:
+ *
+ * Create an empty render graph.
+ * NOTE:
+ *  This function requires a current context and loaded OpenGL functions.
+ *  Barriers require OpenGL 4.2 or GL_ARB_shader_image_load_store; invalidation OpenGL 4.3, OpenGL ES 3.0,
+ *  GL_ARB_invalidate_subdata or GL_EXT_discard_framebuffer. Without either, the graph only runs the passes.
+ *
+ * - param: `t_gloadRenderGraph *graph` - graph to initialize
+ * - param: `int timing` - measure the GPU time of `gloadRenderGraphExecute` with a `GL_TIME_ELAPSED` query
+ * - return: `true` on success, `false` on failure.
+ * */
+GLAPI int   gloadRenderGraphCreate(t_gloadRenderGraph *, int);
+
+/* `gloadRenderGraphDestroy`:
+ *
+ * Release the graph.
+ *
+ * - param: `t_gloadRenderGraph *graph` - graph to destroy
+ * */
+GLAPI void  gloadRenderGraphDestroy(t_gloadRenderGraph *);
+
+/* `gloadRenderGraphAddPass`:
+ *
+ * Append a pass to the graph. The accesses are copied.
+ *
+ * - param: `t_gloadRenderGraph *graph` - graph
+ * - param: `t_gloadRenderGraphCallback callback` - records the commands of the pass
+ * - param: `void *user` - parameter of the callback
+ * - param: `const t_gloadRenderGraphAccess *accesses` - resources used by the pass
+ * - param: `GLuint count` - number of accesses
+ * - param: `GLbitfield flags` - `GLOAD_RENDER_GRAPH_*` flags
+ * - return: `true` on success, `false` on failure.
+ * */
+GLAPI int   gloadRenderGraphAddPass(t_gloadRenderGraph *, t_gloadRenderGraphCallback, void *, const t_gloadRenderGraphAccess *, GLuint, GLbitfield);
+
+/* `gloadRenderGraphSetTarget`:
+ *
+ * Set the framebuffer the last added pass renders to. The attachments are copied.
+ * The framebuffer is bound before the callback of the pass, which must leave it bound.
+ *
+ * - param: `t_gloadRenderGraph *graph` - graph
+ * - param: `GLuint framebuffer` - framebuffer of the pass
+ * - param: `const t_gloadRenderGraphAttachment *attachments` - attachments of the framebuffer
+ * - param: `GLuint count` - number of attachments
+ * - return: `true` on success, `false` on failure.
+ * */
+GLAPI int   gloadRenderGraphSetTarget(t_gloadRenderGraph *, GLuint, const t_gloadRenderGraphAttachment *, GLuint);
+
+/* `gloadRenderGraphExecute`:
+ *
+ * Run the passes in order, each preceded by the barrier bits its reads and writes need, merged in a single call,
+ * then empty the graph. Writes not yet made visible carry over to the passes of the next execution.
+ * Cleared attachments are invalidated before their pass, and transient attachments no later pass reads after it.
+ *
+ * - param: `t_gloadRenderGraph *graph` - graph
+ * - return: number of barriers issued.
+ * */
+GLAPI GLuint    gloadRenderGraphExecute(t_gloadRenderGraph *);
+
+# endif /* GLOAD_RENDER_GRAPH */
+#
+# if defined (GLOAD_CONTEXT_POOL)
+
+/* SECTION:
+ *  gload context pool API
+ * * * * * * * * * * * * * */
+
+/* `t_gloadContextJob` - procedure run by a worker thread, with its hidden context current.
+ *
+ * - param: `void *user` - user pointer passed to `gloadContextPoolSubmit`
+ * */
+typedef void    (*t_gloadContextJob)(void *);
+
+/* `t_gloadContextBackend` - user procedures managing the hidden contexts, for backends gload can't create them with.
+ *
+ * - `create` - create a context shared with the current one (called on the thread creating the pool), null on failure
+ * - `make_current` - make a context current on the calling thread, null to release the current one; `true` on success
+ * - `destroy` - destroy a context created by `create` (called on the thread destroying the pool, may be null)
+ * - `user` - user pointer passed as the last parameter of every procedure
+ * */
+typedef struct s_gloadContextBackend {
+    void    *(*create)(void *);
+    int     (*make_current)(void *, void *);
+    void    (*destroy)(void *, void *);
+    void    *user;
+}   t_gloadContextBackend;
+
+/* `t_gloadContextPool` - worker threads running jobs on hidden shared contexts.
+ *
+ * Every job is followed by a fence flushed from its worker's context. Polling the pool makes the
+ * calling context wait on the fences of the finished jobs with `glWaitSync`, without blocking the CPU,
+ * then calls their completion procedures: the objects the jobs created can be used from then on.
+ * Without workers, jobs run on the submitting thread.
+ * */
+typedef struct s_gloadContextPool {
+    void        *pending;
+    void        *workers;
+
+    /* statistics */
+    GLuint      submitted;
+    GLuint      completed;
+    GLuint      inlined;
+}   t_gloadContextPool;
+
+/* `gloadContextPoolCreate`:
+ *
+ * Create `count` hidden contexts shared with the current one and start a worker thread for each of them.
+ * NOTE:
+ *  This function requires a current context and loaded OpenGL functions.
+ *  Objects created by the jobs must be bound again in the rendering context to see their contents.
+ *  It fails if a worker thread can't make its context current.
+ *
+ * - param: `t_gloadContextPool *pool` - pool to initialize
+ * - param: `GLuint count` - number of worker threads
+ * - param: `const t_gloadContextBackend *backend` - procedures managing the contexts (null for EGL or GLX)
+ * - return: `true` on success, `false` on failure.
+ * */
+GLAPI int   gloadContextPoolCreate(t_gloadContextPool *, GLuint, const t_gloadContextBackend *);
+
+/* `gloadContextPoolDestroy`:
+ *
+ * Finish every submitted job, stop the worker threads and destroy their contexts.
+ *
+ * - param: `t_gloadContextPool *pool` - pool to destroy
+ * */
+GLAPI void  gloadContextPoolDestroy(t_gloadContextPool *);
+
+/* `gloadContextPoolSubmit`:
+ *
+ * Submit a job to the first idle worker thread.
+ *
+ * - param: `t_gloadContextPool *pool` - pool
+ * - param: `t_gloadContextJob job` - procedure run on a worker thread
+ * - param: `t_gloadContextJob done` - procedure called on the polling thread once the job is handed over (may be null)
+ * - param: `void *user` - user pointer passed to both procedures
+ * - return: `true` on success, `false` on failure.
+ * */
+GLAPI int   gloadContextPoolSubmit(t_gloadContextPool *, t_gloadContextJob, t_gloadContextJob, void *);
+
+/* `gloadContextPoolPoll`:
+ *
+ * Hand the finished jobs over to the current context and call their completion procedures, without blocking.
+ *
+ * - param: `t_gloadContextPool *pool` - pool
+ * - return: number of jobs still running.
+ * */
+GLAPI GLuint    gloadContextPoolPoll(t_gloadContextPool *);
+
+/* `gloadContextPoolFinish`:
+ *
+ * Block until every submitted job is finished and handed over to the current context.
+ *
+ * - param: `t_gloadContextPool *pool` - pool
+ * */
+GLAPI void  gloadContextPoolFinish(t_gloadContextPool *);
+
+# endif /* GLOAD_CONTEXT_POOL */
+#
+# if defined (GLOAD_STALL_DETECTOR)
+#  if !defined (GLOAD_STALL_DETECTOR_MAX_SITES)
+#   define GLOAD_STALL_DETECTOR_MAX_SITES 256
+#  endif /* GLOAD_STALL_DETECTOR_MAX_SITES */
+#  if !defined (GLOAD_STALL_DETECTOR_DEPTH)
+#   define GLOAD_STALL_DETECTOR_DEPTH 1
+#  endif /* GLOAD_STALL_DETECTOR_DEPTH */
+
+/* SECTION:
+ *  gload stall detector API
+ * * * * * * * * * * * * * * */
+
+/* `t_gloadStallSite` - synchronizing calls made from a single call site.
+ *
+ * `callers` holds the return addresses of the call site, innermost first (unused ones are null);
+ * they can be resolved with `addr2line` or a debugger.
+ * */
+typedef struct s_gloadStallSite {
+    const char  *name;
+    void        *callers[GLOAD_STALL_DETECTOR_DEPTH];
+    GLuint64    calls;
+    GLuint64    frames;
+    GLuint64    total_ns;
+    GLuint64    max_ns;
+}   t_gloadStallSite;
+
+/* `t_gloadStallDetectorStats` - statistics of the stall detector.
+ * */
+typedef struct s_gloadStallDetectorStats {
+    GLuint64    frames;
+    GLuint64    stalls;
+    GLuint64    total_ns;
+    GLuint      sites;
+    GLuint64    dropped;
+}   t_gloadStallDetectorStats;
+
+/* `gloadStallDetectorInit`:
+ *
+ * Start hooking the synchronizing procedures. Calls are only timed within frames.
+ * NOTE:
+ *  This function requires loaded OpenGL functions.
+ *
+ * - return: `true` on success, `false` on failure.
+ * */
+GLAPI int   gloadStallDetectorInit(void);
+
+/* `gloadStallDetectorTerminate`:
+ *
+ * Restore the original procedures and discard the recorded call sites.
+ * Hooks another one was installed on top of stay in place, and forward every call untimed.
+ * */
+GLAPI void  gloadStallDetectorTerminate(void);
+
+/* `gloadStallDetectorBeginFrame`:
+ *
+ * Start timing the synchronizing calls, i.e. once the previous frame was submitted.
+ * */
+GLAPI void  gloadStallDetectorBeginFrame(void);
+
+/* `gloadStallDetectorEndFrame`:
+ *
+ * Stop timing the synchronizing calls, i.e. right before swapping buffers.
+ * */
+GLAPI void  gloadStallDetectorEndFrame(void);
+
+/* `gloadStallDetectorGetSites`:
+ *
+ * Copy the recorded call sites that blocked the longest, in decreasing order of total time.
+ *
+ * - param: `t_gloadStallSite *sites` - array receiving the call sites
+ * - param: `GLuint count` - size of `sites`
+ * - return: number of call sites copied.
+ * */
+GLAPI GLuint    gloadStallDetectorGetSites(t_gloadStallSite *, GLuint);
+
+/* `gloadStallDetectorGetStats`:
+ *
+ * - param: `t_gloadStallDetectorStats *stats` - statistics of the stall detector
+ * */
+GLAPI void  gloadStallDetectorGetStats(t_gloadStallDetectorStats *);
+
+/* `gloadStallDetectorReset`:
+ *
+ * Discard the recorded call sites and statistics.
+ * */
+GLAPI void  gloadStallDetectorReset(void);
+
+# endif /* GLOAD_STALL_DETECTOR */
+#
+# if defined (GLOAD_MEMORY_STATS)
+#  if !defined (GLOAD_MEMORY_STATS_MAX_NAMES)
+#   define GLOAD_MEMORY_STATS_MAX_NAMES 65536
+#  endif /* GLOAD_MEMORY_STATS_MAX_NAMES */
+
+/* SECTION:
+ *  gload memory statistics API
+ * * * * * * * * * * * * * * * * */
+
+/* `t_gloadMemStats` - memory held by the buffers, textures and renderbuffers.
+ *
+ * `untracked` counts the allocations of unknown internal formats (estimated at 4 bytes per texel),
+ * of levels above 15 and of names above `GLOAD_MEMORY_STATS_MAX_NAMES`.
+ * The driver counters are in kilobytes, -1 when neither `GL_NVX_gpu_memory_info` nor `GL_ATI_meminfo`
+ * reports them.
+ * */
+typedef struct s_gloadMemStats {
+    GLuint64    buffer_bytes;
+    GLuint64    texture_bytes;
+    GLuint64    renderbuffer_bytes;
+    GLuint64    peak_bytes;
+    GLuint      buffers;
+    GLuint      textures;
+    GLuint      renderbuffers;
+    GLuint      untracked;
+
+    /* driver counters */
+    GLint       total_kb;
+    GLint       available_kb;
+    GLint       evicted_kb;
+    GLint       evictions;
+}   t_gloadMemStats;
+
+/* `gloadMemStatsInit`:
+ *
+ * Start hooking the allocation procedures. Objects allocated before are not accounted.
+ * NOTE:
+ *  This function requires loaded OpenGL functions.
+ *
+ * - return: `true` on success, `false` on failure.
+ * */
+GLAPI int   gloadMemStatsInit(void);
+
+/* `gloadMemStatsTerminate`:
+ *
+ * Restore the original procedures and discard the tracked objects.
+ * Hooks another one was installed on top of stay in place, and forward every call untracked.
+ * */
+GLAPI void  gloadMemStatsTerminate(void);
+
+/* `gloadMemStats`:
+ *
+ * NOTE:
+ *  The driver counters are queried on the current context.
+ *
+ * - param: `t_gloadMemStats *stats` - memory statistics
+ * - return: `true` on success, `false` if the statistics were not initialized.
+ * */
+GLAPI int   gloadMemStats(t_gloadMemStats *);
+
+# endif /* GLOAD_MEMORY_STATS */
+#
+# if defined (GLOAD_TRACE)
+#  if !defined (GLOAD_TRACE_BUFFER_EVENTS)
+#   define GLOAD_TRACE_BUFFER_EVENTS 16384
+#  endif /* GLOAD_TRACE_BUFFER_EVENTS */
+#  if !defined (GLOAD_TRACE_GPU_QUERIES)
+#   define GLOAD_TRACE_GPU_QUERIES 256
+#  endif /* GLOAD_TRACE_GPU_QUERIES */
+#  if (GLOAD_TRACE_BUFFER_EVENTS & (GLOAD_TRACE_BUFFER_EVENTS - 1))
+#   error "GLOAD_TRACE_BUFFER_EVENTS must be a power of two."
+#  endif /* GLOAD_TRACE_BUFFER_EVENTS */
+
+/* SECTION:
+ *  gload trace API
+ * * * * * * * * * * */
+
+/* `t_gloadTraceStats` - statistics of the trace.
+ * */
+typedef struct s_gloadTraceStats {
+    GLuint64    events;
+    GLuint64    dropped;
+    GLuint64    frames;
+    GLuint64    gpu_spans;
+    GLuint      threads;
+}   t_gloadTraceStats;
+
+/* `gloadTraceOpen`:
+ *
+ * Start writing a trace to `path`. GPU spans are recorded when the current context supports timer queries.
+ * NOTE:
+ *  Event names aren't copied: they must stay valid until the trace is closed (i.e. string literals).
+ *
+ * - param: `const char *path` - path of the JSON file to write
+ * - return: `true` on success, `false` on failure.
+ * */
+GLAPI int   gloadTraceOpen(const char *);
+
+/* `gloadTraceClose`:
+ *
+ * Write the remaining events and close the trace, once the traced threads stopped recording.
+ * The GPU spans still in flight are lost.
+ * */
+GLAPI void  gloadTraceClose(void);
+
+/* `gloadTraceThreadName`:
+ *
+ * Name the track of the calling thread.
+ * */
+GLAPI void  gloadTraceThreadName(const char *);
+
+/* `gloadTraceBegin`:
+ *
+ * Open a CPU span on the track of the calling thread. Spans nest and are closed with `gloadTraceEnd`.
+ * */
+GLAPI void  gloadTraceBegin(const char *);
+
+/* `gloadTraceEnd`:
+ *
+ * Close the last CPU span opened by the calling thread.
+ * */
+GLAPI void  gloadTraceEnd(void);
+
+/* `gloadTraceGpuBegin`:
+ *
+ * Open a GPU span on the GPU track. Spans nest and are closed with `gloadTraceGpuEnd`.
+ * NOTE:
+ *  GPU spans must be recorded from the thread owning the context the trace was opened on.
+ * */
+GLAPI void  gloadTraceGpuBegin(const char *);
+
+/* `gloadTraceGpuEnd`:
+ *
+ * Close the last GPU span opened.
+ * */
+GLAPI void  gloadTraceGpuEnd(void);
+
+/* `gloadTraceFrame`:
+ *
+ * Mark the end of a frame: collect the finished GPU spans and wake up the writer thread.
+ * NOTE:
+ *  This function must be called from the thread owning the context the trace was opened on.
+ * */
+GLAPI void  gloadTraceFrame(void);
+
+/* `gloadTraceGetStats`:
+ *
+ * - param: `t_gloadTraceStats *stats` - statistics of the trace
+ * */
+GLAPI void  gloadTraceGetStats(t_gloadTraceStats *);
+
+# endif /* GLOAD_TRACE */
+#
+# if defined (GLOAD_DEBUG_OUTPUT)
+#  if !defined (GLOAD_DEBUG_OUTPUT_MESSAGES)
+#   define GLOAD_DEBUG_OUTPUT_MESSAGES 256
+#  endif /* GLOAD_DEBUG_OUTPUT_MESSAGES */
+#  if !defined (GLOAD_DEBUG_OUTPUT_MAX_IDS)
+#   define GLOAD_DEBUG_OUTPUT_MAX_IDS 1024
+#  endif /* GLOAD_DEBUG_OUTPUT_MAX_IDS */
+#  if !defined (GLOAD_DEBUG_OUTPUT_INTERVAL)
+#   define GLOAD_DEBUG_OUTPUT_INTERVAL 1000
+#  endif /* GLOAD_DEBUG_OUTPUT_INTERVAL */
+#  if !defined (GLOAD_DEBUG_OUTPUT_MESSAGE_LENGTH)
+#   define GLOAD_DEBUG_OUTPUT_MESSAGE_LENGTH 256
+#  endif /* GLOAD_DEBUG_OUTPUT_MESSAGE_LENGTH */
+#  if (GLOAD_DEBUG_OUTPUT_MESSAGES & (GLOAD_DEBUG_OUTPUT_MESSAGES - 1)) || (GLOAD_DEBUG_OUTPUT_MAX_IDS & (GLOAD_DEBUG_OUTPUT_MAX_IDS - 1))
+#   error "GLOAD_DEBUG_OUTPUT_MESSAGES and GLOAD_DEBUG_OUTPUT_MAX_IDS must be powers of two."
+#  endif /* GLOAD_DEBUG_OUTPUT_MESSAGES, GLOAD_DEBUG_OUTPUT_MAX_IDS */
+
+/* SECTION:
+ *  gload debug output API
+ * * * * * * * * * * * * * */
+
+/* `t_gloadDebugMessage` - debug message forwarded from the drain thread.
+ *
+ * `count` is the number of messages of this ID since the previous one forwarded, itself included.
+ * */
+typedef struct s_gloadDebugMessage {
+    GLenum          source;
+    GLenum          type;
+    GLuint          id;
+    GLenum          severity;
+    GLuint          count;
+    const GLchar    *message;
+}   t_gloadDebugMessage;
+
+/* `t_gloadDebugCallback` - receives the forwarded messages, on the drain thread.
+ * */
+typedef void    (*t_gloadDebugCallback)(const t_gloadDebugMessage *, void *);
+
+/* `t_gloadDebugPerformance` - aggregated `GL_DEBUG_TYPE_PERFORMANCE` messages of a single ID.
+ * */
+typedef struct s_gloadDebugPerformance {
+    GLenum  source;
+    GLuint  id;
+    GLenum  severity;
+    GLuint  count;
+    GLchar  message[GLOAD_DEBUG_OUTPUT_MESSAGE_LENGTH];
+}   t_gloadDebugPerformance;
+
+/* `t_gloadDebugOutputStats` - statistics of the debug output.
+ * */
+typedef struct s_gloadDebugOutputStats {
+    GLuint  messages;
+    GLuint  forwarded;
+    GLuint  dropped;
+    GLuint  ids;
+}   t_gloadDebugOutputStats;
+
+/* `gloadDebugOutputInit`:
+ *
+ * Enable the debug output of the current context, asynchronously, and start the drain thread.
+ * NOTE:
+ *  This function requires loaded OpenGL functions. Contexts created without the debug flag may report few messages.
+ *
+ * - param: `t_gloadDebugCallback callback` - receives the messages, null to print them on `stderr`
+ * - param: `void *user` - passed to `callback`
+ * - return: `true` on success, `false` on failure.
+ * */
+GLAPI int   gloadDebugOutputInit(t_gloadDebugCallback, void *);
+
+/* `gloadDebugOutputTerminate`:
+ *
+ * Forward the remaining messages, stop the drain thread and restore the debug output of the current context,
+ * along with the callback it had before `gloadDebugOutputInit`.
+ * */
+GLAPI void  gloadDebugOutputTerminate(void);
+
+/* `gloadDebugOutputDrain`:
+ *
+ * Forward the queued messages now, from the calling thread. It must not be called from the callback.
+ * */
+GLAPI void  gloadDebugOutputDrain(void);
+
+/* `gloadDebugOutputGetPerformance`:
+ *
+ * Copy the performance messages reported the most often, in decreasing order of count.
+ *
+ * - param: `t_gloadDebugPerformance *items` - array receiving the messages
+ * - param: `GLuint count` - size of `items`
+ * - return: number of messages copied.
+ * */
+GLAPI GLuint    gloadDebugOutputGetPerformance(t_gloadDebugPerformance *, GLuint);
+
+/* `gloadDebugOutputGetStats`:
+ *
+ * - param: `t_gloadDebugOutputStats *stats` - statistics of the debug output
+ * */
+GLAPI void  gloadDebugOutputGetStats(t_gloadDebugOutputStats *);
+
+# endif /* GLOAD_DEBUG_OUTPUT */
+#
+# if defined (GLOAD_ENUM_NAMES)
+
+/* SECTION:
+ *  gload enum names API
+ * * * * * * * * * * * * */
+
+/* `gloadEnumName`:
+ *
+ * Name an enum of the core OpenGL, OpenGL ES and OpenGL SC versions. Values shared by several enums (i.e. `GL_ONE`,
+ * `GL_TRUE`, `GL_LINES`) are told apart by the group of the registry (i.e. "BlendingFactor", "Boolean", "PrimitiveType");
+ * aliases of a value within a group (i.e. extension suffixes) are folded into the shortest name.
+ *
+ * - param: `GLenum value` - enum value
+ * - param: `const char *group` - group of the enum, null for any
+ * - return: name of the enum in `group`, or the shortest name of `value` if none; null if `value` is unknown.
+ * */
+GLAPI const char    *gloadEnumName(GLenum, const char *);
+
+/* `gloadEnumValue`:
+ *
+ * Look up an enum of the core OpenGL, OpenGL ES and OpenGL SC versions by name.
+ * Names with a vendor suffix (i.e. `GL_RGBA8_OES`) resolve to the core name when the registry declares them with the
+ * same value; other suffixed names (i.e. `GL_REPLACE_EXT`) are not found.
+ *
+ * - param: `const char *name` - name of the enum (i.e. "GL_RGBA8")
+ * - param: `GLenum *value` - receives the enum value
+ * - return: `true` if `name` was found, `false` otherwise.
+ * */
+GLAPI int   gloadEnumValue(const char *, GLenum *);
+
+# endif /* GLOAD_ENUM_NAMES */
+#
+# if defined (__cplusplus)
+
+}
+
+# endif /* __cplusplus */
+#
+# if defined (GLOAD_IMPLEMENTATION)
+#
+#  if defined (GLOAD_PROGRAM_CACHE)
+#   define GLOAD_INTERNAL_CLOCK 1
+#   define GLOAD_INTERNAL_HASH 1
+#   define GLOAD_INTERNAL_MMAP 1
+#  endif /* GLOAD_PROGRAM_CACHE */
+#
+#  if defined (GLOAD_PROGRAM_BUILDER)
+#   define GLOAD_INTERNAL_COND 1
+#   define GLOAD_INTERNAL_MUTEX 1
+#   define GLOAD_INTERNAL_THREAD 1
+#  endif /* GLOAD_PROGRAM_BUILDER */
+#
+#  if defined (GLOAD_TEXTURE_UPLOADER)
+#   define GLOAD_INTERNAL_COND 1
+#   define GLOAD_INTERNAL_MUTEX 1
+#  endif /* GLOAD_TEXTURE_UPLOADER */
+#
+#  if defined (GLOAD_PIPELINE_STATE)
+#   define GLOAD_INTERNAL_HASH 1
+#  endif /* GLOAD_PIPELINE_STATE */
+#
+#  if defined (GLOAD_DRAW_QUEUE)
+#   define GLOAD_INTERNAL_CLOCK 1
+#  endif /* GLOAD_DRAW_QUEUE */
+#
+#  if defined (GLOAD_VERTEX_ARRAY_CACHE)
+#   define GLOAD_INTERNAL_HASH 1
+#  endif /* GLOAD_VERTEX_ARRAY_CACHE */
+#
+#  if defined (GLOAD_PROGRAM_REFLECTION)
+#   define GLOAD_INTERNAL_HASH 1
+#  endif /* GLOAD_PROGRAM_REFLECTION */
+#
+#  if defined (GLOAD_OBJECT_CACHE)
+#   define GLOAD_INTERNAL_HASH 1
+#  endif /* GLOAD_OBJECT_CACHE */
+#
+#  if defined (GLOAD_CONTEXT_POOL)
+#   define GLOAD_INTERNAL_COND 1
+#   define GLOAD_INTERNAL_MUTEX 1
+#   define GLOAD_INTERNAL_THREAD 1
+#  endif /* GLOAD_CONTEXT_POOL */
+#
+#  if defined (GLOAD_STALL_DETECTOR)
+#   define GLOAD_INTERNAL_CLOCK 1
+#   define GLOAD_INTERNAL_HASH 1
+#   define GLOAD_INTERNAL_MUTEX 1
+#  endif /* GLOAD_STALL_DETECTOR */
+#
+#  if defined (GLOAD_MEMORY_STATS)
+#   define GLOAD_INTERNAL_MUTEX 1
+#   define GLOAD_INTERNAL_THREAD_LOCAL 1
+#  endif /* GLOAD_MEMORY_STATS */
+#
+#  if defined (GLOAD_TRACE)
+#   define GLOAD_INTERNAL_ATOMIC 1
+#   define GLOAD_INTERNAL_CLOCK 1
+#   define GLOAD_INTERNAL_COND 1
+#   define GLOAD_INTERNAL_MUTEX 1
+#   define GLOAD_INTERNAL_THREAD 1
+#   define GLOAD_INTERNAL_THREAD_LOCAL 1
+#  endif /* GLOAD_TRACE */
+#
+#  if defined (GLOAD_DEBUG_OUTPUT)
+#   define GLOAD_INTERNAL_ATOMIC 1
+#   define GLOAD_INTERNAL_ATOMIC_RMW 1
+#   define GLOAD_INTERNAL_CLOCK 1
+#   define GLOAD_INTERNAL_MUTEX 1
+#   define GLOAD_INTERNAL_THREAD 1
+#   define GLOAD_INTERNAL_TIMEDWAIT 1
+#  endif /* GLOAD_DEBUG_OUTPUT */
+#
+#  if defined (GLOAD_USDT) && defined (GLOAD_LINUX)
+#   define GLOAD_INTERNAL_USDT 1
+#  endif /* GLOAD_USDT, GLOAD_LINUX */
+#
+#  if !defined (__cplusplus)
+#   include <stdio.h>
+#   include <stdint.h>
+#   include <stddef.h>
+#   include <stdlib.h>
+#   include <string.h>
+#  else
+#   include <cstdio>
+#   include <cstdint>
+#   include <cstddef>
+#   include <cstdlib>
+#   include <cstring>
+#   include <string>
+#  endif /* __cplusplus */
+#
+#  if defined (GLOAD_LINUX) || defined (GLOAD_APPLE)
+#   include <dlfcn.h>
+#   if defined (GLOAD_INTERNAL_CLOCK)
+#    include <time.h>
+#   endif /* GLOAD_INTERNAL_CLOCK */
+#   if defined (GLOAD_INTERNAL_TIMEDWAIT)
+#    include <sys/time.h>
+#   endif /* GLOAD_INTERNAL_TIMEDWAIT */
+#   if defined (GLOAD_INTERNAL_MUTEX) || defined (GLOAD_INTERNAL_THREAD)
+#    include <pthread.h>
+#   endif /* GLOAD_INTERNAL_MUTEX, GLOAD_INTERNAL_THREAD */
+#   if defined (GLOAD_INTERNAL_MMAP)
+#    include <fcntl.h>
+#    include <unistd.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#   endif /* GLOAD_INTERNAL_MMAP */
+#   if defined (GLOAD_STALL_DETECTOR) && GLOAD_STALL_DETECTOR_DEPTH > 1
+#    include <execinfo.h>
+#   endif /* GLOAD_STALL_DETECTOR */
+#   if defined (GLOAD_INTERNAL_USDT)
+#    include <sys/sdt.h>
+#   endif /* GLOAD_INTERNAL_USDT */
+#  endif /* GLOAD_LINUX, GLOAD_APPLE*/
+#  if defined (GLOAD_WIN32)
+#   include <libloaderapi.h>
+#   if defined (GLOAD_INTERNAL_ATOMIC) || defined (GLOAD_INTERNAL_CLOCK) || defined (GLOAD_INTERNAL_MMAP) || defined (GLOAD_INTERNAL_MUTEX) || defined (GLOAD_INTERNAL_THREAD)
+#    include <windows.h>
+#   endif /* GLOAD_INTERNAL_ATOMIC, GLOAD_INTERNAL_CLOCK, GLOAD_INTERNAL_MMAP, GLOAD_INTERNAL_MUTEX, GLOAD_INTERNAL_THREAD */
+#   if defined (GLOAD_STALL_DETECTOR) && defined (_MSC_VER)
+#    include <intrin.h>
+#   endif /* GLOAD_STALL_DETECTOR */
+#  endif /* GLOAD_WIN32 */
+#
+#  if !defined (GLOAD_DLSYM) && !(defined (GLOAD_GLX) || defined (GLOAD_EGL) || defined (GLOAD_WGL))
+#   define GLOAD_DLSYM 1
+#  endif /* GLOAD_DLSYM, GLOAD_GLX, GLOAD_EGL, GLOAD_WGL */
+#
+#  if defined (GLOAD_DLSYM)
+#   if defined (GLOAD_GLX)
+#    error "Multiple backends selected: GLOAD_DLSYM and GLOAD_GLX."
+#   endif /* GLOAD_GLX */
+#   if defined (GLOAD_EGL)
+#    error "Multiple backends selected: GLOAD_DLSYM and GLOAD_EGL."
+#   endif /* GLOAD_EGL */
+#   if defined (GLOAD_WGL)
+#    error "Multiple backends selected: GLOAD_DLSYM and GLOAD_WGL."
+#   endif /* GLOAD_WGL */
+#  endif /* GLOAD_DLSYM */
+#
+#  if defined (GLOAD_GLX)
+#   if defined (GLOAD_DLSYM)
+#    error "Multiple backends selected: GLOAD_GLX and GLOAD_DLSYM."
+#   endif /* GLOAD_DLSYM */
+#   if defined (GLOAD_EGL)
+#    error "Multiple backends selected: GLOAD_GLX and GLOAD_EGL."
+#   endif /* GLOAD_EGL */
+#   if defined (GLOAD_WGL)
+#    error "Multiple backends selected: GLOAD_GLX and GLOAD_WGL."
+#   endif /* GLOAD_WGL */
+#
+#   include <GL/glx.h>
+#   include <GL/glxext.h>
+#  endif /* GLOAD_GLX */
+#
+#  if defined (GLOAD_EGL)
+#   if defined (GLOAD_DLSYM)
+#    error "Multiple backends selected: GLOAD_EGL and GLOAD_DLSYM."
+#   endif /* GLOAD_DLSYM */
+#   if defined (GLOAD_GLX)
+#    error "Multiple backends selected: GLOAD_EGL and GLOAD_GLX."
+#   endif /* GLOAD_GLX */
+#   if defined (GLOAD_WGL)
+#    error "Multiple backends selected: GLOAD_EGL and GLOAD_WGL."
+#   endif /* GLOAD_WGL */
+#
+#   include <EGL/egl.h>
+#   include <EGL/eglext.h>
+#  endif /* GLOAD_EGL */
+#
+#  if defined (GLOAD_WGL)
+#   if defined (GLOAD_DLSYM)
+#    error "Multiple backends selected: GLOAD_WGL and GLOAD_DLSYM."
+#   endif /* GLOAD_DLSYM */
+#   if defined (GLOAD_GLX)
+#    error "Multiple backends selected: GLOAD_WGL and GLOAD_GLX."
+#   endif /* GLOAD_EGL */
+#   if defined (GLOAD_WGL)
+#    error "Multiple backends selected: GLOAD_WGL and GLOAD_WGL."
+#   endif /* GLOAD_WGL */
+#
+#   include <wingdi.h>
+#  endif /* GLOAD_WGL */
+#
+#  if defined (GLOAD_VERBOSE)
+#   define GLOAD_VERBOSE_INFO 1
+#   define GLOAD_VERBOSE_WARN 1
+#   define GLOAD_VERBOSE_ERROR 1
+#  endif /* GLOAD_VERBOSE */
+#
+#  if defined (GLOAD_INTERNAL_USDT)
+#   define GLOAD_INTERNAL_PROBE(probe, a, b) DTRACE_PROBE2(gload, probe, a, b)
+#  else
+#   define GLOAD_INTERNAL_PROBE(probe, a, b) ((void) 0)
+#  endif /* GLOAD_INTERNAL_USDT */
+#
+#  if defined (__cplusplus)
+
+extern "C" {
+
+#  endif /* __cplusplus */
+    
+/* SECTION:
+ *  Global objects
+ * * * * * * * * * * */
+
+/* `struct s_nameaddr` - key-value-pair structure of proc. names and addresses.
+ * */
+
+struct s_nameaddr {
+
+#  if !defined (__cplusplus)
+    const char          *name;
+#  else
+    const std::string   &name;
+#  endif /* __cplusplus */
+
+    void        **addr;
+};
+
+/* `static struct s_nameaddr g_nameaddr` - array of s_nameaddr structures, null-terminated.
+ * */
+
+static struct s_nameaddr    g_nameaddr[] = {
+    
+/* <<gload-nameaddr>> */
+
+    /* null-terminator */
+    { "", 0 }
+};
+
+/* `static void *g_handle` - handle to shared/dynamic library.
+ * */
+static void *g_handle = 0;
+
+#  if defined (GLOAD_INTERNAL_USDT)
+
+/* `gloadUsdt_install` - swap the loaded procedures with their probing thunks, defined along with them.
+ * */
+static void gloadUsdt_install(void);
+
+#  endif /* GLOAD_INTERNAL_USDT */
+
+/* SECTION:
+ *  gload API
+ * * * * * * * * * * */
+
+/* `gloadLoadGL`:
+ *
+ * Perform a simple OpenGL (v.1.0 - v.4.6) and OpenGLES (v.1.0 - v.3.2) loading process.
+ * 
+ * `gloadLoadGL` auto-detects which backend should be used:
+ * `GLX`, `EGL`, `WGL` or `built-in` (using either `dlopen` or `LoadLibraryA`, depending on the platform).
+ *
+ * - return: `true` on success, `false` on failure.
+ * */
+GLAPI int   gloadLoadGL(void) {
+
+#  if defined (GLOAD_GLX)
+    return (gloadLoadGLLoader((t_gloadLoader) glXGetProcAddress));
+#  endif /* GLOAD_GLX */
+#  if defined (GLOAD_EGL)
+    return (gloadLoadGLLoader((t_gloadLoader) eglGetProcAddress));
+#  endif /* GLOAD_EGL */
+#  if defined (GLOAD_WGL)
+    return (gloadLoadGLLoader((t_gloadLoader) wglGetProcAddress));
+#  endif /* GLOAD_WGL */
+#  if defined (GLOAD_DLSYM)
+    return (gloadLoadGLLoader((t_gloadLoader) gloadGetProcAddress));
+#  endif /* GLOAD_DLSYM */
+
+}
+
+/* `gloadLoadGL`:
+ *
+ * Unload OpenGL functions and dispose dynamic/shared object handle.
+ * This function will execute anything if `gloadGetProcAddress` was used at least once;
+ * for other backends (i.e. `GLX`, `EGL`, `WGL` and more) this function will simply return.
+ *
+ * - returns: `true` on success, `false` on failure.
+ * */
+GLAPI int   gloadUnloadGL(void) {
+    if (g_handle) {
+
+#  if defined (GLOAD_LINUX) || defined (GLOAD_APPLE)
+        dlclose(g_handle), g_handle = 0;
+#  endif /* GLOAD_LINUX, GLOAD_APPLE */
+#  if defined (GLOAD_WIN32)
+        FreeLibrary(g_handle), g_handle = 0;
+#  endif /* GLOAD_WIN32 */
+
+    }
+
+    return (1);
+}
+
+/* `gloadLoadGLLoader`:
+ *
+ * Perform a simple OpenGL (v.1.0 - v.4.6) and OpenGLES (v.1.0 - v.3.2) loading process.
+ * 
+ * gloadLoadGLLoader expects a pointer to a `*GetProcAddress` function.
+ * Most, if not all opengl-oriented libraries support the propper version of `*GetProcAddress`
+ * and gload.h provides a built-in solution: `gloadGetProcAddress`.
+ *
+ * - param: `t_gloadLoader load` - pointer to a loader function
+ * - return: `true` on success, `false` on failure.
+ * */
+GLAPI int   gloadLoadGLLoader(t_gloadLoader load) {
+    if (!load) { return (0); }
+
+    GLOAD_INTERNAL_PROBE(load_begin, sizeof(g_nameaddr) / sizeof(g_nameaddr[0]) - 1, (uintptr_t) load);
+    for (size_t i = 0; g_nameaddr[i].addr; i++) {
+        /* If the function is already loaded, skip it... */
+        if (*g_nameaddr[i].addr) { continue; }
+
+#  if !defined (__cplusplus)
+        *g_nameaddr[i].addr = load(g_nameaddr[i].name);
+#  else
+        *g_nameaddr[i].addr = load(g_nameaddr[i].name.c_str());
+#  endif /* __cplusplus */
+
+        if (!*g_nameaddr[i].addr) {
+            GLOAD_INTERNAL_PROBE(load_end, 0, i);
+            return (0);
+        }
+    }
+
+#  if defined (GLOAD_INTERNAL_USDT)
+    gloadUsdt_install();
+#  endif /* GLOAD_INTERNAL_USDT */
+
+    GLOAD_INTERNAL_PROBE(load_end, 1, sizeof(g_nameaddr) / sizeof(g_nameaddr[0]) - 1);
+    return (1);
+}
+
+/* `gloadGetProcAddress`:
+ *
+ * Retrieve the address of the OpenGL symbol from dynamic/shared object.
+ * Uses `dlopen` and `dlsym` for GNU/Linux and MacOS platform.
+ * Uses `LoadLibraryA` and `GetProcAddress` for Win32 platform.
+ *
+ * - param: `const char *name` - name of the symbol
+ * - return: address of the symbol on success, null on failure
+ * */
+GLAPI void  *gloadGetProcAddress(const char *name) {
+    void        *proc;
+    const char  *names[] = {
+
+#  if defined (GLOAD_LINUX)
+        "libGL.so",
+        "libGL.so.1",
+        "libGL.so.1.7.0",
+        0
+#  endif /* GLOAD_LINUX */
+#  if defined (GLOAD_APPLE)
+        "../Frameworks/OpenGL.framework/OpenGL",
+        "/Library/Frameworks/OpenGL.framework/OpenGL",
+        "/System/Library/Frameworks/OpenGL.framework/OpenGL",
+        "/System/Library/Frameworks/OpenGL.framework/Versions/Current/OpenGL"
+        0
+#  endif /* GLOAD_APPLE */
+#  if defined (GLOAD_WIN32)
+        "opengl32.dll",
+        0
+#  endif /* GLOAD_WIN32 */
+
+    };
+    
+    if (!g_handle) {
+        for (size_t i = 0; !g_handle && names[i]; i++) {
+
+#  if defined (GLOAD_LINUX) || defined (GLOAD_APPLE)
+            g_handle = dlopen(names[i], RTLD_NOW | RTLD_GLOBAL);
+#  endif /* GLOAD_LINUX, GLOAD_APPLE */
+#  if defined (GLOAD_WIN32)
+            g_handle = LoadLibraryA(names[i]);
+#  endif /* GLOAD_WIN32 */
+
+            GLOAD_INTERNAL_PROBE(library_open, names[i], g_handle);
+
+        }
+
+        if (!g_handle) {
+
+#  if defined (GLOAD_VERBOSE_ERROR)
+            fprintf(stderr, "gload.h: could not load an OpenGL handle.\n");
+#  endif /* GLOAD_VERBOSE_ERROR */
+
+            return (0);
+
+        }
+    }
+
+#  if defined (GLOAD_LINUX) || defined (GLOAD_APPLE)
+    proc = dlsym(g_handle, name);
+#  endif /* GLOAD_LINUX, GLOAD_APPLE */
+#  if defined (GLOAD_WIN32)
+    proc = GetProcAddress(g_handle, name);
+#  endif /* GLOAD_WIN32 */
+
+    if (!proc) {
+
+#  if defined (GLOAD_VERBOSE_ERROR)
+            fprintf(stderr, "gload.h: could not load a procedure: %s\n", name);
+#  endif /* GLOAD_VERBOSE_ERROR */
+    
+            return (0);
+    }
+    return (proc);
+}
+
+/* `gloadIsExtensionSupported`:
+ *
+ * Check if the current OpenGL context exposes an extension.
+ * Uses `glGetStringi` on OpenGL 3.0+ contexts and `glGetString(GL_EXTENSIONS)` otherwise.
+ * NOTE:
+ *  This function requires a current context and loaded OpenGL functions.
+ *
+ * - param: `const char *name` - name of the extension (i.e. "GL_ARB_buffer_storage")
+ * - return: `true` if the extension is supported, `false` otherwise.
+ * */
+GLAPI int   gloadIsExtensionSupported(const char *name) {
+    const char  *exts;
+    size_t      len;
+
+    if (!name || !glGetString) { return (0); }
+    len = strlen(name);
+
+    if (glGetStringi && gloadIsVersionSupported(3, 0)) {
+        GLint   count;
+
+        count = 0;
+        glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+        for (GLint i = 0; i < count; i++) {
+            exts = (const char *) glGetStringi(GL_EXTENSIONS, (GLuint) i);
+            if (exts && !strcmp(exts, name)) { return (1); }
+        }
+        return (0);
+    }
+
+    exts = (const char *) glGetString(GL_EXTENSIONS);
+    while (exts && *exts) {
+        if (!strncmp(exts, name, len) && (exts[len] == ' ' || exts[len] == '\0')) { return (1); }
+        exts = strchr(exts, ' ');
+        if (exts) { exts++; }
+    }
+    return (0);
+}
+
+/* `gloadIsVersionSupported`:
+ *
+ * Check if the version of the current OpenGL (or OpenGLES) context is at least `major`.`minor`.
+ * NOTE:
+ *  This function requires a current context and loaded OpenGL functions.
+ *
+ * - param: `int major` - major version number
+ * - param: `int minor` - minor version number
+ * - return: `true` if the context version is greater or equal, `false` otherwise.
+ * */
+GLAPI int   gloadIsVersionSupported(int major, int minor) {
+    const char  *version;
+    int         ctx_major;
+    int         ctx_minor;
+
+    if (!glGetString) { return (0); }
+    version = (const char *) glGetString(GL_VERSION);
+    if (!version) { return (0); }
+
+    /* OpenGLES prefixes the version string, i.e. "OpenGL ES 3.2 ..." */
+    while (*version && (*version < '0' || *version > '9')) { version++; }
+
+    ctx_major = ctx_minor = 0;
+    while (*version >= '0' && *version <= '9') { ctx_major = ctx_major * 10 + (*version++ - '0'); }
+    if (*version == '.') { version++; }
+    while (*version >= '0' && *version <= '9') { ctx_minor = ctx_minor * 10 + (*version++ - '0'); }
+    return (ctx_major > major || (ctx_major == major && ctx_minor >= minor));
+}
+
+/* SECTION:
+ *  OpenGL API
+ * * * * * * */
+
+/* <<gload-declr-0>> */
+#
+#  if defined (GLOAD_INTERNAL_USDT)
+
+/* SECTION:
+ *  gload USDT probes
+ * * * * * * * * * * */
+
+/* `static void *g_usdt_procs` - procedures called by the thunks, indexed by command ID.
+ * */
+/* <<gload-usdt-0>> */
+
+/* `struct s_gloadUsdtThunk` - procedure pointer and the thunk it's swapped with.
+ * */
+struct s_gloadUsdtThunk {
+    void    **addr;
+    void    *thunk;
+};
+
+/* `static struct s_gloadUsdtThunk g_usdt` - array of s_gloadUsdtThunk structures, indexed by command ID, null-terminated.
+ * */
+static struct s_gloadUsdtThunk  g_usdt[] = {
+
+/* <<gload-usdt-1>> */
+
+    /* null-terminator */
+    { 0, 0 }
+};
+
+/* `gloadUsdt_install`:
+ *
+ * Swap the loaded procedures with their probing thunks.
+ * Procedures that aren't loaded stay null, and the ones already swapped (i.e. on a second load) are skipped.
+ * */
+static void gloadUsdt_install(void) {
+    for (size_t i = 0; g_usdt[i].addr; i++) {
+        if (!*g_usdt[i].addr || *g_usdt[i].addr == g_usdt[i].thunk) { continue; }
+        g_usdt_procs[i] = *g_usdt[i].addr;
+        *g_usdt[i].addr = g_usdt[i].thunk;
+    }
+}
+
+#  endif /* GLOAD_INTERNAL_USDT */
+#
+#  if defined (GLOAD_INTERNAL_ATOMIC) || defined (GLOAD_INTERNAL_CLOCK) || defined (GLOAD_INTERNAL_HASH) || defined (GLOAD_INTERNAL_MMAP) || defined (GLOAD_INTERNAL_MUTEX) || defined (GLOAD_INTERNAL_THREAD) || defined (GLOAD_INTERNAL_THREAD_LOCAL)
+
+/* SECTION:
+ *  gload internals
+ * * * * * * * * * */
+
+#   if defined (GLOAD_INTERNAL_CLOCK)
+#    if defined (GLOAD_LINUX) && !defined (CLOCK_MONOTONIC)
+
+/* Strict ISO C modes (i.e. `-std=c99` without `_POSIX_C_SOURCE`) declare neither `clock_gettime` nor `struct timespec`,
+ * though the C library always exports it: declare it with the layout of `struct timespec` and the Linux clock ID... */
+struct s_gloadInternalTimespec {
+    time_t  tv_sec;
+    long    tv_nsec;
+};
+
+#     if defined (__cplusplus)
+extern "C" int  clock_gettime(int, struct s_gloadInternalTimespec *);
+#     else
+extern int      clock_gettime(int, struct s_gloadInternalTimespec *);
+#     endif /* __cplusplus */
+#     define GLOAD_INTERNAL_MONOTONIC 1
+
+#    endif /* GLOAD_LINUX, CLOCK_MONOTONIC */
+
+/* `gloadInternal_clock`:
+ *
+ * Read the monotonic clock: `clock_gettime(CLOCK_MONOTONIC)` or `QueryPerformanceCounter`.
+ *
+ * - return: monotonic time in nanoseconds, from an unspecified point in time.
+ * */
+static GLuint64 gloadInternal_clock(void) {
+
+#    if defined (GLOAD_LINUX) || defined (GLOAD_APPLE)
+#     if defined (GLOAD_INTERNAL_MONOTONIC)
+    struct s_gloadInternalTimespec  ts;
+
+    clock_gettime(GLOAD_INTERNAL_MONOTONIC, &ts);
+#     else
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+#     endif /* GLOAD_INTERNAL_MONOTONIC */
+    return ((GLuint64) ts.tv_sec * 1000000000ull + (GLuint64) ts.tv_nsec);
+#    endif /* GLOAD_LINUX, GLOAD_APPLE */
+#    if defined (GLOAD_WIN32)
+    static LARGE_INTEGER    frequency;
+    LARGE_INTEGER           counter;
+
+    /* the frequency is fixed at boot, a racing first call stores the same value... */
+    if (!frequency.QuadPart) { QueryPerformanceFrequency(&frequency); }
+    QueryPerformanceCounter(&counter);
+    return ((GLuint64) (counter.QuadPart / frequency.QuadPart) * 1000000000ull +
+            (GLuint64) (counter.QuadPart % frequency.QuadPart) * 1000000000ull / (GLuint64) frequency.QuadPart);
+#    endif /* GLOAD_WIN32 */
+
+}
+
+#   endif /* GLOAD_INTERNAL_CLOCK */
+#   if defined (GLOAD_INTERNAL_HASH)
+
+/* `gloadInternal_hash`:
+ *
+ * 64-bit FNV-1a hash of `size` bytes, chained through `hash`.
+ * Start the chain with 0xcbf29ce484222325.
+ * */
+static GLuint64 gloadInternal_hash(GLuint64 hash, const void *data, size_t size) {
+    const GLubyte   *bytes;
+
+    bytes = (const GLubyte *) data;
+    for (size_t i = 0; i < size; i++) {
+        hash ^= bytes[i];
+        hash *= 0x100000001b3ull;
+    }
+    return (hash);
+}
+
+#   endif /* GLOAD_INTERNAL_HASH */
+#   if defined (GLOAD_INTERNAL_ATOMIC)
+
+/* `gloadInternal_atomic*`:
+ *
+ * Load with acquire and store with release semantics, enough for single-producer single-consumer rings;
+ * read-modify-write operations need `GLOAD_INTERNAL_ATOMIC_RMW`.
+ * */
+
+#    if defined (_MSC_VER)
+static GLuint   gloadInternal_atomicLoad(volatile GLuint *value) { return ((GLuint) InterlockedCompareExchange((volatile LONG *) value, 0, 0)); }
+static void     gloadInternal_atomicStore(volatile GLuint *value, GLuint store) { InterlockedExchange((volatile LONG *) value, (LONG) store); }
+#     if defined (GLOAD_INTERNAL_ATOMIC_RMW)
+static GLuint   gloadInternal_atomicAdd(volatile GLuint *value, GLuint add) { return ((GLuint) InterlockedExchangeAdd((volatile LONG *) value, (LONG) add)); }
+static int      gloadInternal_atomicCompareExchange(volatile GLuint *value, GLuint expected, GLuint desired) { return (InterlockedCompareExchange((volatile LONG *) value, (LONG) desired, (LONG) expected) == (LONG) expected); }
+#     endif /* GLOAD_INTERNAL_ATOMIC_RMW */
+#    else
+static GLuint   gloadInternal_atomicLoad(volatile GLuint *value) { return (__atomic_load_n(value, __ATOMIC_ACQUIRE)); }
+static void     gloadInternal_atomicStore(volatile GLuint *value, GLuint store) { __atomic_store_n(value, store, __ATOMIC_RELEASE); }
+#     if defined (GLOAD_INTERNAL_ATOMIC_RMW)
+static GLuint   gloadInternal_atomicAdd(volatile GLuint *value, GLuint add) { return (__atomic_fetch_add(value, add, __ATOMIC_ACQ_REL)); }
+static int      gloadInternal_atomicCompareExchange(volatile GLuint *value, GLuint expected, GLuint desired) { return (__atomic_compare_exchange_n(value, &expected, desired, 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)); }
+#     endif /* GLOAD_INTERNAL_ATOMIC_RMW */
+#    endif /* _MSC_VER */
+
+#   endif /* GLOAD_INTERNAL_ATOMIC */
+#   if defined (GLOAD_INTERNAL_THREAD_LOCAL)
+
+/* `GLOAD_INTERNAL_TLS`:
+ *
+ * Storage class of thread-local variables.
+ * */
+
+#    if defined (_MSC_VER)
+#     define GLOAD_INTERNAL_TLS __declspec(thread)
+#    else
+#     define GLOAD_INTERNAL_TLS __thread
+#    endif /* _MSC_VER */
+
+#   endif /* GLOAD_INTERNAL_THREAD_LOCAL */
+#   if defined (GLOAD_INTERNAL_MMAP)
+
+/* `gloadInternal_map`:
+ *
+ * Map the whole file at `path` into memory, read-only.
+ *
+ * - return: address of the mapping on success, null on failure (or if the file is empty).
+ * */
+static void *gloadInternal_map(const char *path, size_t *size) {
+    void    *mapping;
+
+    *size = 0;
+
+#    if defined (GLOAD_LINUX) || defined (GLOAD_APPLE)
+    struct stat st;
+    int         fd;
+
+    fd = open(path, O_RDONLY);
+    if (fd < 0) { return (0); }
+    if (fstat(fd, &st) || st.st_size <= 0) {
+        close(fd);
+        return (0);
+    }
+    mapping = mmap(0, (size_t) st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mapping == MAP_FAILED) { return (0); }
+    *size = (size_t) st.st_size;
+#    endif /* GLOAD_LINUX, GLOAD_APPLE */
+#    if defined (GLOAD_WIN32)
+    LARGE_INTEGER   length;
+    HANDLE          file;
+    HANDLE          view;
+
+    file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, 0, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, 0);
+    if (file == INVALID_HANDLE_VALUE) { return (0); }
+    if (!GetFileSizeEx(file, &length) || length.QuadPart <= 0) {
+        CloseHandle(file);
+        return (0);
+    }
+    view = CreateFileMappingA(file, 0, PAGE_READONLY, 0, 0, 0);
+    CloseHandle(file);
+    if (!view) { return (0); }
+    mapping = MapViewOfFile(view, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(view);
+    if (!mapping) { return (0); }
+    *size = (size_t) length.QuadPart;
+#    endif /* GLOAD_WIN32 */
+
+    return (mapping);
+}
+
+/* `gloadInternal_unmap`:
+ *
+ * Unmap the memory returned from `gloadInternal_map`.
+ * */
+static void gloadInternal_unmap(void *mapping, size_t size) {
+    if (!mapping) { return; }
+
+#    if defined (GLOAD_LINUX) || defined (GLOAD_APPLE)
+    munmap(mapping, size);
+#    endif /* GLOAD_LINUX, GLOAD_APPLE */
+#    if defined (GLOAD_WIN32)
+    (void) size;
+    UnmapViewOfFile(mapping);
+#    endif /* GLOAD_WIN32 */
+
+}
+
+#   endif /* GLOAD_INTERNAL_MMAP */
+#   if defined (GLOAD_INTERNAL_MUTEX) || defined (GLOAD_INTERNAL_THREAD)
+#    if defined (GLOAD_LINUX) || defined (GLOAD_APPLE)
+
+typedef pthread_t       t_gloadInternalThread;
+typedef pthread_mutex_t t_gloadInternalMutex;
+typedef pthread_cond_t  t_gloadInternalCond;
+
+#     define GLOAD_INTERNAL_THREADPROC(name, arg) static void *name(void *arg)
+#     define GLOAD_INTERNAL_THREADEXIT return (0)
+
+#    endif /* GLOAD_LINUX, GLOAD_APPLE */
+#    if defined (GLOAD_WIN32)
+
+typedef HANDLE              t_gloadInternalThread;
+typedef CRITICAL_SECTION    t_gloadInternalMutex;
+typedef CONDITION_VARIABLE  t_gloadInternalCond;
+
+#     define GLOAD_INTERNAL_THREADPROC(name, arg) static DWORD WINAPI name(LPVOID arg)
+#     define GLOAD_INTERNAL_THREADEXIT return (0)
+
+#    endif /* GLOAD_WIN32 */
+
+/* `gloadInternal_thread*`, `gloadInternal_mutex*`, `gloadInternal_cond*`:
+ *
+ * Minimal threading primitives over pthreads and Win32 threads; condition variables need `GLOAD_INTERNAL_COND`,
+ * or `GLOAD_INTERNAL_TIMEDWAIT` for timed waits (in milliseconds).
+ * Thread procedures are declared with `GLOAD_INTERNAL_THREADPROC` and return with `GLOAD_INTERNAL_THREADEXIT`.
+ * */
+
+#    if defined (GLOAD_LINUX) || defined (GLOAD_APPLE)
+#     if defined (GLOAD_INTERNAL_THREAD)
+static int  gloadInternal_threadCreate(t_gloadInternalThread *thread, void *(*proc)(void *), void *arg) { return (!pthread_create(thread, 0, proc, arg)); }
+static void gloadInternal_threadJoin(t_gloadInternalThread *thread) { pthread_join(*thread, 0); }
+#     endif /* GLOAD_INTERNAL_THREAD */
+#     if defined (GLOAD_INTERNAL_MUTEX)
+static void gloadInternal_mutexInit(t_gloadInternalMutex *mutex) { pthread_mutex_init(mutex, 0); }
+static void gloadInternal_mutexDestroy(t_gloadInternalMutex *mutex) { pthread_mutex_destroy(mutex); }
+static void gloadInternal_mutexLock(t_gloadInternalMutex *mutex) { pthread_mutex_lock(mutex); }
+static void gloadInternal_mutexUnlock(t_gloadInternalMutex *mutex) { pthread_mutex_unlock(mutex); }
+#     endif /* GLOAD_INTERNAL_MUTEX */
+#     if defined (GLOAD_INTERNAL_COND) || defined (GLOAD_INTERNAL_TIMEDWAIT)
+static void gloadInternal_condInit(t_gloadInternalCond *cond) { pthread_cond_init(cond, 0); }
+static void gloadInternal_condDestroy(t_gloadInternalCond *cond) { pthread_cond_destroy(cond); }
+static void gloadInternal_condBroadcast(t_gloadInternalCond *cond) { pthread_cond_broadcast(cond); }
+#     endif /* GLOAD_INTERNAL_COND, GLOAD_INTERNAL_TIMEDWAIT */
+#     if defined (GLOAD_INTERNAL_COND)
+static void gloadInternal_condWait(t_gloadInternalCond *cond, t_gloadInternalMutex *mutex) { pthread_cond_wait(cond, mutex); }
+#     endif /* GLOAD_INTERNAL_COND */
+#     if defined (GLOAD_INTERNAL_TIMEDWAIT)
+static void gloadInternal_condTimedWait(t_gloadInternalCond *cond, t_gloadInternalMutex *mutex, GLuint ms) {
+    struct timespec ts;
+    struct timeval  tv;
+
+    gettimeofday(&tv, 0);
+    ts.tv_sec = tv.tv_sec + (time_t) (ms / 1000);
+    ts.tv_nsec = (long) tv.tv_usec * 1000 + (long) (ms % 1000) * 1000000;
+    if (ts.tv_nsec >= 1000000000) { ts.tv_sec++, ts.tv_nsec -= 1000000000; }
+    pthread_cond_timedwait(cond, mutex, &ts);
+}
+#     endif /* GLOAD_INTERNAL_TIMEDWAIT */
+#    endif /* GLOAD_LINUX, GLOAD_APPLE */
+#    if defined (GLOAD_WIN32)
+#     if defined (GLOAD_INTERNAL_THREAD)
+static int  gloadInternal_threadCreate(t_gloadInternalThread *thread, LPTHREAD_START_ROUTINE proc, void *arg) { return ((*thread = CreateThread(0, 0, proc, arg, 0, 0)) != 0); }
+static void gloadInternal_threadJoin(t_gloadInternalThread *thread) { WaitForSingleObject(*thread, INFINITE), CloseHandle(*thread); }
+#     endif /* GLOAD_INTERNAL_THREAD */
+#     if defined (GLOAD_INTERNAL_MUTEX)
+static void gloadInternal_mutexInit(t_gloadInternalMutex *mutex) { InitializeCriticalSection(mutex); }
+static void gloadInternal_mutexDestroy(t_gloadInternalMutex *mutex) { DeleteCriticalSection(mutex); }
+static void gloadInternal_mutexLock(t_gloadInternalMutex *mutex) { EnterCriticalSection(mutex); }
+static void gloadInternal_mutexUnlock(t_gloadInternalMutex *mutex) { LeaveCriticalSection(mutex); }
+#     endif /* GLOAD_INTERNAL_MUTEX */
+#     if defined (GLOAD_INTERNAL_COND) || defined (GLOAD_INTERNAL_TIMEDWAIT)
+static void gloadInternal_condInit(t_gloadInternalCond *cond) { InitializeConditionVariable(cond); }
+static void gloadInternal_condDestroy(t_gloadInternalCond *cond) { (void) cond; }
+static void gloadInternal_condBroadcast(t_gloadInternalCond *cond) { WakeAllConditionVariable(cond); }
+#     endif /* GLOAD_INTERNAL_COND, GLOAD_INTERNAL_TIMEDWAIT */
+#     if defined (GLOAD_INTERNAL_COND)
+static void gloadInternal_condWait(t_gloadInternalCond *cond, t_gloadInternalMutex *mutex) { SleepConditionVariableCS(cond, mutex, INFINITE); }
+#     endif /* GLOAD_INTERNAL_COND */
+#     if defined (GLOAD_INTERNAL_TIMEDWAIT)
+static void gloadInternal_condTimedWait(t_gloadInternalCond *cond, t_gloadInternalMutex *mutex, GLuint ms) { SleepConditionVariableCS(cond, mutex, ms); }
+#     endif /* GLOAD_INTERNAL_TIMEDWAIT */
+#    endif /* GLOAD_WIN32 */
+
+#   endif /* GLOAD_INTERNAL_MUTEX, GLOAD_INTERNAL_THREAD */
+#  endif /* GLOAD_INTERNAL_ATOMIC, GLOAD_INTERNAL_CLOCK, GLOAD_INTERNAL_HASH, GLOAD_INTERNAL_MMAP, GLOAD_INTERNAL_MUTEX, GLOAD_INTERNAL_THREAD, GLOAD_INTERNAL_THREAD_LOCAL */
+#
+#  if defined (GLOAD_STREAM_BUFFER)
+
+/* SECTION:
+ *  gload stream buffer API
+ * * * * * * * * * * * * * */
+
+/* `gloadStreamBufferCreate`:
+ *
+ * Create a stream buffer of `count` regions, `region` bytes each.
+ * The buffer is left bound to `target`.
+ *
+ * - param: `t_gloadStreamBuffer *stream` - stream buffer to initialize
+ * - param: `GLenum target` - buffer binding target (i.e. `GL_ARRAY_BUFFER`, `GL_UNIFORM_BUFFER`)
+ * - param: `GLsizeiptr region` - size of a single per-frame region in bytes
+ * - param: `GLuint count` - number of regions (1 - GLOAD_STREAM_BUFFER_MAX_REGIONS, at least 2 to map it persistently)
+ * - return: `true` on success, `false` on failure.
+ * */
+GLAPI int   gloadStreamBufferCreate(t_gloadStreamBuffer *stream, GLenum target, GLsizeiptr region, GLuint count) {
+    PFNGLBUFFERSTORAGEPROC  storage;
+    const char              *version;
+    GLbitfield              flags;
+
+    if (!stream) { return (0); }
+    memset(stream, 0, sizeof(t_gloadStreamBuffer));
+    if (region <= 0 || !count || count > GLOAD_STREAM_BUFFER_MAX_REGIONS) { return (0); }
+    if (!glGenBuffers || !glBindBuffer || !glBufferData || !glBufferSubData) { return (0); }
+
+    stream->target = target;
+    stream->region = region;
+    stream->count = count;
+    glGenBuffers(1, &stream->buffer);
+    glBindBuffer(target, stream->buffer);
+
+    /* OpenGLES only has GL_EXT_buffer_storage, with the same tokens... */
+    storage = 0;
+    version = glGetString ? (const char *) glGetString(GL_VERSION) : 0;
+    if (version && !strncmp(version, "OpenGL ES", 9)) {
+        if (gloadIsExtensionSupported("GL_EXT_buffer_storage")) { storage = glBufferStorageEXT; }
+    }
+    else if (gloadIsVersionSupported(4, 4) || gloadIsExtensionSupported("GL_ARB_buffer_storage")) { storage = glBufferStorage; }
+
+    /* A single persistent region would wait on the fence of the previous frame every frame... */
+    if (storage && count < 2) {
+        storage = 0;
+
+#   if defined (GLOAD_VERBOSE_WARN)
+        fprintf(stderr, "gload.h: a persistent stream buffer needs at least 2 regions, falling back to orphaning.\n");
+#   endif /* GLOAD_VERBOSE_WARN */
+
+    }
+
+    if (storage && glMapBufferRange && glUnmapBuffer && glFenceSync && glClientWaitSync && glDeleteSync) {
+        flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+        storage(target, region * count, 0, flags);
+        stream->mapping = (GLubyte *) glMapBufferRange(target, 0, region * count, flags);
+        if (stream->mapping) {
+            stream->persistent = 1;
+            return (1);
+        }
+
+        /* Storage of the buffer is immutable now, so we need a new one for the fallback... */
+        glDeleteBuffers(1, &stream->buffer);
+        glGenBuffers(1, &stream->buffer);
+        glBindBuffer(target, stream->buffer);
+
+#   if defined (GLOAD_VERBOSE_WARN)
+        fprintf(stderr, "gload.h: could not map a persistent stream buffer, falling back to orphaning.\n");
+#   endif /* GLOAD_VERBOSE_WARN */
+
+    }
+
+    /* Fallback: single region, orphaned every frame... */
+    stream->count = 1;
+    stream->mapping = (GLubyte *) malloc((size_t) region);
+    if (!stream->mapping) {
+        glDeleteBuffers(1, &stream->buffer), stream->buffer = 0;
+        return (0);
+    }
+    glBufferData(target, region, 0, GL_STREAM_DRAW);
+    return (1);
+}
+
+/* `gloadStreamBufferDestroy`:
+ *
+ * Unmap and delete the buffer and every pending fence of the stream buffer.
+ *
+ * - param: `t_gloadStreamBuffer *stream` - stream buffer to destroy
+ * */
+GLAPI void  gloadStreamBufferDestroy(t_gloadStreamBuffer *stream) {
+    if (!stream || !stream->buffer) { return; }
+
+    if (stream->persistent) {
+        for (GLuint i = 0; i < stream->count; i++) {
+            if (stream->fences[i]) { glDeleteSync(stream->fences[i]), stream->fences[i] = 0; }
+        }
+        glBindBuffer(stream->target, stream->buffer);
+        glUnmapBuffer(stream->target);
+    }
+    else {
+        free(stream->mapping);
+    }
+    glDeleteBuffers(1, &stream->buffer);
+    memset(stream, 0, sizeof(t_gloadStreamBuffer));
+}
+
+/* `gloadStreamBufferMap`:
+ *
+ * Reserve `size` bytes in the current region and return a pointer to write them to.
+ * The written data becomes visible to the GPU after `gloadStreamBufferUnmap`.
+ *
+ * - param: `t_gloadStreamBuffer *stream` - stream buffer
+ * - param: `GLsizeiptr size` - number of bytes to reserve
+ * - param: `GLsizeiptr align` - alignment of the reservation (i.e. GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT), 0 for none
+ * - param: `GLintptr *offset` - offset of the reservation within the buffer object, to use in draw/bind calls
+ * - return: pointer to the reserved memory on success, null if the region is full.
+ * */
+GLAPI void  *gloadStreamBufferMap(t_gloadStreamBuffer *stream, GLsizeiptr size, GLsizeiptr align, GLintptr *offset) {
+    GLsizeiptr  head;
+    GLsizeiptr  base;
+
+    if (!stream || !stream->mapping || size <= 0) { return (0); }
+
+    head = stream->tail;
+    if (align > 1) { head = (head + align - 1) / align * align; }
+    if (head + size > stream->region) { return (0); }
+
+    stream->head = head;
+    stream->tail = head + size;
+    base = stream->persistent ? (GLsizeiptr) stream->index * stream->region : 0;
+    if (offset) { *offset = base + head; }
+    return (stream->mapping + base + head);
+}
+
+/* `gloadStreamBufferUnmap`:
+ *
+ * Publish the last reservation returned from `gloadStreamBufferMap`.
+ *
+ * - param: `t_gloadStreamBuffer *stream` - stream buffer
+ * */
+GLAPI void  gloadStreamBufferUnmap(t_gloadStreamBuffer *stream) {
+    if (!stream || stream->tail <= stream->head) { return; }
+
+    /* Persistent mapping is coherent, so there is nothing to flush... */
+    if (!stream->persistent) {
+        glBindBuffer(stream->target, stream->buffer);
+        glBufferSubData(stream->target, stream->head, stream->tail - stream->head, stream->mapping + stream->head);
+    }
+    stream->bytes += (GLuint64) (stream->tail - stream->head);
+    stream->head = stream->tail;
+}
+
+/* `gloadStreamBufferNextFrame`:
+ *
+ * Fence the current region and advance to the next one, waiting on its fence if the GPU
+ * hasn't finished reading from it yet. Should be called once per frame, after the draws
+ * that source the current region were issued.
+ *
+ * - param: `t_gloadStreamBuffer *stream` - stream buffer
+ * */
+GLAPI void  gloadStreamBufferNextFrame(t_gloadStreamBuffer *stream) {
+    GLsync  fence;
+    GLenum  status;
+
+    if (!stream || !stream->buffer) { return; }
+
+    stream->head = stream->tail = 0;
+    stream->frames++;
+    if (!stream->persistent) {
+        glBindBuffer(stream->target, stream->buffer);
+        glBufferData(stream->target, stream->region, 0, GL_STREAM_DRAW);
+        return;
+    }
+
+    stream->fences[stream->index] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    stream->index = (stream->index + 1) % stream->count;
+
+    fence = stream->fences[stream->index];
+    if (!fence) { return; }
+
+    status = glClientWaitSync(fence, 0, 0);
+    if (status == GL_TIMEOUT_EXPIRED) {
+        stream->waits++;
+        do {
+            status = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000);
+        } while (status == GL_TIMEOUT_EXPIRED);
+    }
+    glDeleteSync(fence), stream->fences[stream->index] = 0;
+}
+
+#  endif /* GLOAD_STREAM_BUFFER */
+#
+#  if defined (GLOAD_IMMEDIATE)
+
+/* SECTION:
+ *  gload immediate-mode API
+ * * * * * * * * * * * * * */
+
+/* `struct s_gloadImmVertex` - vertex layout of the immediate-mode batches.
+ * */
+struct s_gloadImmVertex {
+    GLfloat pos[4];
+    GLubyte col[4];
+    GLfloat uv[2];
+};
+
+/* `static struct s_gloadImmediate g_immediate` - state of the immediate-mode emulator.
+ *
+ * Vertices of the current primitive are addressed through `prim_base` (and `prim_first` for
+ * fans, polygons and line loops), so the primitive can continue in the next batch when
+ * the current one overflows.
+ * */
+static struct s_gloadImmediate {
+    int                     init;
+    int                     core;
+    t_gloadStreamBuffer     stream;
+    GLuint                  vao;
+    GLuint                  program;
+    GLint                   u_mvp;
+    GLint                   u_textured;
+    GLfloat                 mvp[16];
+    int                     mvp_dirty;
+
+    /* tracked user state */
+    GLuint                  user_program;
+    GLuint                  user_vao;
+    GLuint                  user_array;
+    int                     textured;
+
+    /* current attributes */
+    GLubyte                 col[4];
+    GLfloat                 uv[2];
+
+    /* batch */
+    struct s_gloadImmVertex *vertices;
+    GLuint                  *indices;
+    GLuint                  vcount;
+    GLuint                  icount;
+    GLenum                  batch;
+
+    /* current primitive */
+    GLenum                  mode;
+    int                     inside;
+    GLuint                  prim_k;
+    GLuint                  prim_first;
+    long                    prim_base;
+
+    /* original procedures, kept by `gloadImmediateTerminate` for the hooks still called by another one */
+    PFNGLBEGINPROC              orig_glBegin;
+    PFNGLENDPROC                orig_glEnd;
+    PFNGLBINDTEXTUREPROC        orig_glBindTexture;
+    PFNGLBINDBUFFERPROC         orig_glBindBuffer;
+    PFNGLACTIVETEXTUREPROC      orig_glActiveTexture;
+    PFNGLUSEPROGRAMPROC         orig_glUseProgram;
+    PFNGLBINDVERTEXARRAYPROC    orig_glBindVertexArray;
+    PFNGLBINDFRAMEBUFFERPROC    orig_glBindFramebuffer;
+    PFNGLENABLEPROC             orig_glEnable;
+    PFNGLDISABLEPROC            orig_glDisable;
+    PFNGLBLENDFUNCPROC          orig_glBlendFunc;
+    PFNGLDEPTHFUNCPROC          orig_glDepthFunc;
+    PFNGLDEPTHMASKPROC          orig_glDepthMask;
+    PFNGLVIEWPORTPROC           orig_glViewport;
+    PFNGLSCISSORPROC            orig_glScissor;
+    PFNGLLINEWIDTHPROC          orig_glLineWidth;
+    PFNGLPOINTSIZEPROC          orig_glPointSize;
+    PFNGLCLEARPROC              orig_glClear;
+    PFNGLDRAWARRAYSPROC         orig_glDrawArrays;
+    PFNGLDRAWELEMENTSPROC       orig_glDrawElements;
+    PFNGLREADPIXELSPROC         orig_glReadPixels;
+    PFNGLFLUSHPROC              orig_glFlush;
+    PFNGLFINISHPROC             orig_glFinish;
+}   g_immediate;
+
+/* Swap a procedure with its hook, and back only if no other hook was installed on top of it since... */
+#   define GLOAD_IMMEDIATE_HOOK(name) \
+    if (!g_immediate.orig_##name) { g_immediate.orig_##name = gload_##name, gload_##name = gloadImmediate_##name; }
+#   define GLOAD_IMMEDIATE_UNHOOK(name) \
+    if (gload_##name == gloadImmediate_##name) { gload_##name = g_immediate.orig_##name, g_immediate.orig_##name = 0; }
+
+static const GLchar *g_immediate_vertex_glsl =
+"uniform mat4 u_mvp;\n"
+"in vec4 a_pos;\n"
+"in vec4 a_col;\n"
+"in vec2 a_uv;\n"
+"out vec4 v_col;\n"
+"out vec2 v_uv;\n"
+"void main() {\n"
+"   v_col = a_col;\n"
+"   v_uv = a_uv;\n"
+"   gl_Position = u_mvp * a_pos;\n"
+"}\n";
+
+static const GLchar *g_immediate_fragment_glsl =
+"uniform sampler2D u_tex;\n"
+"uniform int u_textured;\n"
+"in vec4 v_col;\n"
+"in vec2 v_uv;\n"
+"out vec4 f_col;\n"
+"void main() {\n"
+"   f_col = u_textured != 0 ? v_col * texture(u_tex, v_uv) : v_col;\n"
+"}\n";
+
+/* Primitive class (GL_TRIANGLES, GL_LINES or GL_POINTS) a legacy primitive is converted to... */
+static GLenum   gloadImmediate_class(GLenum mode) {
+    switch (mode) {
+        case (GL_POINTS):
+            return (GL_POINTS);
+        case (GL_LINES):
+        case (GL_LINE_STRIP):
+        case (GL_LINE_LOOP):
+            return (GL_LINES);
+        default:
+            return (GL_TRIANGLES);
+    }
+}
+
+/* Batch index of the `j`-th vertex of the current primitive... */
+static GLuint   gloadImmediate_index(GLuint j) {
+    GLenum  mode;
+
+    mode = g_immediate.mode;
+    if (!j && (mode == GL_TRIANGLE_FAN || mode == GL_POLYGON || mode == GL_LINE_LOOP)) {
+        return (g_immediate.prim_first);
+    }
+    return ((GLuint) (g_immediate.prim_base + (long) j));
+}
+
+/* `gloadImmediateFlush`:
+ *
+ * Draw every vertex accumulated since the last flush.
+ * */
+GLAPI void  gloadImmediateFlush(void) {
+    GLsizeiptr  vsize;
+    GLsizeiptr  isize;
+    GLintptr    offset;
+    GLubyte     *ptr;
+    GLuint      array;
+
+    if (!g_immediate.init || !g_immediate.icount) {
+        g_immediate.vcount = g_immediate.icount = 0;
+        return;
+    }
+
+    vsize = (GLsizeiptr) (g_immediate.vcount * sizeof(struct s_gloadImmVertex));
+    isize = (GLsizeiptr) (g_immediate.icount * sizeof(GLuint));
+
+    /* the stream buffer binds its buffer through the hooked `glBindBuffer` too... */
+    array = g_immediate.user_array;
+    g_immediate.orig_glBindVertexArray(g_immediate.vao);
+
+    ptr = (GLubyte *) gloadStreamBufferMap(&g_immediate.stream, vsize + isize, sizeof(GLfloat), &offset);
+    if (!ptr) {
+        gloadStreamBufferNextFrame(&g_immediate.stream);
+        ptr = (GLubyte *) gloadStreamBufferMap(&g_immediate.stream, vsize + isize, sizeof(GLfloat), &offset);
+    }
+    if (ptr) {
+        memcpy(ptr, g_immediate.vertices, (size_t) vsize);
+        memcpy(ptr + vsize, g_immediate.indices, (size_t) isize);
+        gloadStreamBufferUnmap(&g_immediate.stream);
+
+        g_immediate.orig_glBindBuffer(GL_ARRAY_BUFFER, g_immediate.stream.buffer);
+        g_immediate.orig_glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, g_immediate.stream.buffer);
+        glVertexAttribPointer(0, 4, GL_FLOAT, GL_FALSE, sizeof(struct s_gloadImmVertex),
+                              (const void *) (offset + offsetof(struct s_gloadImmVertex, pos)));
+        glVertexAttribPointer(1, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(struct s_gloadImmVertex),
+                              (const void *) (offset + offsetof(struct s_gloadImmVertex, col)));
+        glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(struct s_gloadImmVertex),
+                              (const void *) (offset + offsetof(struct s_gloadImmVertex, uv)));
+
+        if (!g_immediate.user_program) {
+            g_immediate.orig_glUseProgram(g_immediate.program);
+            if (g_immediate.mvp_dirty) {
+                glUniformMatrix4fv(g_immediate.u_mvp, 1, GL_FALSE, g_immediate.mvp);
+                g_immediate.mvp_dirty = 0;
+            }
+            glUniform1i(g_immediate.u_textured, g_immediate.textured);
+        }
+        g_immediate.orig_glDrawElements(g_immediate.batch, (GLsizei) g_immediate.icount, GL_UNSIGNED_INT,
+                                        (const void *) (offset + vsize));
+        if (!g_immediate.user_program) {
+            g_immediate.orig_glUseProgram(0);
+        }
+    }
+
+#   if defined (GLOAD_VERBOSE_ERROR)
+    else {
+        fprintf(stderr, "gload.h: immediate-mode batch doesn't fit into the stream buffer.\n");
+    }
+#   endif /* GLOAD_VERBOSE_ERROR */
+
+    g_immediate.orig_glBindVertexArray(g_immediate.user_vao);
+    g_immediate.orig_glBindBuffer(GL_ARRAY_BUFFER, array);
+    g_immediate.user_array = array;
+    g_immediate.vcount = g_immediate.icount = 0;
+}
+
+/* Flush the batch in the middle of a primitive, carrying over the vertices the primitive still refers to... */
+static void gloadImmediate_carry(void) {
+    struct s_gloadImmVertex first;
+    struct s_gloadImmVertex last[3];
+    GLuint                  keep;
+    GLuint                  k;
+    int                     fan;
+
+    k = g_immediate.prim_k;
+    fan = 0;
+    switch (g_immediate.mode) {
+        case (GL_TRIANGLES):        { keep = k % 3; } break;
+        case (GL_QUADS):            { keep = k % 4; } break;
+        case (GL_LINES):            { keep = k % 2; } break;
+        case (GL_TRIANGLE_STRIP):   { keep = k < 2 ? k : 2; } break;
+        case (GL_QUAD_STRIP):       { keep = k < 2 + k % 2 ? k : 2 + k % 2; } break;
+        case (GL_LINE_STRIP):       { keep = k < 1 ? k : 1; } break;
+        case (GL_TRIANGLE_FAN):
+        case (GL_POLYGON):
+        case (GL_LINE_LOOP):        { keep = k < 2 ? 0 : 1; fan = k > 0; } break;
+        default:                    { keep = 0; } break;
+    }
+
+    if (fan) { first = g_immediate.vertices[gloadImmediate_index(0)]; }
+    for (GLuint i = 0; i < keep; i++) {
+        last[i] = g_immediate.vertices[gloadImmediate_index(k - keep + i)];
+    }
+
+    gloadImmediateFlush();
+
+    if (fan) {
+        g_immediate.prim_first = g_immediate.vcount;
+        g_immediate.vertices[g_immediate.vcount++] = first;
+    }
+    g_immediate.prim_base = (long) g_immediate.vcount - (long) (k - keep);
+    for (GLuint i = 0; i < keep; i++) {
+        g_immediate.vertices[g_immediate.vcount++] = last[i];
+    }
+}
+
+static void gloadImmediate_emit2(GLuint a, GLuint b) {
+    g_immediate.indices[g_immediate.icount++] = gloadImmediate_index(a);
+    g_immediate.indices[g_immediate.icount++] = gloadImmediate_index(b);
+}
+
+static void gloadImmediate_emit3(GLuint a, GLuint b, GLuint c) {
+    g_immediate.indices[g_immediate.icount++] = gloadImmediate_index(a);
+    g_immediate.indices[g_immediate.icount++] = gloadImmediate_index(b);
+    g_immediate.indices[g_immediate.icount++] = gloadImmediate_index(c);
+}
+
+static void gloadImmediate_vertex(GLfloat x, GLfloat y, GLfloat z, GLfloat w) {
+    struct s_gloadImmVertex *vertex;
+    GLuint                  k;
+
+    if (!g_immediate.inside) { return; }
+    if (g_immediate.vcount + 1 > GLOAD_IMMEDIATE_MAX_VERTICES ||
+        g_immediate.icount + 6 > GLOAD_IMMEDIATE_MAX_VERTICES * 3) {
+        gloadImmediate_carry();
+    }
+
+    vertex = &g_immediate.vertices[g_immediate.vcount++];
+    vertex->pos[0] = x, vertex->pos[1] = y, vertex->pos[2] = z, vertex->pos[3] = w;
+    memcpy(vertex->col, g_immediate.col, sizeof(vertex->col));
+    memcpy(vertex->uv, g_immediate.uv, sizeof(vertex->uv));
+
+    k = g_immediate.prim_k++;
+    switch (g_immediate.mode) {
+        case (GL_POINTS):
+        case (GL_LINES):
+        case (GL_TRIANGLES): {
+            g_immediate.indices[g_immediate.icount++] = gloadImmediate_index(k);
+        } break;
+        case (GL_LINE_STRIP):
+        case (GL_LINE_LOOP): {
+            if (k >= 1) { gloadImmediate_emit2(k - 1, k); }
+        } break;
+        case (GL_QUADS): {
+            if (k % 4 == 3) {
+                gloadImmediate_emit3(k - 3, k - 2, k - 1);
+                gloadImmediate_emit3(k - 3, k - 1, k);
+            }
+        } break;
+        case (GL_TRIANGLE_STRIP): {
+            if (k >= 2) {
+                if (k % 2) { gloadImmediate_emit3(k - 1, k - 2, k); }
+                else { gloadImmediate_emit3(k - 2, k - 1, k); }
+            }
+        } break;
+        case (GL_TRIANGLE_FAN):
+        case (GL_POLYGON): {
+            if (k >= 2) { gloadImmediate_emit3(0, k - 1, k); }
+        } break;
+        case (GL_QUAD_STRIP): {
+            if (k >= 3 && k % 2) {
+                gloadImmediate_emit3(k - 3, k - 2, k);
+                gloadImmediate_emit3(k - 3, k, k - 1);
+            }
+        } break;
+    }
+}
+
+static void APIENTRY    gloadImmediate_glBegin(GLenum mode) {
+    if (!g_immediate.init) {
+        g_immediate.orig_glBegin(mode);
+        return;
+    }
+    if (g_immediate.inside) { return; }
+    if (g_immediate.icount && gloadImmediate_class(mode) != g_immediate.batch) {
+        gloadImmediateFlush();
+    }
+    g_immediate.batch = gloadImmediate_class(mode);
+    g_immediate.mode = mode;
+    g_immediate.inside = 1;
+    g_immediate.prim_k = 0;
+    g_immediate.prim_first = g_immediate.vcount;
+    g_immediate.prim_base = (long) g_immediate.vcount;
+}
+
+static void APIENTRY    gloadImmediate_glEnd(void) {
+    if (!g_immediate.init) {
+        g_immediate.orig_glEnd();
+        return;
+    }
+    if (!g_immediate.inside) { return; }
+    if (g_immediate.mode == GL_LINE_LOOP && g_immediate.prim_k >= 2) {
+        if (g_immediate.icount + 2 > GLOAD_IMMEDIATE_MAX_VERTICES * 3) { gloadImmediate_carry(); }
+        gloadImmediate_emit2(g_immediate.prim_k - 1, 0);
+    }
+    g_immediate.inside = 0;
+}
+
+/* signed normalized integers map their most negative value below -1... */
+static GLfloat  gloadImmediate_snorm(GLfloat value) {
+    return (value < -1.0f ? -1.0f : value);
+}
+
+static GLubyte  gloadImmediate_unorm(GLfloat value) {
+    if (value <= 0.0f) { return (0); }
+    if (value >= 1.0f) { return (255); }
+    return ((GLubyte) (value * 255.0f + 0.5f));
+}
+
+static void gloadImmediate_color(GLfloat r, GLfloat g, GLfloat b, GLfloat a) {
+    g_immediate.col[0] = gloadImmediate_unorm(r);
+    g_immediate.col[1] = gloadImmediate_unorm(g);
+    g_immediate.col[2] = gloadImmediate_unorm(b);
+    g_immediate.col[3] = gloadImmediate_unorm(a);
+}
+
+static void gloadImmediate_colorub(GLubyte r, GLubyte g, GLubyte b, GLubyte a) {
+    g_immediate.col[0] = r, g_immediate.col[1] = g, g_immediate.col[2] = b, g_immediate.col[3] = a;
+}
+
+/* only `s` and `t` are kept, `r` and `q` are ignored... */
+static void gloadImmediate_texcoord(GLfloat s, GLfloat t) {
+    g_immediate.uv[0] = s, g_immediate.uv[1] = t;
+}
+
+/* `glVertex*`, `glColor*` and `glTexCoord*`: every variant of the registry, converted to the helpers above
+ * and calling their original procedure in `g_immediate_procs` while the emulator isn't initialized... */
+/* <<gload-immediate-0>> */
+
+/* `struct s_gloadImmHook` - procedure pointer and the procedure it's swapped with.
+ * */
+struct s_gloadImmHook {
+    void    **addr;
+    void    *hook;
+};
+
+/* `static struct s_gloadImmHook g_immediate_hooks` - array of s_gloadImmHook structures, indexed as `g_immediate_procs`,
+ * null-terminated.
+ * */
+static struct s_gloadImmHook    g_immediate_hooks[] = {
+
+/* <<gload-immediate-1>> */
+
+    /* null-terminator */
+    { 0, 0 }
+};
+
+/* State-changing procedures: draw the pending batch with the old state first
+ * (`gloadImmediateFlush` does nothing while the emulator isn't initialized)... */
+
+static void APIENTRY    gloadImmediate_glBindTexture(GLenum target, GLuint texture) {
+    gloadImmediateFlush();
+    g_immediate.orig_glBindTexture(target, texture);
+}
+
+/* the batch draws from its own vertex array, so binding a buffer doesn't flush... */
+static void APIENTRY    gloadImmediate_glBindBuffer(GLenum target, GLuint buffer) {
+    if (target == GL_ARRAY_BUFFER) { g_immediate.user_array = buffer; }
+    g_immediate.orig_glBindBuffer(target, buffer);
+}
+
+static void APIENTRY    gloadImmediate_glActiveTexture(GLenum texture) {
+    gloadImmediateFlush();
+    g_immediate.orig_glActiveTexture(texture);
+}
+
+static void APIENTRY    gloadImmediate_glUseProgram(GLuint program) {
+    gloadImmediateFlush();
+    g_immediate.user_program = program;
+    g_immediate.orig_glUseProgram(program);
+}
+
+static void APIENTRY    gloadImmediate_glBindVertexArray(GLuint array) {
+    gloadImmediateFlush();
+    g_immediate.user_vao = array;
+    g_immediate.orig_glBindVertexArray(array);
+}
+
+static void APIENTRY    gloadImmediate_glBindFramebuffer(GLenum target, GLuint framebuffer) {
+    gloadImmediateFlush();
+    g_immediate.orig_glBindFramebuffer(target, framebuffer);
+}
+
+static void APIENTRY    gloadImmediate_glEnable(GLenum cap) {
+    gloadImmediateFlush();
+    if (cap == GL_TEXTURE_2D) {
+        g_immediate.textured = 1;
+        if (g_immediate.core) { return; }
+    }
+    g_immediate.orig_glEnable(cap);
+}
+
+static void APIENTRY    gloadImmediate_glDisable(GLenum cap) {
+    gloadImmediateFlush();
+    if (cap == GL_TEXTURE_2D) {
+        g_immediate.textured = 0;
+        if (g_immediate.core) { return; }
+    }
+    g_immediate.orig_glDisable(cap);
+}
+
+static void APIENTRY    gloadImmediate_glBlendFunc(GLenum sfactor, GLenum dfactor) {
+    gloadImmediateFlush();
+    g_immediate.orig_glBlendFunc(sfactor, dfactor);
+}
+
+static void APIENTRY    gloadImmediate_glDepthFunc(GLenum func) {
+    gloadImmediateFlush();
+    g_immediate.orig_glDepthFunc(func);
+}
+
+static void APIENTRY    gloadImmediate_glDepthMask(GLboolean flag) {
+    gloadImmediateFlush();
+    g_immediate.orig_glDepthMask(flag);
+}
+
+static void APIENTRY    gloadImmediate_glViewport(GLint x, GLint y, GLsizei width, GLsizei height) {
+    gloadImmediateFlush();
+    g_immediate.orig_glViewport(x, y, width, height);
+}
+
+static void APIENTRY    gloadImmediate_glScissor(GLint x, GLint y, GLsizei width, GLsizei height) {
+    gloadImmediateFlush();
+    g_immediate.orig_glScissor(x, y, width, height);
+}
+
+static void APIENTRY    gloadImmediate_glLineWidth(GLfloat width) {
+    gloadImmediateFlush();
+    g_immediate.orig_glLineWidth(width);
+}
+
+static void APIENTRY    gloadImmediate_glPointSize(GLfloat size) {
+    gloadImmediateFlush();
+    g_immediate.orig_glPointSize(size);
+}
+
+static void APIENTRY    gloadImmediate_glClear(GLbitfield mask) {
+    gloadImmediateFlush();
+    g_immediate.orig_glClear(mask);
+}
+
+static void APIENTRY    gloadImmediate_glDrawArrays(GLenum mode, GLint first, GLsizei count) {
+    gloadImmediateFlush();
+    g_immediate.orig_glDrawArrays(mode, first, count);
+}
+
+static void APIENTRY    gloadImmediate_glDrawElements(GLenum mode, GLsizei count, GLenum type, const void *indices) {
+    gloadImmediateFlush();
+    g_immediate.orig_glDrawElements(mode, count, type, indices);
+}
+
+static void APIENTRY    gloadImmediate_glReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels) {
+    gloadImmediateFlush();
+    g_immediate.orig_glReadPixels(x, y, width, height, format, type, pixels);
+}
+
+static void APIENTRY    gloadImmediate_glFlush(void) {
+    gloadImmediateFlush();
+    g_immediate.orig_glFlush();
+}
+
+static void APIENTRY    gloadImmediate_glFinish(void) {
+    gloadImmediateFlush();
+    g_immediate.orig_glFinish();
+}
+
+/* Compile and link the built-in shader... */
+static GLuint   gloadImmediate_program(void) {
+    const GLchar    *sources[2];
+    GLuint          shaders[2];
+    GLuint          program;
+    GLint           status;
+
+    /* GLSL 1.30 for OpenGL 3.0 - 3.2 contexts, GLSL 3.30 core otherwise... */
+    sources[0] = gloadIsVersionSupported(3, 3) ? "#version 330 core\n" : "#version 130\n";
+
+    program = glCreateProgram();
+    shaders[0] = glCreateShader(GL_VERTEX_SHADER);
+    shaders[1] = glCreateShader(GL_FRAGMENT_SHADER);
+    sources[1] = g_immediate_vertex_glsl;
+    glShaderSource(shaders[0], 2, sources, 0);
+    sources[1] = g_immediate_fragment_glsl;
+    glShaderSource(shaders[1], 2, sources, 0);
+
+    for (int i = 0; i < 2; i++) {
+        glCompileShader(shaders[i]);
+        glAttachShader(program, shaders[i]);
+    }
+    glBindAttribLocation(program, 0, "a_pos");
+    glBindAttribLocation(program, 1, "a_col");
+    glBindAttribLocation(program, 2, "a_uv");
+    glLinkProgram(program);
+    glDeleteShader(shaders[0]);
+    glDeleteShader(shaders[1]);
+
+    status = GL_FALSE;
+    glGetProgramiv(program, GL_LINK_STATUS, &status);
+    if (!status) {
+
+#   if defined (GLOAD_VERBOSE_ERROR)
+        fprintf(stderr, "gload.h: could not link the immediate-mode shader.\n");
+#   endif /* GLOAD_VERBOSE_ERROR */
+
+        glDeleteProgram(program);
+        return (0);
+    }
+    return (program);
+}
+
+/* `gloadImmediateInit`:
+ *
+ * Install the immediate-mode emulator over the loaded OpenGL functions.
+ * From now on, `glBegin`/`glEnd` and every `glVertex*`, `glColor*` and `glTexCoord*` variant are accumulated
+ * on the CPU (texture coordinates keep `s` and `t` only);
+ * quads, strips, fans and polygons are converted to indexed triangles (line strips and loops to indexed lines).
+ * The batch is drawn when the primitive type or any tracked state changes (`glBindTexture`, `glUseProgram`,
+ * `glEnable`, `glBlendFunc`, `glViewport`, `glClear`, `glDraw*`, `glFlush`, ...) or when it's full.
+ * If no program is bound, the batch is drawn with a built-in shader;
+ * otherwise the bound program is used with attributes: 0 - position, 1 - color, 2 - texture coordinates.
+ * NOTE:
+ *  Call this function after `gloadLoadGL`/`gloadLoadGLLoader`, with the context current.
+ *  Call `gloadImmediateFlush` (or `glFlush`) before swapping the buffers.
+ *
+ * - return: `true` on success, `false` on failure.
+ * */
+GLAPI int   gloadImmediateInit(void) {
+    GLint   value;
+
+    if (g_immediate.init) { return (1); }
+    if (!gloadIsVersionSupported(3, 0) || !glGenVertexArrays || !glCreateProgram) { return (0); }
+
+    memset(&g_immediate, 0, offsetof(struct s_gloadImmediate, orig_glBegin));
+    g_immediate.vertices = (struct s_gloadImmVertex *) malloc(GLOAD_IMMEDIATE_MAX_VERTICES * sizeof(struct s_gloadImmVertex));
+    g_immediate.indices = (GLuint *) malloc(GLOAD_IMMEDIATE_MAX_VERTICES * 3 * sizeof(GLuint));
+    if (!g_immediate.vertices || !g_immediate.indices) {
+        free(g_immediate.vertices), g_immediate.vertices = 0;
+        free(g_immediate.indices), g_immediate.indices = 0;
+        return (0);
+    }
+
+    /* the only query of the array buffer binding, the hooked `glBindBuffer` tracks it from now on... */
+    value = 0;
+    glGetIntegerv(GL_ARRAY_BUFFER_BINDING, &value);
+    g_immediate.user_array = (GLuint) value;
+    g_immediate.program = gloadImmediate_program();
+    if (!g_immediate.program ||
+        !gloadStreamBufferCreate(&g_immediate.stream, GL_ARRAY_BUFFER,
+                                 (GLsizeiptr) (GLOAD_IMMEDIATE_MAX_VERTICES * (sizeof(struct s_gloadImmVertex) + 3 * sizeof(GLuint))), 3)) {
+        if (g_immediate.program) { glDeleteProgram(g_immediate.program), g_immediate.program = 0; }
+        free(g_immediate.vertices), g_immediate.vertices = 0;
+        free(g_immediate.indices), g_immediate.indices = 0;
+        return (0);
+    }
+    glBindBuffer(GL_ARRAY_BUFFER, g_immediate.user_array);
+    g_immediate.u_mvp = glGetUniformLocation(g_immediate.program, "u_mvp");
+    g_immediate.u_textured = glGetUniformLocation(g_immediate.program, "u_textured");
+    gloadImmediateMatrix(0);
+
+    value = 0;
+    glGetIntegerv(GL_CURRENT_PROGRAM, &value);
+    g_immediate.user_program = (GLuint) value;
+    value = 0;
+    glGetIntegerv(GL_VERTEX_ARRAY_BINDING, &value);
+    g_immediate.user_vao = (GLuint) value;
+    value = 0;
+    if (gloadIsVersionSupported(3, 2)) { glGetIntegerv(GL_CONTEXT_PROFILE_MASK, &value); }
+    g_immediate.core = (value & GL_CONTEXT_CORE_PROFILE_BIT) != 0;
+
+    glGenVertexArrays(1, &g_immediate.vao);
+    glBindVertexArray(g_immediate.vao);
+    glEnableVertexAttribArray(0);
+    glEnableVertexAttribArray(1);
+    glEnableVertexAttribArray(2);
+    glBindVertexArray(g_immediate.user_vao);
+
+    g_immediate.col[0] = g_immediate.col[1] = g_immediate.col[2] = g_immediate.col[3] = 255;
+
+    GLOAD_IMMEDIATE_HOOK(glBegin);
+    GLOAD_IMMEDIATE_HOOK(glEnd);
+    for (size_t i = 0; g_immediate_hooks[i].addr; i++) {
+        if (g_immediate_procs[i]) { continue; }
+        g_immediate_procs[i] = *g_immediate_hooks[i].addr;
+        *g_immediate_hooks[i].addr = g_immediate_hooks[i].hook;
+    }
+    GLOAD_IMMEDIATE_HOOK(glBindTexture);
+    GLOAD_IMMEDIATE_HOOK(glBindBuffer);
+    GLOAD_IMMEDIATE_HOOK(glActiveTexture);
+    GLOAD_IMMEDIATE_HOOK(glUseProgram);
+    GLOAD_IMMEDIATE_HOOK(glBindVertexArray);
+    GLOAD_IMMEDIATE_HOOK(glBindFramebuffer);
+    GLOAD_IMMEDIATE_HOOK(glEnable);
+    GLOAD_IMMEDIATE_HOOK(glDisable);
+    GLOAD_IMMEDIATE_HOOK(glBlendFunc);
+    GLOAD_IMMEDIATE_HOOK(glDepthFunc);
+    GLOAD_IMMEDIATE_HOOK(glDepthMask);
+    GLOAD_IMMEDIATE_HOOK(glViewport);
+    GLOAD_IMMEDIATE_HOOK(glScissor);
+    GLOAD_IMMEDIATE_HOOK(glLineWidth);
+    GLOAD_IMMEDIATE_HOOK(glPointSize);
+    GLOAD_IMMEDIATE_HOOK(glClear);
+    GLOAD_IMMEDIATE_HOOK(glDrawArrays);
+    GLOAD_IMMEDIATE_HOOK(glDrawElements);
+    GLOAD_IMMEDIATE_HOOK(glReadPixels);
+    GLOAD_IMMEDIATE_HOOK(glFlush);
+    GLOAD_IMMEDIATE_HOOK(glFinish);
+
+    g_immediate.init = 1;
+    return (1);
+}
+
+/* `gloadImmediateTerminate`:
+ *
+ * Flush the pending batch, restore the original OpenGL functions and delete the emulator's objects.
+ * Hooks another one was installed on top of stay in place and call their original functions from now on.
+ * */
+GLAPI void  gloadImmediateTerminate(void) {
+    if (!g_immediate.init) { return; }
+
+    gloadImmediateFlush();
+
+    GLOAD_IMMEDIATE_UNHOOK(glBegin);
+    GLOAD_IMMEDIATE_UNHOOK(glEnd);
+    for (size_t i = 0; g_immediate_hooks[i].addr; i++) {
+        if (*g_immediate_hooks[i].addr != g_immediate_hooks[i].hook) { continue; }
+        *g_immediate_hooks[i].addr = g_immediate_procs[i];
+        g_immediate_procs[i] = 0;
+    }
+    GLOAD_IMMEDIATE_UNHOOK(glBindTexture);
+    GLOAD_IMMEDIATE_UNHOOK(glBindBuffer);
+    GLOAD_IMMEDIATE_UNHOOK(glActiveTexture);
+    GLOAD_IMMEDIATE_UNHOOK(glUseProgram);
+    GLOAD_IMMEDIATE_UNHOOK(glBindVertexArray);
+    GLOAD_IMMEDIATE_UNHOOK(glBindFramebuffer);
+    GLOAD_IMMEDIATE_UNHOOK(glEnable);
+    GLOAD_IMMEDIATE_UNHOOK(glDisable);
+    GLOAD_IMMEDIATE_UNHOOK(glBlendFunc);
+    GLOAD_IMMEDIATE_UNHOOK(glDepthFunc);
+    GLOAD_IMMEDIATE_UNHOOK(glDepthMask);
+    GLOAD_IMMEDIATE_UNHOOK(glViewport);
+    GLOAD_IMMEDIATE_UNHOOK(glScissor);
+    GLOAD_IMMEDIATE_UNHOOK(glLineWidth);
+    GLOAD_IMMEDIATE_UNHOOK(glPointSize);
+    GLOAD_IMMEDIATE_UNHOOK(glClear);
+    GLOAD_IMMEDIATE_UNHOOK(glDrawArrays);
+    GLOAD_IMMEDIATE_UNHOOK(glDrawElements);
+    GLOAD_IMMEDIATE_UNHOOK(glReadPixels);
+    GLOAD_IMMEDIATE_UNHOOK(glFlush);
+    GLOAD_IMMEDIATE_UNHOOK(glFinish);
+
+    gloadStreamBufferDestroy(&g_immediate.stream);
+    glDeleteVertexArrays(1, &g_immediate.vao);
+    glDeleteProgram(g_immediate.program);
+    free(g_immediate.vertices);
+    free(g_immediate.indices);
+    memset(&g_immediate, 0, offsetof(struct s_gloadImmediate, orig_glBegin));
+}
+
+/* `gloadImmediateMatrix`:
+ *
+ * Set the model-view-projection matrix used by the built-in shader.
+ * The emulator doesn't implement the legacy matrix stack, so this replaces `glOrtho`, `glLoadMatrix` etc.
+ *
+ * - param: `const GLfloat *mvp` - column-major 4x4 matrix, null resets it to identity
+ * */
+GLAPI void  gloadImmediateMatrix(const GLfloat *mvp) {
+    gloadImmediateFlush();
+    for (int i = 0; i < 16; i++) {
+        g_immediate.mvp[i] = mvp ? mvp[i] : (i % 5 == 0 ? 1.0f : 0.0f);
+    }
+    g_immediate.mvp_dirty = 1;
+}
+
+#   undef GLOAD_IMMEDIATE_HOOK
+#   undef GLOAD_IMMEDIATE_UNHOOK
+#  endif /* GLOAD_IMMEDIATE */
+#
+#  if defined (GLOAD_PROGRAM_CACHE)
+
+/* SECTION:
+ *  gload program cache API
+ * * * * * * * * * * * * * */
+
+#   define GLOAD_PROGRAM_CACHE_MAGIC "GLDPCH02"
+
+/* `struct s_gloadProgramCacheHeader` - header of the cache file.
+ * */
+struct s_gloadProgramCacheHeader {
+    char        magic[8];
+    GLuint64    driver;
+    GLuint64    count;
+};
+
+/* `struct s_gloadProgramCacheEntry` - header of a single program binary in the cache file.
+ * `key` indexes the entry, `check` (hash of the same data from another basis) and `sources` (their total length)
+ * confirm a hit. Followed by `length` bytes of the binary, padded to 8 bytes.
+ * */
+struct s_gloadProgramCacheEntry {
+    GLuint64    key;
+    GLuint64    check;
+    GLuint64    sources;
+    GLuint      format;
+    GLuint      length;
+};
+
+/* `struct s_gloadProgramCachePending` - program linked during this run, not yet written to the cache file.
+ * */
+struct s_gloadProgramCachePending {
+    struct s_gloadProgramCachePending   *next;
+    struct s_gloadProgramCacheEntry     entry;
+};
+
+/* `struct s_gloadProgramCacheSlot` - slot of the open-addressing index of the cache.
+ * */
+struct s_gloadProgramCacheSlot {
+    GLuint64                                key;
+    const struct s_gloadProgramCacheEntry   *entry;
+};
+
+static size_t   gloadProgramCache_padded(size_t length) {
+    return ((length + 7) & ~(size_t) 7);
+}
+
+static const struct s_gloadProgramCacheEntry    *gloadProgramCache_find(t_gloadProgramCache *cache, GLuint64 key) {
+    struct s_gloadProgramCacheSlot  *slots;
+    size_t                          i;
+
+    if (!cache->capacity) { return (0); }
+    slots = (struct s_gloadProgramCacheSlot *) cache->index;
+    for (i = (size_t) key & (cache->capacity - 1); slots[i].entry; i = (i + 1) & (cache->capacity - 1)) {
+        if (slots[i].key == key) { return (slots[i].entry); }
+    }
+    return (0);
+}
+
+static int  gloadProgramCache_insert(t_gloadProgramCache *cache, const struct s_gloadProgramCacheEntry *entry) {
+    struct s_gloadProgramCacheSlot  *slots;
+    size_t                          i;
+
+    /* Keep the load factor under 50%... */
+    if ((cache->count + 1) * 2 > cache->capacity) {
+        struct s_gloadProgramCacheSlot  *old;
+        GLuint                          capacity;
+
+        old = (struct s_gloadProgramCacheSlot *) cache->index;
+        capacity = cache->capacity;
+        cache->capacity = capacity ? capacity * 2 : 64;
+        cache->index = calloc(cache->capacity, sizeof(struct s_gloadProgramCacheSlot));
+        if (!cache->index) {
+            cache->index = old, cache->capacity = capacity;
+            return (0);
+        }
+        cache->count = 0;
+        for (GLuint j = 0; j < capacity; j++) {
+            if (old[j].entry) { gloadProgramCache_insert(cache, old[j].entry); }
+        }
+        free(old);
+    }
+
+    slots = (struct s_gloadProgramCacheSlot *) cache->index;
+    for (i = (size_t) entry->key & (cache->capacity - 1); slots[i].entry; i = (i + 1) & (cache->capacity - 1)) {
+        if (slots[i].key == entry->key) {
+            slots[i].entry = entry;
+            return (1);
+        }
+    }
+    slots[i].key = entry->key;
+    slots[i].entry = entry;
+    cache->count++;
+    return (1);
+}
+
+/* `gloadProgramCacheOpen`:
+ *
+ * Open (and memory-map) the cache file. A missing file, or one written by a different driver,
+ * results in an empty cache.
+ * NOTE:
+ *  This function requires a current context and loaded OpenGL functions.
+ *
+ * - param: `t_gloadProgramCache *cache` - cache to initialize
+ * - param: `const char *path` - path to the cache file
+ * - return: `true` on success, `false` on failure.
+ * */
+GLAPI int   gloadProgramCacheOpen(t_gloadProgramCache *cache, const char *path) {
+    const struct s_gloadProgramCacheHeader  *header;
+    const GLubyte                           *cursor;
+    const GLubyte                           *end;
+    const char                              *strings[3];
+    GLint                                   formats;
+    size_t                                  size;
+
+    if (!cache || !path) { return (0); }
+    memset(cache, 0, sizeof(t_gloadProgramCache));
+
+    cache->path = (char *) malloc(strlen(path) + 1);
+    if (!cache->path) { return (0); }
+    memcpy(cache->path, path, strlen(path) + 1);
+
+    strings[0] = (const char *) glGetString(GL_VENDOR);
+    strings[1] = (const char *) glGetString(GL_RENDERER);
+    strings[2] = (const char *) glGetString(GL_VERSION);
+    cache->driver = 0xcbf29ce484222325ull;
+    for (int i = 0; i < 3; i++) {
+        if (strings[i]) { cache->driver = gloadInternal_hash(cache->driver, strings[i], strlen(strings[i]) + 1); }
+    }
+
+    formats = 0;
+    if (glProgramBinary && glGetProgramBinary && glProgramParameteri &&
+        (gloadIsVersionSupported(4, 1) || gloadIsExtensionSupported("GL_ARB_get_program_binary"))) {
+        glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+    }
+    cache->supported = formats > 0;
+    if (!cache->supported) { return (1); }
+
+    cache->mapping = gloadInternal_map(path, &size);
+    cache->size = size;
+    if (!cache->mapping) { return (1); }
+
+    header = (const struct s_gloadProgramCacheHeader *) cache->mapping;
+    if (size < sizeof(struct s_gloadProgramCacheHeader) ||
+        memcmp(header->magic, GLOAD_PROGRAM_CACHE_MAGIC, sizeof(header->magic)) ||
+        header->driver != cache->driver) {
+
+#   if defined (GLOAD_VERBOSE_INFO)
+        fprintf(stdout, "gload.h: program cache %s is invalid or outdated, ignoring.\n", path);
+#   endif /* GLOAD_VERBOSE_INFO */
+
+        gloadInternal_unmap(cache->mapping, size), cache->mapping = 0, cache->size = 0;
+        return (1);
+    }
+
+    cursor = (const GLubyte *) cache->mapping + sizeof(struct s_gloadProgramCacheHeader);
+    end = (const GLubyte *) cache->mapping + size;
+    for (GLuint64 i = 0; i < header->count; i++) {
+        const struct s_gloadProgramCacheEntry   *entry;
+
+        entry = (const struct s_gloadProgramCacheEntry *) cursor;
+        if ((size_t) (end - cursor) < sizeof(struct s_gloadProgramCacheEntry) ||
+            (size_t) (end - cursor) - sizeof(struct s_gloadProgramCacheEntry) < gloadProgramCache_padded(entry->length)) {
+            break;
+        }
+        if (!gloadProgramCache_insert(cache, entry)) { break; }
+        cursor += sizeof(struct s_gloadProgramCacheEntry) + gloadProgramCache_padded(entry->length);
+    }
+    return (1);
+}
+
+/* `gloadProgramCacheClose`:
+ *
+ * Write the programs linked since `gloadProgramCacheOpen` to the cache file and release the cache.
+ *
+ * - param: `t_gloadProgramCache *cache` - cache to close
+ * - return: `true` on success, `false` if the cache file couldn't be written.
+ * */
+GLAPI int   gloadProgramCacheClose(t_gloadProgramCache *cache) {
+    struct s_gloadProgramCacheHeader    header;
+    struct s_gloadProgramCacheSlot      *slots;
+    struct s_gloadProgramCachePending   *pending;
+    char                                *tmp;
+    FILE                                *file;
+    int                                 result;
+
+    if (!cache || !cache->path) { return (0); }
+
+    result = 1;
+    tmp = 0;
+    if (cache->pending) {
+        /* Write every indexed program into a temporary file, then replace the old cache file... */
+        tmp = (char *) malloc(strlen(cache->path) + 5);
+        file = 0;
+        if (tmp) {
+            memcpy(tmp, cache->path, strlen(cache->path));
+            memcpy(tmp + strlen(cache->path), ".tmp", 5);
+            file = fopen(tmp, "wb");
+        }
+        result = file != 0;
+        if (file) {
+            memcpy(header.magic, GLOAD_PROGRAM_CACHE_MAGIC, sizeof(header.magic));
+            header.driver = cache->driver;
+            header.count = cache->count;
+            result = fwrite(&header, sizeof(header), 1, file) == 1;
+
+            slots = (struct s_gloadProgramCacheSlot *) cache->index;
+            for (GLuint i = 0; result && i < cache->capacity; i++) {
+                static const GLubyte    padding[8] = { 0 };
+                size_t                  length;
+
+                if (!slots[i].entry) { continue; }
+                length = slots[i].entry->length;
+                result = fwrite(slots[i].entry, sizeof(struct s_gloadProgramCacheEntry) + length, 1, file) == 1 &&
+                         (gloadProgramCache_padded(length) == length ||
+                          fwrite(padding, gloadProgramCache_padded(length) - length, 1, file) == 1);
+            }
+            result = !fclose(file) && result;
+        }
+    }
+
+    gloadInternal_unmap(cache->mapping, (size_t) cache->size);
+    if (tmp) {
+        if (result) {
+
+#   if defined (GLOAD_WIN32)
+            result = MoveFileExA(tmp, cache->path, MOVEFILE_REPLACE_EXISTING) != 0;
+#   else
+            result = rename(tmp, cache->path) == 0;
+#   endif /* GLOAD_WIN32 */
+
+        }
+        if (!result) { remove(tmp); }
+
+#   if defined (GLOAD_VERBOSE_ERROR)
+        if (!result) { fprintf(stderr, "gload.h: could not write the program cache: %s\n", cache->path); }
+#   endif /* GLOAD_VERBOSE_ERROR */
+
+        free(tmp);
+    }
+
+    while (cache->pending) {
+        pending = (struct s_gloadProgramCachePending *) cache->pending;
+        cache->pending = pending->next;
+        free(pending);
+    }
+    free(cache->index);
+    free(cache->path);
+    memset(cache, 0, sizeof(t_gloadProgramCache));
+    return (result);
+}
+
+/* `gloadProgramCacheLink`:
+ *
+ * Create a program from `count` shader stages.
+ * On a cache hit, the program is created with `glProgramBinary`; otherwise its shaders are compiled,
+ * linked and, with GL_ARB_get_program_binary, retrieved with `glGetProgramBinary` to be stored on close.
+ * NOTE:
+ *  Binding locations must be specified in the sources (`layout (location = ...)`),
+ *  since the program is linked before the caller can access it.
+ *
+ * - param: `t_gloadProgramCache *cache` - cache
+ * - param: `GLsizei count` - number of stages
+ * - param: `const GLenum *types` - type of every stage (i.e. `GL_VERTEX_SHADER`)
+ * - param: `const GLchar *const *sources` - null-terminated source of every stage
+ * - return: name of the linked program on success, 0 on failure.
+ * */
+GLAPI GLuint    gloadProgramCacheLink(t_gloadProgramCache *cache, GLsizei count, const GLenum *types, const GLchar *const *sources) {
+    const struct s_gloadProgramCacheEntry   *entry;
+    struct s_gloadProgramCachePending       *pending;
+    GLuint64                                key;
+    GLuint64                                check;
+    GLuint64                                sources_length;
+    GLuint64                                start;
+    GLuint                                  program;
+    GLint                                   status;
+    GLint                                   length;
+
+    if (!cache || count <= 0 || !types || !sources) { return (0); }
+
+    start = gloadInternal_clock();
+    key = cache->driver;
+    check = 0x84222325cbf29ce4ull;
+    sources_length = 0;
+    for (GLsizei i = 0; i < count; i++) {
+        size_t  size;
+
+        size = strlen(sources[i]) + 1;
+        key = gloadInternal_hash(key, &types[i], sizeof(GLenum));
+        key = gloadInternal_hash(key, sources[i], size);
+        check = gloadInternal_hash(check, &types[i], sizeof(GLenum));
+        check = gloadInternal_hash(check, sources[i], size);
+        sources_length += size;
+    }
+
+    entry = cache->supported ? gloadProgramCache_find(cache, key) : 0;
+    if (entry && (entry->check != check || entry->sources != sources_length)) {
+
+#   if defined (GLOAD_VERBOSE_WARN)
+        fprintf(stderr, "gload.h: program cache key collision, compiling the program.\n");
+#   endif /* GLOAD_VERBOSE_WARN */
+
+        entry = 0;
+    }
+    if (entry) {
+        program = glCreateProgram();
+        glProgramBinary(program, entry->format, entry + 1, (GLsizei) entry->length);
+        status = GL_FALSE;
+        glGetProgramiv(program, GL_LINK_STATUS, &status);
+        if (status) {
+            cache->hits++;
+            cache->load_ns += gloadInternal_clock() - start;
+            return (program);
+        }
+
+        /* The driver rejected the binary, we need to compile it again... */
+        glDeleteProgram(program);
+    }
+
+    program = glCreateProgram();
+    for (GLsizei i = 0; i < count; i++) {
+        GLuint  shader;
+
+        shader = glCreateShader(types[i]);
+        glShaderSource(shader, 1, &sources[i], 0);
+        glCompileShader(shader);
+
+#   if defined (GLOAD_VERBOSE_ERROR)
+        status = GL_FALSE;
+        glGetShaderiv(shader, GL_COMPILE_STATUS, &status);
+        if (!status) {
+            GLchar  log[512];
+
+            glGetShaderInfoLog(shader, sizeof(log), 0, log);
+            fprintf(stderr, "gload.h: could not compile a shader: %s\n", log);
+        }
+#   endif /* GLOAD_VERBOSE_ERROR */
+
+        glAttachShader(program, shader);
+        glDeleteShader(shader);
+    }
+    if (cache->supported) {
+        glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    }
+    glLinkProgram(program);
+
+    cache->misses++;
+    status = GL_FALSE;
+    glGetProgramiv(program, GL_LINK_STATUS, &status);
+    if (!status) {
+
+#   if defined (GLOAD_VERBOSE_ERROR)
+        GLchar  log[512];
+
+        glGetProgramInfoLog(program, sizeof(log), 0, log);
+        fprintf(stderr, "gload.h: could not link a program: %s\n", log);
+#   endif /* GLOAD_VERBOSE_ERROR */
+
+        glDeleteProgram(program);
+        cache->compile_ns += gloadInternal_clock() - start;
+        return (0);
+    }
+
+    length = 0;
+    if (cache->supported) { glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length); }
+    if (length > 0) {
+        pending = (struct s_gloadProgramCachePending *) malloc(sizeof(struct s_gloadProgramCachePending) + (size_t) length);
+        if (pending) {
+            GLenum  format;
+
+            format = 0;
+            glGetProgramBinary(program, length, &length, &format, &pending->entry + 1);
+            pending->entry.key = key;
+            pending->entry.check = check;
+            pending->entry.sources = sources_length;
+            pending->entry.format = format;
+            pending->entry.length = (GLuint) length;
+            if (length > 0 && gloadProgramCache_insert(cache, &pending->entry)) {
+                pending->next = (struct s_gloadProgramCachePending *) cache->pending;
+                cache->pending = pending;
+            }
+            else {
+                free(pending);
+            }
+        }
+    }
+    cache->compile_ns += gloadInternal_clock() - start;
+    return (program);
+}
+
+#   undef GLOAD_PROGRAM_CACHE_MAGIC
+#  endif /* GLOAD_PROGRAM_CACHE */
+#
+#  if defined (GLOAD_PROGRAM_BUILDER)
+
+/* SECTION:
+ *  gload program builder API
+ * * * * * * * * * * * * * * */
+
+/* `struct s_gloadProgramJob` - single program submitted to the builder.
+ * */
+struct s_gloadProgramJob {
+    struct s_gloadProgramJob    *next;
+    GLuint                      program;
+    GLint                       status;
+    GLsync                      fence;
+    GLsizei                     count;
+    GLenum                      types[GLOAD_PROGRAM_BUILDER_MAX_STAGES];
+    GLchar                      *sources[GLOAD_PROGRAM_BUILDER_MAX_STAGES];
+    t_gloadProgramCallback      callback;
+    void                        *user;
+};
+
+/* `struct s_gloadProgramWorker` - worker thread and the shared context it owns.
+ * */
+struct s_gloadProgramWorker {
+    t_gloadInternalThread           thread;
+    void                            *context;
+    struct s_gloadProgramWorkers    *workers;
+};
+
+/* `struct s_gloadProgramWorkers` - state shared between the builder and its worker threads.
+ * `queue` holds the jobs waiting for a worker, `done` the fenced jobs waiting for `gloadProgramBuilderPoll`.
+ * `ready` and `dead` count the workers that did / didn't make their context current.
+ * */
+struct s_gloadProgramWorkers {
+    t_gloadInternalMutex        mutex;
+    t_gloadInternalCond         work;
+    t_gloadInternalCond         finished;
+    struct s_gloadProgramJob    *queue;
+    struct s_gloadProgramJob    **queue_tail;
+    struct s_gloadProgramJob    *done;
+    struct s_gloadProgramJob    **done_tail;
+    GLuint                      outstanding;
+    GLuint                      ready;
+    GLuint                      dead;
+    int                         stop;
+    t_gloadMakeCurrent          make_current;
+    GLuint                      count;
+    struct s_gloadProgramWorker worker[1];
+};
+
+static void gloadProgramBuilder_free(struct s_gloadProgramJob *job) {
+    for (GLsizei i = 0; i < job->count; i++) { free(job->sources[i]); }
+    free(job);
+}
+
+/* Compile and link the program of `job`, on the calling thread; without `wait`, the link status is not queried... */
+static void gloadProgramBuilder_link(struct s_gloadProgramJob *job, int wait) {
+    job->program = glCreateProgram();
+    for (GLsizei i = 0; i < job->count; i++) {
+        GLuint  shader;
+
+        shader = glCreateShader(job->types[i]);
+        glShaderSource(shader, 1, (const GLchar *const *) &job->sources[i], 0);
+        glCompileShader(shader);
+        glAttachShader(job->program, shader);
+        glDeleteShader(shader);
+    }
+    glLinkProgram(job->program);
+
+    if (wait) {
+        job->status = GL_FALSE;
+        glGetProgramiv(job->program, GL_LINK_STATUS, &job->status);
+    }
+}
+
+GLOAD_INTERNAL_THREADPROC(gloadProgramBuilder_worker, arg) {
+    struct s_gloadProgramWorker     *worker;
+    struct s_gloadProgramWorkers    *workers;
+    struct s_gloadProgramJob        *job;
+
+    worker = (struct s_gloadProgramWorker *) arg;
+    workers = worker->workers;
+    if (!workers->make_current(worker->context)) {
+        gloadInternal_mutexLock(&workers->mutex);
+        workers->dead++;
+        gloadInternal_condBroadcast(&workers->finished);
+        gloadInternal_mutexUnlock(&workers->mutex);
+        GLOAD_INTERNAL_THREADEXIT;
+    }
+
+    gloadInternal_mutexLock(&workers->mutex);
+    workers->ready++;
+    gloadInternal_condBroadcast(&workers->finished);
+    for (;;) {
+        while (!workers->queue && !workers->stop) {
+            gloadInternal_condWait(&workers->work, &workers->mutex);
+        }
+        if (!workers->queue) { break; }
+
+        job = workers->queue;
+        workers->queue = job->next;
+        if (!workers->queue) { workers->queue_tail = &workers->queue; }
+        gloadInternal_mutexUnlock(&workers->mutex);
+
+        gloadProgramBuilder_link(job, 1);
+        job->fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        glFlush();
+
+        gloadInternal_mutexLock(&workers->mutex);
+        job->next = 0;
+        *workers->done_tail = job;
+        workers->done_tail = &job->next;
+        workers->outstanding--;
+        gloadInternal_condBroadcast(&workers->finished);
+    }
+    gloadInternal_mutexUnlock(&workers->mutex);
+
+    workers->make_current(0);
+    GLOAD_INTERNAL_THREADEXIT;
+}
+
+/* Append `job` to the jobs waiting for `gloadProgramBuilderPoll`, keeping them in FIFO order... */
+static void gloadProgramBuilder_append(t_gloadProgramBuilder *builder, struct s_gloadProgramJob *job) {
+    job->next = 0;
+    if (builder->pending_last) { ((struct s_gloadProgramJob *) builder->pending_last)->next = job; }
+    else { builder->pending = job; }
+    builder->pending_last = job;
+}
+
+/* Call the callbacks of the finished programs; with `wait`, block until every program is finished... */
+static GLuint   gloadProgramBuilder_poll(t_gloadProgramBuilder *builder, int wait) {
+    struct s_gloadProgramWorkers    *workers;
+    struct s_gloadProgramJob        *job;
+
+    workers = (struct s_gloadProgramWorkers *) builder->workers;
+    if (workers) {
+        gloadInternal_mutexLock(&workers->mutex);
+        while (wait && workers->outstanding) {
+            gloadInternal_condWait(&workers->finished, &workers->mutex);
+        }
+        while (workers->done) {
+            job = workers->done;
+            workers->done = job->next;
+            gloadProgramBuilder_append(builder, job);
+        }
+        workers->done_tail = &workers->done;
+        gloadInternal_mutexUnlock(&workers->mutex);
+    }
+
+    /* An unfinished program holds back the ones after it, so callbacks stay in FIFO order... */
+    while (builder->pending) {
+        job = (struct s_gloadProgramJob *) builder->pending;
+        if (job->fence) {
+            GLenum  result;
+
+            result = glClientWaitSync(job->fence, wait ? GL_SYNC_FLUSH_COMMANDS_BIT : 0, wait ? 0xFFFFFFFFFFFFFFFFull : 0);
+            if (result == GL_TIMEOUT_EXPIRED) { break; }
+            glDeleteSync(job->fence), job->fence = 0;
+        }
+        else if (builder->parallel) {
+            GLint   completed;
+
+            completed = GL_TRUE;
+            if (!wait) { glGetProgramiv(job->program, GL_COMPLETION_STATUS_KHR, &completed); }
+            if (!completed) { break; }
+            job->status = GL_FALSE;
+            glGetProgramiv(job->program, GL_LINK_STATUS, &job->status);
+        }
+
+        builder->pending = job->next;
+        if (!builder->pending) { builder->pending_last = 0; }
+        builder->completed++;
+        if (!job->status) {
+            builder->failed++;
+
+#   if defined (GLOAD_VERBOSE_ERROR)
+            GLchar  log[512];
+
+            log[0] = '\0';
+            glGetProgramInfoLog(job->program, sizeof(log), 0, log);
+            fprintf(stderr, "gload.h: could not link a program: %s\n", log);
+#   endif /* GLOAD_VERBOSE_ERROR */
+
+        }
+        if (job->callback) { job->callback(job->program, job->status, job->user); }
+        gloadProgramBuilder_free(job);
+    }
+    return (builder->submitted - builder->completed);
+}
+
+/* `gloadProgramBuilderCreate`:
+ *
+ * Initialize the program builder.
+ * NOTE:
+ *  This function requires a current context and loaded OpenGL functions.
+ *  The shared contexts must not be current on any thread.
+ *  It fails if a worker thread can't make its context current.
+ *
+ * - param: `t_gloadProgramBuilder *builder` - builder to initialize
+ * - param: `GLuint threads` - number of driver compiler threads, 0 for the driver's maximum
+ * - param: `t_gloadMakeCurrent make_current` - procedure binding a shared context (may be null)
+ * - param: `void *const *contexts` - contexts shared with the current one, one per worker thread (may be null)
+ * - param: `GLuint count` - number of shared contexts
+ * - return: `true` on success, `false` on failure.
+ * */
+GLAPI int   gloadProgramBuilderCreate(t_gloadProgramBuilder *builder, GLuint threads, t_gloadMakeCurrent make_current, void *const *contexts, GLuint count) {
+    struct s_gloadProgramWorkers    *workers;
+
+    if (!builder) { return (0); }
+    memset(builder, 0, sizeof(t_gloadProgramBuilder));
+
+    if (glMaxShaderCompilerThreadsKHR && gloadIsExtensionSupported("GL_KHR_parallel_shader_compile")) {
+        glMaxShaderCompilerThreadsKHR(threads ? threads : 0xFFFFFFFF);
+        builder->parallel = 1;
+        return (1);
+    }
+    if (glMaxShaderCompilerThreadsARB && gloadIsExtensionSupported("GL_ARB_parallel_shader_compile")) {
+        glMaxShaderCompilerThreadsARB(threads ? threads : 0xFFFFFFFF);
+        builder->parallel = 1;
+        return (1);
+    }
+    if (!make_current || !contexts || !count || !glFenceSync || !glClientWaitSync) { return (1); }
+
+    workers = (struct s_gloadProgramWorkers *) calloc(1, sizeof(struct s_gloadProgramWorkers) +
+                                                         (count - 1) * sizeof(struct s_gloadProgramWorker));
+    if (!workers) { return (0); }
+    gloadInternal_mutexInit(&workers->mutex);
+    gloadInternal_condInit(&workers->work);
+    gloadInternal_condInit(&workers->finished);
+    workers->queue_tail = &workers->queue;
+    workers->done_tail = &workers->done;
+    workers->make_current = make_current;
+    builder->workers = workers;
+
+    for (GLuint i = 0; i < count; i++) {
+        workers->worker[i].context = contexts[i];
+        workers->worker[i].workers = workers;
+        if (!gloadInternal_threadCreate(&workers->worker[i].thread, gloadProgramBuilder_worker, &workers->worker[i])) {
+            gloadProgramBuilderDestroy(builder);
+            return (0);
+        }
+        workers->count++;
+    }
+
+    /* a worker without a current context would run its jobs on no context at all... */
+    gloadInternal_mutexLock(&workers->mutex);
+    while (workers->ready + workers->dead < workers->count) {
+        gloadInternal_condWait(&workers->finished, &workers->mutex);
+    }
+    gloadInternal_mutexUnlock(&workers->mutex);
+    if (workers->dead) {
+
+#   if defined (GLOAD_VERBOSE_ERROR)
+        fprintf(stderr, "gload.h: a program builder worker could not make its context current.\n");
+#   endif /* GLOAD_VERBOSE_ERROR */
+
+        gloadProgramBuilderDestroy(builder);
+        return (0);
+    }
+    return (1);
+}
+
+/* `gloadProgramBuilderDestroy`:
+ *
+ * Finish every submitted program and stop the worker threads.
+ *
+ * - param: `t_gloadProgramBuilder *builder` - builder to destroy
+ * */
+GLAPI void  gloadProgramBuilderDestroy(t_gloadProgramBuilder *builder) {
+    struct s_gloadProgramWorkers    *workers;
+
+    if (!builder) { return; }
+
+    gloadProgramBuilder_poll(builder, 1);
+    workers = (struct s_gloadProgramWorkers *) builder->workers;
+    if (workers) {
+        gloadInternal_mutexLock(&workers->mutex);
+        workers->stop = 1;
+        gloadInternal_condBroadcast(&workers->work);
+        gloadInternal_mutexUnlock(&workers->mutex);
+        for (GLuint i = 0; i < workers->count; i++) {
+            gloadInternal_threadJoin(&workers->worker[i].thread);
+        }
+        gloadInternal_condDestroy(&workers->finished);
+        gloadInternal_condDestroy(&workers->work);
+        gloadInternal_mutexDestroy(&workers->mutex);
+        free(workers);
+    }
+    memset(builder, 0, sizeof(t_gloadProgramBuilder));
+}
+
+/* `gloadProgramBuilderSubmit`:
+ *
+ * Submit a program of `count` shader stages to be compiled and linked.
+ * The sources are copied, so they can be released right after submission.
+ * NOTE:
+ *  Binding locations must be specified in the sources (`layout (location = ...)`).
+ *
+ * - param: `t_gloadProgramBuilder *builder` - builder
+ * - param: `GLsizei count` - number of stages (1 - GLOAD_PROGRAM_BUILDER_MAX_STAGES)
+ * - param: `const GLenum *types` - type of every stage (i.e. `GL_VERTEX_SHADER`)
+ * - param: `const GLchar *const *sources` - null-terminated source of every stage
+ * - param: `t_gloadProgramCallback callback` - procedure called once the program is linked
+ * - param: `void *user` - user pointer passed to the callback
+ * - return: `true` on success, `false` on failure.
+ * */
+GLAPI int   gloadProgramBuilderSubmit(t_gloadProgramBuilder *builder, GLsizei count, const GLenum *types, const GLchar *const *sources, t_gloadProgramCallback callback, void *user) {
+    struct s_gloadProgramWorkers    *workers;
+    struct s_gloadProgramJob        *job;
+
+    if (!builder || count <= 0 || count > GLOAD_PROGRAM_BUILDER_MAX_STAGES || !types || !sources) { return (0); }
+
+    job = (struct s_gloadProgramJob *) calloc(1, sizeof(struct s_gloadProgramJob));
+    if (!job) { return (0); }
+    job->callback = callback;
+    job->user = user;
+    for (GLsizei i = 0; i < count; i++) {
+        size_t  length;
+
+        length = strlen(sources[i]) + 1;
+        job->sources[i] = (GLchar *) malloc(length);
+        if (!job->sources[i]) {
+            gloadProgramBuilder_free(job);
+            return (0);
+        }
+        memcpy(job->sources[i], sources[i], length);
+        job->types[i] = types[i];
+        job->count++;
+    }
+    builder->submitted++;
+
+    workers = (struct s_gloadProgramWorkers *) builder->workers;
+    if (workers) {
+        gloadInternal_mutexLock(&workers->mutex);
+        *workers->queue_tail = job;
+        workers->queue_tail = &job->next;
+        workers->outstanding++;
+        gloadInternal_condBroadcast(&workers->work);
+        gloadInternal_mutexUnlock(&workers->mutex);
+        return (1);
+    }
+
+    /* With parallel compilation, the link status is queried in `gloadProgramBuilderPoll`... */
+    gloadProgramBuilder_link(job, !builder->parallel);
+    gloadProgramBuilder_append(builder, job);
+    return (1);
+}
+
+/* `gloadProgramBuilderPoll`:
+ *
+ * Call the callbacks of every program that finished linking, without blocking.
+ *
+ * - param: `t_gloadProgramBuilder *builder` - builder
+ * - return: number of programs still being built.
+ * */
+GLAPI GLuint    gloadProgramBuilderPoll(t_gloadProgramBuilder *builder) {
+    if (!builder) { return (0); }
+    return (gloadProgramBuilder_poll(builder, 0));
+}
+
+/* `gloadProgramBuilderFinish`:
+ *
+ * Block until every submitted program is linked and its callback was called.
+ *
+ * - param: `t_gloadProgramBuilder *builder` - builder
+ * */
+GLAPI void  gloadProgramBuilderFinish(t_gloadProgramBuilder *builder) {
+    if (!builder) { return; }
+    gloadProgramBuilder_poll(builder, 1);
+}
+
+#  endif /* GLOAD_PROGRAM_BUILDER */
+#
+#  if defined (GLOAD_TEXTURE_UPLOADER)
+
+/* SECTION:
+ *  gload texture uploader API
+ * * * * * * * * * * * * * * */
+
+/* `struct s_gloadTextureRequest` - upload submitted to the ring.
+ * `span` is the size of the pixels plus the bytes skipped at the end of the ring when it wrapped around.
+ * */
+struct s_gloadTextureRequest {
+    t_gloadTextureUpload    upload;
+    GLsizeiptr              offset;
+    GLsizeiptr              size;
+    GLsizeiptr              span;
+    int                     committed;
+};
+
+/* `struct s_gloadTextureBatch` - uploads issued by a single `gloadTextureUploaderProcess`, guarded by a fence.
+ * */
+struct s_gloadTextureBatch {
+    GLsync      fence;
+    GLuint64    end;
+};
+
+/* `struct s_gloadTextureUploaderState` - ring and request queues, guarded by `mutex`.
+ * Requests are addressed by sequence numbers: [retired, issued) are executing, [issued, reserved) are being copied or waiting.
+ * `copying` counts the copies in progress and `unmapped` is set while a non-persistent ring is unmapped.
+ * */
+struct s_gloadTextureUploaderState {
+    t_gloadInternalMutex            mutex;
+    t_gloadInternalCond             space;
+    t_gloadInternalCond             copied;
+    GLsizeiptr                      head;
+    GLsizeiptr                      used;
+    GLuint                          copying;
+    int                             unmapped;
+    GLuint64                        reserved;
+    GLuint64                        issued;
+    GLuint64                        retired;
+    GLuint64                        batch_head;
+    GLuint64                        batch_tail;
+    struct s_gloadTextureRequest    requests[GLOAD_TEXTURE_UPLOADER_MAX_REQUESTS];
+    struct s_gloadTextureBatch      batches[GLOAD_TEXTURE_UPLOADER_MAX_REQUESTS];
+};
+
+/* Retire the requests of signalled batches. With `wait`, block until every batch is signalled... */
+static void gloadTextureUploader_retire(t_gloadTextureUploader *uploader, int wait) {
+    struct s_gloadTextureUploaderState  *state;
+    struct s_gloadTextureBatch          *batch;
+    GLenum                              result;
+
+    state = (struct s_gloadTextureUploaderState *) uploader->state;
+    gloadInternal_mutexLock(&state->mutex);
+    while (state->batch_tail < state->batch_head) {
+        batch = &state->batches[state->batch_tail % GLOAD_TEXTURE_UPLOADER_MAX_REQUESTS];
+        if (batch->fence) {
+            result = glClientWaitSync(batch->fence, wait ? GL_SYNC_FLUSH_COMMANDS_BIT : 0, wait ? 0xFFFFFFFFFFFFFFFFull : 0);
+            if (result == GL_TIMEOUT_EXPIRED) { break; }
+            glDeleteSync(batch->fence), batch->fence = 0;
+        }
+        for (; state->retired < batch->end; state->retired++) {
+            state->used -= state->requests[state->retired % GLOAD_TEXTURE_UPLOADER_MAX_REQUESTS].span;
+        }
+        state->batch_tail++;
+        gloadInternal_condBroadcast(&state->space);
+    }
+    gloadInternal_mutexUnlock(&state->mutex);
+}
+
+/* `gloadTextureUploaderCreate`:
+ *
+ * Create a texture uploader with a ring of `capacity` bytes.
+ * NOTE:
+ *  This function requires a current context and loaded OpenGL functions.
+ *
+ * - param: `t_gloadTextureUploader *uploader` - uploader to initialize
+ * - param: `GLsizeiptr capacity` - size of the ring in bytes; limits the size of a single upload
+ * - return: `true` on success, `false` on failure.
+ * */
+GLAPI int   gloadTextureUploaderCreate(t_gloadTextureUploader *uploader, GLsizeiptr capacity) {
+    struct s_gloadTextureUploaderState  *state;
+    GLbitfield                          flags;
+
+    if (!uploader) { return (0); }
+    memset(uploader, 0, sizeof(t_gloadTextureUploader));
+    if (capacity <= 0) { return (0); }
+
+    state = (struct s_gloadTextureUploaderState *) calloc(1, sizeof(struct s_gloadTextureUploaderState));
+    if (!state) { return (0); }
+    gloadInternal_mutexInit(&state->mutex);
+    gloadInternal_condInit(&state->space);
+    gloadInternal_condInit(&state->copied);
+    uploader->state = state;
+    uploader->capacity = capacity;
+    uploader->dsa = glTextureSubImage1D && glTextureSubImage2D && glTextureSubImage3D &&
+                    (gloadIsVersionSupported(4, 5) || gloadIsExtensionSupported("GL_ARB_direct_state_access"));
+
+    if (glBufferStorage && glMapBufferRange && glFenceSync && glClientWaitSync && glDeleteSync &&
+        (gloadIsVersionSupported(4, 4) || gloadIsExtensionSupported("GL_ARB_buffer_storage"))) {
+        flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+        glGenBuffers(1, &uploader->buffer);
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, uploader->buffer);
+        glBufferStorage(GL_PIXEL_UNPACK_BUFFER, capacity, 0, flags);
+        uploader->mapping = (GLubyte *) glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, capacity, flags);
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+        if (uploader->mapping) {
+            uploader->persistent = 1;
+            return (1);
+        }
+        glDeleteBuffers(1, &uploader->buffer), uploader->buffer = 0;
+    }
+
+    /* Fallback: a pixel-unpack buffer, mapped without synchronization; the fences keep the uploads in flight safe... */
+    if (glMapBufferRange && glUnmapBuffer && glFenceSync && glClientWaitSync && glDeleteSync &&
+        (gloadIsVersionSupported(3, 2) || (gloadIsExtensionSupported("GL_ARB_map_buffer_range") &&
+                                           gloadIsExtensionSupported("GL_ARB_sync")))) {
+        flags = GL_MAP_WRITE_BIT | GL_MAP_UNSYNCHRONIZED_BIT;
+        glGenBuffers(1, &uploader->buffer);
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, uploader->buffer);
+        glBufferData(GL_PIXEL_UNPACK_BUFFER, capacity, 0, GL_STREAM_DRAW);
+        uploader->mapping = (GLubyte *) glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, capacity, flags);
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+        if (uploader->mapping) { return (1); }
+        glDeleteBuffers(1, &uploader->buffer), uploader->buffer = 0;
+    }
+
+    /* Last resort: the ring lives in CPU memory and every upload is sourced from there... */
+    uploader->mapping = (GLubyte *) malloc((size_t) capacity);
+    if (!uploader->mapping) {
+        gloadTextureUploaderDestroy(uploader);
+        return (0);
+    }
+    return (1);
+}
+
+/* `gloadTextureUploaderDestroy`:
+ *
+ * Wait for every upload in flight and release the uploader.
+ * Must be called on the rendering thread, after the submitting threads are done.
+ *
+ * - param: `t_gloadTextureUploader *uploader` - uploader to destroy
+ * */
+GLAPI void  gloadTextureUploaderDestroy(t_gloadTextureUploader *uploader) {
+    struct s_gloadTextureUploaderState  *state;
+
+    if (!uploader || !uploader->state) { return; }
+
+    state = (struct s_gloadTextureUploaderState *) uploader->state;
+    if (uploader->mapping) { gloadTextureUploaderProcess(uploader); }
+    gloadTextureUploader_retire(uploader, 1);
+    if (uploader->buffer) {
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, uploader->buffer);
+        if (uploader->mapping) { glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER); }
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+        glDeleteBuffers(1, &uploader->buffer);
+    }
+    else {
+        free(uploader->mapping);
+    }
+    gloadInternal_condDestroy(&state->copied);
+    gloadInternal_condDestroy(&state->space);
+    gloadInternal_mutexDestroy(&state->mutex);
+    free(state);
+    memset(uploader, 0, sizeof(t_gloadTextureUploader));
+}
+
+/* `gloadTextureUploaderSubmit`:
+ *
+ * Copy `size` bytes of `pixels` into the ring and queue an upload into `upload->texture`.
+ * Can be called from any thread. Doesn't call into OpenGL.
+ *
+ * - param: `t_gloadTextureUploader *uploader` - uploader
+ * - param: `const t_gloadTextureUpload *upload` - destination of the upload
+ * - param: `const void *pixels` - tightly packed source pixels
+ * - param: `GLsizeiptr size` - size of the source pixels in bytes
+ * - param: `int wait` - if the ring is full: `true` to wait for space, `false` to fail
+ *   (never wait on the rendering thread, since it's the one freeing the space)
+ * - return: ticket of the upload on success, 0 on failure.
+ * */
+GLAPI GLuint64  gloadTextureUploaderSubmit(t_gloadTextureUploader *uploader, const t_gloadTextureUpload *upload, const void *pixels, GLsizeiptr size, int wait) {
+    struct s_gloadTextureUploaderState  *state;
+    struct s_gloadTextureRequest        *request;
+    GLsizeiptr                          aligned;
+    GLsizeiptr                          waste;
+    GLubyte                             *mapping;
+    GLuint64                            seq;
+    int                                 wrap;
+    int                                 stalled;
+
+    if (!uploader || !uploader->state || !upload || !pixels || size <= 0) { return (0); }
+
+    /* Keep every request aligned for any pixel type... */
+    aligned = (size + 63) & ~(GLsizeiptr) 63;
+    if (aligned > uploader->capacity) { return (0); }
+
+    state = (struct s_gloadTextureUploaderState *) uploader->state;
+    stalled = 0;
+    gloadInternal_mutexLock(&state->mutex);
+    for (;;) {
+        /* an unmapped ring is only remapped by the rendering thread, which never waits here... */
+        while (state->unmapped) { gloadInternal_condWait(&state->space, &state->mutex); }
+        if (!uploader->mapping) {
+            gloadInternal_mutexUnlock(&state->mutex);
+            return (0);
+        }
+
+        /* an empty ring starts over, otherwise the request wraps to 0 when the gap at the end is too small... */
+        if (!state->used) { state->head = 0; }
+        wrap = state->head + aligned > uploader->capacity;
+        waste = wrap ? uploader->capacity - state->head : 0;
+        if (state->reserved - state->retired < GLOAD_TEXTURE_UPLOADER_MAX_REQUESTS &&
+            state->used + waste + aligned <= uploader->capacity) {
+            break;
+        }
+        if (!wait) {
+            gloadInternal_mutexUnlock(&state->mutex);
+            return (0);
+        }
+        stalled = 1;
+        gloadInternal_condWait(&state->space, &state->mutex);
+    }
+
+    seq = state->reserved++;
+    request = &state->requests[seq % GLOAD_TEXTURE_UPLOADER_MAX_REQUESTS];
+    request->upload = *upload;
+    request->offset = wrap ? 0 : state->head;
+    request->size = size;
+    request->span = waste + aligned;
+    request->committed = 0;
+    state->head = request->offset + aligned;
+    state->used += request->span;
+    state->copying++;
+    mapping = uploader->mapping;
+    uploader->stalls += (GLuint64) stalled;
+    gloadInternal_mutexUnlock(&state->mutex);
+
+    memcpy(mapping + request->offset, pixels, (size_t) size);
+
+    gloadInternal_mutexLock(&state->mutex);
+    request->committed = 1;
+    if (!--state->copying) { gloadInternal_condBroadcast(&state->copied); }
+    gloadInternal_mutexUnlock(&state->mutex);
+    return (seq + 1);
+}
+
+/* `gloadTextureUploader_binding`:
+ *
+ * - return: binding query of the texture target `target` is bound to, 0 if unknown.
+ * */
+static GLenum   gloadTextureUploader_binding(GLenum target) {
+    switch (target) {
+        case (GL_TEXTURE_1D):               { return (GL_TEXTURE_BINDING_1D); }
+        case (GL_TEXTURE_2D):               { return (GL_TEXTURE_BINDING_2D); }
+        case (GL_TEXTURE_3D):               { return (GL_TEXTURE_BINDING_3D); }
+        case (GL_TEXTURE_1D_ARRAY):         { return (GL_TEXTURE_BINDING_1D_ARRAY); }
+        case (GL_TEXTURE_2D_ARRAY):         { return (GL_TEXTURE_BINDING_2D_ARRAY); }
+        case (GL_TEXTURE_RECTANGLE):        { return (GL_TEXTURE_BINDING_RECTANGLE); }
+        case (GL_TEXTURE_CUBE_MAP):         { return (GL_TEXTURE_BINDING_CUBE_MAP); }
+        case (GL_TEXTURE_CUBE_MAP_ARRAY):   { return (GL_TEXTURE_BINDING_CUBE_MAP_ARRAY); }
+    }
+    return (0);
+}
+
+/* `gloadTextureUploader_pixelStore`:
+ *
+ * Set the unpack pixel-store state for tightly packed rows, or back to the defaults.
+ * */
+static void gloadTextureUploader_pixelStore(int packed) {
+    glPixelStorei(GL_UNPACK_ALIGNMENT, packed ? 1 : 4);
+    if (packed) {
+        glPixelStorei(GL_UNPACK_SWAP_BYTES, GL_FALSE);
+        glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+        glPixelStorei(GL_UNPACK_IMAGE_HEIGHT, 0);
+        glPixelStorei(GL_UNPACK_SKIP_ROWS, 0);
+        glPixelStorei(GL_UNPACK_SKIP_PIXELS, 0);
+        glPixelStorei(GL_UNPACK_SKIP_IMAGES, 0);
+    }
+}
+
+/* `gloadTextureUploaderProcess`:
+ *
+ * Issue the copied uploads and retire the ones the GPU has finished.
+ * Must be called on the rendering thread, i.e. once per frame.
+ *
+ * - param: `t_gloadTextureUploader *uploader` - uploader
+ * */
+GLAPI void  gloadTextureUploaderProcess(t_gloadTextureUploader *uploader) {
+    struct s_gloadTextureUploaderState  *state;
+    struct s_gloadTextureBatch          *batch;
+    GLsync                              fence;
+    GLuint64                            first;
+    GLuint64                            last;
+    GLenum                              targets[8];
+    GLint                               bindings[8];
+    GLuint                              count;
+
+    if (!uploader || !uploader->state) { return; }
+
+    gloadTextureUploader_retire(uploader, 0);
+
+    /* Only the copied prefix of the queue can be issued, to keep the ring in order;
+     * a non-persistent ring is unmapped first, so it waits for the copies in progress... */
+    state = (struct s_gloadTextureUploaderState *) uploader->state;
+    gloadInternal_mutexLock(&state->mutex);
+    if (state->issued == state->reserved) {
+        gloadInternal_mutexUnlock(&state->mutex);
+        return;
+    }
+    if (uploader->buffer && !uploader->persistent) {
+        state->unmapped = 1;
+        while (state->copying) { gloadInternal_condWait(&state->copied, &state->mutex); }
+    }
+    first = last = state->issued;
+    while (last < state->reserved && state->requests[last % GLOAD_TEXTURE_UPLOADER_MAX_REQUESTS].committed) { last++; }
+    gloadInternal_mutexUnlock(&state->mutex);
+    if (first == last) { return; }
+
+    gloadTextureUploader_pixelStore(1);
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, uploader->buffer);
+    if (state->unmapped) { glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER); }
+    count = 0;
+    for (GLuint64 seq = first; seq < last; seq++) {
+        const struct s_gloadTextureRequest  *request;
+        const t_gloadTextureUpload          *upload;
+        const void                          *pixels;
+
+        request = &state->requests[seq % GLOAD_TEXTURE_UPLOADER_MAX_REQUESTS];
+        upload = &request->upload;
+        pixels = uploader->buffer ? (const void *) (GLintptr) request->offset : (const void *) (uploader->mapping + request->offset);
+        if (uploader->dsa) {
+            if (upload->depth > 0) {
+                glTextureSubImage3D(upload->texture, upload->level, upload->x, upload->y, upload->z,
+                                    upload->width, upload->height, upload->depth, upload->format, upload->type, pixels);
+            }
+            else if (upload->target == GL_TEXTURE_1D) {
+                glTextureSubImage1D(upload->texture, upload->level, upload->x, upload->width, upload->format, upload->type, pixels);
+            }
+            else {
+                glTextureSubImage2D(upload->texture, upload->level, upload->x, upload->y,
+                                    upload->width, upload->height, upload->format, upload->type, pixels);
+            }
+        }
+        else {
+            GLenum  target;
+            GLuint  i;
+
+            /* cube map faces are uploaded through the cube map binding, which is saved once per target... */
+            target = upload->target;
+            if (target >= GL_TEXTURE_CUBE_MAP_POSITIVE_X && target <= GL_TEXTURE_CUBE_MAP_NEGATIVE_Z) { target = GL_TEXTURE_CUBE_MAP; }
+            for (i = 0; i < count && targets[i] != target; i++) { }
+            if (i == count && count < sizeof(targets) / sizeof(targets[0]) && gloadTextureUploader_binding(target)) {
+                targets[count] = target;
+                bindings[count] = 0;
+                glGetIntegerv(gloadTextureUploader_binding(target), &bindings[count]);
+                count++;
+            }
+            glBindTexture(target, upload->texture);
+            if (upload->depth > 0) {
+                glTexSubImage3D(upload->target, upload->level, upload->x, upload->y, upload->z,
+                                upload->width, upload->height, upload->depth, upload->format, upload->type, pixels);
+            }
+            else if (upload->target == GL_TEXTURE_1D) {
+                glTexSubImage1D(upload->target, upload->level, upload->x, upload->width, upload->format, upload->type, pixels);
+            }
+            else {
+                glTexSubImage2D(upload->target, upload->level, upload->x, upload->y,
+                                upload->width, upload->height, upload->format, upload->type, pixels);
+            }
+        }
+        uploader->bytes += (GLuint64) request->size;
+        uploader->uploads++;
+    }
+    for (GLuint i = 0; i < count; i++) {
+        glBindTexture(targets[i], (GLuint) bindings[i]);
+    }
+    gloadTextureUploader_pixelStore(0);
+
+    /* Uploads from CPU memory are copied by the call itself, so the batch is retired right away... */
+    fence = uploader->buffer ? glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0) : 0;
+    if (state->unmapped) {
+        GLubyte *mapping;
+
+        mapping = (GLubyte *) glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, uploader->capacity, GL_MAP_WRITE_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+
+#   if defined (GLOAD_VERBOSE_ERROR)
+        if (!mapping) { fprintf(stderr, "gload.h: could not map the texture uploader ring.\n"); }
+#   endif /* GLOAD_VERBOSE_ERROR */
+
+        gloadInternal_mutexLock(&state->mutex);
+        uploader->mapping = mapping;
+        state->unmapped = 0;
+        gloadInternal_condBroadcast(&state->space);
+        gloadInternal_mutexUnlock(&state->mutex);
+    }
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+    gloadInternal_mutexLock(&state->mutex);
+    batch = &state->batches[state->batch_head++ % GLOAD_TEXTURE_UPLOADER_MAX_REQUESTS];
+    batch->fence = fence;
+    batch->end = last;
+    state->issued = last;
+    gloadInternal_mutexUnlock(&state->mutex);
+    if (!uploader->buffer) { gloadTextureUploader_retire(uploader, 0); }
+
+    /* The ring couldn't be mapped again and takes no more uploads: finish the ones in flight and delete their fences... */
+    else if (!uploader->mapping) { gloadTextureUploader_retire(uploader, 1); }
+}
+
+/* `gloadTextureUploaderIsComplete`:
+ *
+ * Check whether an upload has been executed by the GPU. Can be called from any thread.
+ *
+ * - param: `t_gloadTextureUploader *uploader` - uploader
+ * - param: `GLuint64 ticket` - ticket returned from `gloadTextureUploaderSubmit`
+ * - return: `true` if the upload is complete, `false` otherwise.
+ * */
+GLAPI int   gloadTextureUploaderIsComplete(t_gloadTextureUploader *uploader, GLuint64 ticket) {
+    struct s_gloadTextureUploaderState  *state;
+    int                                 result;
+
+    if (!uploader || !uploader->state || !ticket) { return (0); }
+
+    state = (struct s_gloadTextureUploaderState *) uploader->state;
+    gloadInternal_mutexLock(&state->mutex);
+    result = ticket <= state->retired;
+    gloadInternal_mutexUnlock(&state->mutex);
+    return (result);
+}
+
+#  endif /* GLOAD_TEXTURE_UPLOADER */
+#
+#  if defined (GLOAD_READBACK)
+
+/* SECTION:
+ *  gload readback API
+ * * * * * * * * * * */
+
+/* `gloadReadback_pixelSize`:
+ *
+ * - return: size of a single pixel of `format` and `type` in bytes, 0 if unknown.
+ * */
+static GLsizeiptr   gloadReadback_pixelSize(GLenum format, GLenum type) {
+    GLsizeiptr  components;
+
+    switch (type) {
+        case (GL_UNSIGNED_BYTE_3_3_2):
+        case (GL_UNSIGNED_BYTE_2_3_3_REV):          { return (1); }
+        case (GL_UNSIGNED_SHORT_5_6_5):
+        case (GL_UNSIGNED_SHORT_5_6_5_REV):
+        case (GL_UNSIGNED_SHORT_4_4_4_4):
+        case (GL_UNSIGNED_SHORT_4_4_4_4_REV):
+        case (GL_UNSIGNED_SHORT_5_5_5_1):
+        case (GL_UNSIGNED_SHORT_1_5_5_5_REV):       { return (2); }
+        case (GL_UNSIGNED_INT_8_8_8_8):
+        case (GL_UNSIGNED_INT_8_8_8_8_REV):
+        case (GL_UNSIGNED_INT_10_10_10_2):
+        case (GL_UNSIGNED_INT_2_10_10_10_REV):
+        case (GL_UNSIGNED_INT_24_8):
+        case (GL_UNSIGNED_INT_10F_11F_11F_REV):
+        case (GL_UNSIGNED_INT_5_9_9_9_REV):         { return (4); }
+        case (GL_FLOAT_32_UNSIGNED_INT_24_8_REV):   { return (8); }
+    }
+
+    switch (format) {
+        case (GL_RED):
+        case (GL_GREEN):
+        case (GL_BLUE):
+        case (GL_ALPHA):
+        case (GL_LUMINANCE):
+        case (GL_RED_INTEGER):
+        case (GL_GREEN_INTEGER):
+        case (GL_BLUE_INTEGER):
+        case (GL_STENCIL_INDEX):
+        case (GL_DEPTH_COMPONENT):                  { components = 1; } break;
+        case (GL_RG):
+        case (GL_RG_INTEGER):
+        case (GL_LUMINANCE_ALPHA):                  { components = 2; } break;
+        case (GL_RGB):
+        case (GL_BGR):
+        case (GL_RGB_INTEGER):
+        case (GL_BGR_INTEGER):                      { components = 3; } break;
+        case (GL_RGBA):
+        case (GL_BGRA):
+        case (GL_RGBA_INTEGER):
+        case (GL_BGRA_INTEGER):                     { components = 4; } break;
+        default:                                    { return (0); }
+    }
+
+    switch (type) {
+        case (GL_UNSIGNED_BYTE):
+        case (GL_BYTE):                             { return (components); }
+        case (GL_UNSIGNED_SHORT):
+        case (GL_SHORT):
+        case (GL_HALF_FLOAT):                       { return (components * 2); }
+        case (GL_UNSIGNED_INT):
+        case (GL_INT):
+        case (GL_FLOAT):                            { return (components * 4); }
+    }
+    return (0);
+}
+
+/* `gloadReadbackCreate`:
+ *
+ * Create a readback ring of `count` buffers, `capacity` bytes each.
+ * NOTE:
+ *  This function requires a current context and loaded OpenGL functions.
+ *
+ * - param: `t_gloadReadback *readback` - readback ring to initialize
+ * - param: `GLsizeiptr capacity` - size of a single buffer in bytes; limits the size of a single read
+ * - param: `GLuint count` - number of buffers (1 - GLOAD_READBACK_MAX_BUFFERS)
+ * - return: `true` on success, `false` on failure.
+ * */
+GLAPI int   gloadReadbackCreate(t_gloadReadback *readback, GLsizeiptr capacity, GLuint count) {
+    if (!readback) { return (0); }
+    memset(readback, 0, sizeof(t_gloadReadback));
+    if (capacity <= 0 || !count || count > GLOAD_READBACK_MAX_BUFFERS) { return (0); }
+
+    readback->capacity = capacity;
+    readback->count = count;
+    if (glGenBuffers && glBindBuffer && glBufferData && glMapBufferRange && glUnmapBuffer && glFenceSync && glClientWaitSync && glDeleteSync &&
+        (gloadIsVersionSupported(3, 2) || gloadIsExtensionSupported("GL_ARB_sync")) &&
+        (gloadIsVersionSupported(3, 0) || (gloadIsExtensionSupported("GL_ARB_pixel_buffer_object") && gloadIsExtensionSupported("GL_ARB_map_buffer_range")))) {
+        glGenBuffers(count, readback->buffers);
+        for (GLuint i = 0; i < count; i++) {
+            glBindBuffer(GL_PIXEL_PACK_BUFFER, readback->buffers[i]);
+            glBufferData(GL_PIXEL_PACK_BUFFER, capacity, 0, GL_STREAM_READ);
+        }
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+        return (1);
+    }
+
+#   if defined (GLOAD_VERBOSE_WARN)
+    fprintf(stderr, "gload.h: pixel-pack buffers are not supported, falling back to synchronous reads.\n");
+#   endif /* GLOAD_VERBOSE_WARN */
+
+    /* Fallback: single buffer in CPU memory, read synchronously... */
+    readback->count = 1;
+    readback->memory = (GLubyte *) malloc((size_t) capacity);
+    if (!readback->memory) {
+        memset(readback, 0, sizeof(t_gloadReadback));
+        return (0);
+    }
+    return (1);
+}
+
+/* `gloadReadbackDestroy`:
+ *
+ * Delete every buffer and pending fence of the readback ring.
+ *
+ * - param: `t_gloadReadback *readback` - readback ring to destroy
+ * */
+GLAPI void  gloadReadbackDestroy(t_gloadReadback *readback) {
+    if (!readback || !readback->count) { return; }
+
+    if (readback->memory) {
+        free(readback->memory);
+    }
+    else {
+        if (readback->mapped) {
+            glBindBuffer(GL_PIXEL_PACK_BUFFER, readback->buffers[readback->tail]);
+            glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+            glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+        }
+        for (GLuint i = 0; i < readback->count; i++) {
+            if (readback->fences[i]) { glDeleteSync(readback->fences[i]); }
+        }
+        glDeleteBuffers(readback->count, readback->buffers);
+    }
+    memset(readback, 0, sizeof(t_gloadReadback));
+}
+
+/* `gloadReadback_pixelStore`:
+ *
+ * Set the pack pixel-store state for tightly packed rows, or back to the defaults.
+ * */
+static void gloadReadback_pixelStore(int packed) {
+    glPixelStorei(GL_PACK_ALIGNMENT, packed ? 1 : 4);
+    glPixelStorei(GL_PACK_ROW_LENGTH, 0);
+    glPixelStorei(GL_PACK_SKIP_ROWS, 0);
+    glPixelStorei(GL_PACK_SKIP_PIXELS, 0);
+}
+
+/* `gloadReadbackRead`:
+ *
+ * Queue a read of a rectangle of the current read framebuffer (`glReadBuffer`).
+ * Rows of the result are tightly packed.
+ * NOTE:
+ *  The pack pixel-store state (`GL_PACK_ALIGNMENT`, `GL_PACK_ROW_LENGTH`, `GL_PACK_SKIP_*`)
+ *  is left at its defaults.
+ *
+ * - param: `t_gloadReadback *readback` - readback ring
+ * - param: `GLint x`, `GLint y`, `GLsizei width`, `GLsizei height` - rectangle to read
+ * - param: `GLenum format`, `GLenum type` - format of the result, as in `glReadPixels`
+ * - return: `true` on success, `false` if every buffer is in flight, the read doesn't fit or its fence can't be created.
+ * */
+GLAPI int   gloadReadbackRead(t_gloadReadback *readback, GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type) {
+    GLsizeiptr  size;
+    GLsync      fence;
+
+    if (!readback || !readback->count || width <= 0 || height <= 0) { return (0); }
+
+    size = gloadReadback_pixelSize(format, type) * width * height;
+    if (!size || size > readback->capacity) { return (0); }
+    if (readback->pending == readback->count) {
+        readback->drops++;
+        return (0);
+    }
+
+    gloadReadback_pixelStore(1);
+    if (readback->memory) {
+        glReadPixels(x, y, width, height, format, type, readback->memory);
+        gloadReadback_pixelStore(0);
+    }
+    else {
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, readback->buffers[readback->head]);
+        glReadPixels(x, y, width, height, format, type, 0);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+        gloadReadback_pixelStore(0);
+        fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        if (!fence) {
+#   if defined (GLOAD_VERBOSE_ERROR)
+            fprintf(stderr, "gload.h: failed to create a fence for a readback.\n");
+#   endif /* GLOAD_VERBOSE_ERROR */
+
+            return (0);
+        }
+        readback->fences[readback->head] = fence;
+    }
+
+    readback->sizes[readback->head] = size;
+    readback->head = (readback->head + 1) % readback->count;
+    readback->pending++;
+    return (1);
+}
+
+/* `gloadReadbackMap`:
+ *
+ * Map the result of the oldest read in flight.
+ * The pointer stays valid until `gloadReadbackUnmap`.
+ *
+ * - param: `t_gloadReadback *readback` - readback ring
+ * - param: `int wait` - `true` to wait for the GPU, `false` to return null if the read hasn't finished yet
+ * - param: `GLsizeiptr *size` - size of the result in bytes (can be null)
+ * - return: pointer to the result on success, null if nothing is ready or the read failed.
+ *   A failed read is removed from the ring and counted in `failures`.
+ * */
+GLAPI const void    *gloadReadbackMap(t_gloadReadback *readback, int wait, GLsizeiptr *size) {
+    const void  *result;
+    GLsync      fence;
+    GLenum      status;
+
+    if (!readback || !readback->pending || readback->mapped) { return (0); }
+
+    if (size) { *size = readback->sizes[readback->tail]; }
+    if (readback->memory) {
+        readback->mapped = 1;
+        return (readback->memory);
+    }
+
+    fence = readback->fences[readback->tail];
+    status = glClientWaitSync(fence, 0, 0);
+    if (status == GL_TIMEOUT_EXPIRED) {
+        if (!wait) { return (0); }
+        readback->waits++;
+        do {
+            status = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000);
+        } while (status == GL_TIMEOUT_EXPIRED);
+    }
+    glDeleteSync(fence), readback->fences[readback->tail] = 0;
+    if (status == GL_WAIT_FAILED) {
+#   if defined (GLOAD_VERBOSE_ERROR)
+        fprintf(stderr, "gload.h: failed to wait for a readback, dropping it.\n");
+#   endif /* GLOAD_VERBOSE_ERROR */
+
+        readback->failures++;
+        readback->tail = (readback->tail + 1) % readback->count;
+        readback->pending--;
+        return (0);
+    }
+
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, readback->buffers[readback->tail]);
+    result = glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, readback->sizes[readback->tail], GL_MAP_READ_BIT);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    readback->mapped = result != 0;
+    return (result);
+}
+
+/* `gloadReadbackUnmap`:
+ *
+ * Release the result returned from `gloadReadbackMap`, making its buffer available for another read.
+ *
+ * - param: `t_gloadReadback *readback` - readback ring
+ * */
+GLAPI void  gloadReadbackUnmap(t_gloadReadback *readback) {
+    if (!readback || !readback->mapped) { return; }
+
+    if (!readback->memory) {
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, readback->buffers[readback->tail]);
+        glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    }
+    readback->bytes += (GLuint64) readback->sizes[readback->tail];
+    readback->reads++;
+    readback->mapped = 0;
+    readback->tail = (readback->tail + 1) % readback->count;
+    readback->pending--;
+}
+
+#  endif /* GLOAD_READBACK */
+#
+#  if defined (GLOAD_PIPELINE_STATE)
+
+/* SECTION:
+ *  gload pipeline state API
+ * * * * * * * * * * * * * */
+
+/* `GLOAD_PIPELINE_GROUP_*` - groups of parameters applied by a single OpenGL call.
+ * */
+#   define GLOAD_PIPELINE_GROUP_BLEND_FUNC      0x0001
+#   define GLOAD_PIPELINE_GROUP_BLEND_OP        0x0002
+#   define GLOAD_PIPELINE_GROUP_BLEND_COLOR     0x0004
+#   define GLOAD_PIPELINE_GROUP_DEPTH_FUNC      0x0008
+#   define GLOAD_PIPELINE_GROUP_STENCIL_FUNC    0x0010
+#   define GLOAD_PIPELINE_GROUP_STENCIL_OP      0x0020
+#   define GLOAD_PIPELINE_GROUP_STENCIL_MASK    0x0040
+#   define GLOAD_PIPELINE_GROUP_CULL_FACE       0x0080
+#   define GLOAD_PIPELINE_GROUP_FRONT_FACE      0x0100
+#   define GLOAD_PIPELINE_GROUP_POLYGON_MODE    0x0200
+#   define GLOAD_PIPELINE_GROUP_POLYGON_OFFSET  0x0400
+#   define GLOAD_PIPELINE_GROUP_SCISSOR         0x0800
+#   define GLOAD_PIPELINE_GROUP_VIEWPORT        0x1000
+#   define GLOAD_PIPELINE_GROUP_PROGRAM         0x2000
+
+/* `static struct s_gloadPipeline g_pipeline` - currently bound pipeline state.
+ *
+ * `known` holds the groups whose parameters in `current` match OpenGL; parameters of disabled
+ * tests aren't applied, so they may keep the values of an older state.
+ * */
+static struct s_gloadPipeline {
+    t_gloadPipelineDesc current;
+    GLuint64            hash;
+    int                 valid;
+    GLbitfield          known;
+}   g_pipeline;
+
+/* `static const struct s_gloadPipelineCap g_pipeline_caps` - capabilities toggled with `glEnable`/`glDisable`.
+ * */
+static const struct s_gloadPipelineCap {
+    GLbitfield  flag;
+    GLenum      cap;
+}   g_pipeline_caps[] = {
+    { GLOAD_PIPELINE_BLEND,             GL_BLEND },
+    { GLOAD_PIPELINE_DEPTH_TEST,        GL_DEPTH_TEST },
+    { GLOAD_PIPELINE_STENCIL_TEST,      GL_STENCIL_TEST },
+    { GLOAD_PIPELINE_CULL_FACE,         GL_CULL_FACE },
+    { GLOAD_PIPELINE_POLYGON_OFFSET,    GL_POLYGON_OFFSET_FILL },
+    { GLOAD_PIPELINE_SCISSOR_TEST,      GL_SCISSOR_TEST },
+};
+
+/* `gloadPipelineState_diff`:
+ *
+ * - return: groups of parameters of `next` that have to be applied over the bound state.
+ * */
+static GLbitfield   gloadPipelineState_diff(const t_gloadPipelineDesc *next) {
+    const t_gloadPipelineDesc   *cur;
+    GLbitfield                  diff;
+
+    cur = &g_pipeline.current;
+    diff = 0;
+    if (next->flags & GLOAD_PIPELINE_BLEND) {
+        if (cur->blend_src_rgb != next->blend_src_rgb || cur->blend_dst_rgb != next->blend_dst_rgb ||
+            cur->blend_src_alpha != next->blend_src_alpha || cur->blend_dst_alpha != next->blend_dst_alpha) {
+            diff |= GLOAD_PIPELINE_GROUP_BLEND_FUNC;
+        }
+        if (cur->blend_op_rgb != next->blend_op_rgb || cur->blend_op_alpha != next->blend_op_alpha) {
+            diff |= GLOAD_PIPELINE_GROUP_BLEND_OP;
+        }
+        if (memcmp(cur->blend_color, next->blend_color, sizeof(next->blend_color))) {
+            diff |= GLOAD_PIPELINE_GROUP_BLEND_COLOR;
+        }
+    }
+    if (next->flags & GLOAD_PIPELINE_DEPTH_TEST) {
+        if (cur->depth_func != next->depth_func) {
+            diff |= GLOAD_PIPELINE_GROUP_DEPTH_FUNC;
+        }
+    }
+    if (next->flags & GLOAD_PIPELINE_STENCIL_TEST) {
+        if (cur->stencil_func != next->stencil_func || cur->stencil_ref != next->stencil_ref || cur->stencil_read_mask != next->stencil_read_mask) {
+            diff |= GLOAD_PIPELINE_GROUP_STENCIL_FUNC;
+        }
+        if (cur->stencil_fail != next->stencil_fail || cur->stencil_depth_fail != next->stencil_depth_fail || cur->stencil_pass != next->stencil_pass) {
+            diff |= GLOAD_PIPELINE_GROUP_STENCIL_OP;
+        }
+    }
+    if (next->flags & GLOAD_PIPELINE_CULL_FACE) {
+        if (cur->cull_face != next->cull_face) {
+            diff |= GLOAD_PIPELINE_GROUP_CULL_FACE;
+        }
+    }
+    if (next->flags & GLOAD_PIPELINE_POLYGON_OFFSET) {
+        if (cur->polygon_offset_factor != next->polygon_offset_factor || cur->polygon_offset_units != next->polygon_offset_units) {
+            diff |= GLOAD_PIPELINE_GROUP_POLYGON_OFFSET;
+        }
+    }
+    if (next->flags & GLOAD_PIPELINE_SCISSOR_TEST) {
+        if (memcmp(cur->scissor, next->scissor, sizeof(next->scissor))) {
+            diff |= GLOAD_PIPELINE_GROUP_SCISSOR;
+        }
+    }
+    if (next->viewport[2] > 0) {
+        if (memcmp(cur->viewport, next->viewport, sizeof(next->viewport))) {
+            diff |= GLOAD_PIPELINE_GROUP_VIEWPORT;
+        }
+    }
+
+    /* Stencil write mask also applies to `glClear`, so it's never skipped... */
+    if (cur->stencil_write_mask != next->stencil_write_mask) { diff |= GLOAD_PIPELINE_GROUP_STENCIL_MASK; }
+    if (cur->front_face != next->front_face) { diff |= GLOAD_PIPELINE_GROUP_FRONT_FACE; }
+    if (cur->polygon_mode != next->polygon_mode) { diff |= GLOAD_PIPELINE_GROUP_POLYGON_MODE; }
+    if (cur->program != next->program) { diff |= GLOAD_PIPELINE_GROUP_PROGRAM; }
+
+    /* Groups of unknown parameters are applied whenever they're used... */
+    diff |= ~g_pipeline.known & (GLOAD_PIPELINE_GROUP_STENCIL_MASK | GLOAD_PIPELINE_GROUP_FRONT_FACE |
+                                 GLOAD_PIPELINE_GROUP_POLYGON_MODE | GLOAD_PIPELINE_GROUP_PROGRAM);
+    if (next->flags & GLOAD_PIPELINE_BLEND) {
+        diff |= ~g_pipeline.known & (GLOAD_PIPELINE_GROUP_BLEND_FUNC | GLOAD_PIPELINE_GROUP_BLEND_OP | GLOAD_PIPELINE_GROUP_BLEND_COLOR);
+    }
+    if (next->flags & GLOAD_PIPELINE_DEPTH_TEST) { diff |= ~g_pipeline.known & GLOAD_PIPELINE_GROUP_DEPTH_FUNC; }
+    if (next->flags & GLOAD_PIPELINE_STENCIL_TEST) { diff |= ~g_pipeline.known & (GLOAD_PIPELINE_GROUP_STENCIL_FUNC | GLOAD_PIPELINE_GROUP_STENCIL_OP); }
+    if (next->flags & GLOAD_PIPELINE_CULL_FACE) { diff |= ~g_pipeline.known & GLOAD_PIPELINE_GROUP_CULL_FACE; }
+    if (next->flags & GLOAD_PIPELINE_POLYGON_OFFSET) { diff |= ~g_pipeline.known & GLOAD_PIPELINE_GROUP_POLYGON_OFFSET; }
+    if (next->flags & GLOAD_PIPELINE_SCISSOR_TEST) { diff |= ~g_pipeline.known & GLOAD_PIPELINE_GROUP_SCISSOR; }
+    if (next->viewport[2] > 0) { diff |= ~g_pipeline.known & GLOAD_PIPELINE_GROUP_VIEWPORT; }
+    return (diff);
+}
+
+/* `gloadPipelineState_polygonMode`:
+ *
+ * Check if `glPolygonMode` can be called. OpenGLES has no polygon modes, so `GL_FILL` is the only one.
+ * */
+static int  gloadPipelineState_polygonMode(void) {
+    const char  *version;
+
+    if (!glPolygonMode) { return (0); }
+    version = (const char *) glGetString(GL_VERSION);
+    return (!version || strncmp(version, "OpenGL ES", 9));
+}
+
+/* `gloadPipelineStateDefaults`:
+ *
+ * Initialize a pipeline description with the default state of OpenGL.
+ *
+ * - param: `t_gloadPipelineDesc *desc` - description to initialize
+ * */
+GLAPI void  gloadPipelineStateDefaults(t_gloadPipelineDesc *desc) {
+    if (!desc) { return; }
+
+    memset(desc, 0, sizeof(t_gloadPipelineDesc));
+    desc->flags = GLOAD_PIPELINE_DEPTH_WRITE | GLOAD_PIPELINE_WRITE_COLOR;
+    desc->blend_src_rgb = desc->blend_src_alpha = GL_ONE;
+    desc->blend_dst_rgb = desc->blend_dst_alpha = GL_ZERO;
+    desc->blend_op_rgb = desc->blend_op_alpha = GL_FUNC_ADD;
+    desc->depth_func = GL_LESS;
+    desc->stencil_func = GL_ALWAYS;
+    desc->stencil_read_mask = desc->stencil_write_mask = 0xFFFFFFFF;
+    desc->stencil_fail = desc->stencil_depth_fail = desc->stencil_pass = GL_KEEP;
+    desc->cull_face = GL_BACK;
+    desc->front_face = GL_CCW;
+    desc->polygon_mode = GL_FILL;
+}
+
+/* `gloadPipelineStateCreate`:
+ *
+ * Create an immutable pipeline state from a description.
+ *
+ * - param: `t_gloadPipelineState *state` - pipeline state to initialize
+ * - param: `const t_gloadPipelineDesc *desc` - description of the state
+ * - return: `true` on success, `false` on failure.
+ * */
+GLAPI int   gloadPipelineStateCreate(t_gloadPipelineState *state, const t_gloadPipelineDesc *desc) {
+    if (!state) { return (0); }
+    memset(state, 0, sizeof(t_gloadPipelineState));
+    if (!desc) { return (0); }
+
+    /* Description is made of 32-bit fields only, so it can be hashed and compared as a whole... */
+    state->desc = *desc;
+    state->hash = gloadInternal_hash(0xcbf29ce484222325ull, &state->desc, sizeof(t_gloadPipelineDesc));
+    return (1);
+}
+
+/* `gloadPipelineStateBind`:
+ *
+ * Apply a pipeline state, emitting only the calls for the state that differs from the bound one.
+ * NOTE:
+ *  The first bind after `gloadPipelineStateInvalidate` applies the whole state.
+ *  On OpenGLES polygon modes are ignored, since `GL_FILL` is the only one.
+ *
+ * - param: `const t_gloadPipelineState *state` - pipeline state to bind
+ * - return: number of OpenGL calls emitted.
+ * */
+GLAPI GLuint    gloadPipelineStateBind(const t_gloadPipelineState *state) {
+    const t_gloadPipelineDesc   *next;
+    t_gloadPipelineDesc         *cur;
+    GLbitfield                  flags;
+    GLbitfield                  diff;
+    GLuint                      calls;
+
+    if (!state) { return (0); }
+    if (g_pipeline.valid && g_pipeline.hash == state->hash &&
+        !memcmp(&g_pipeline.current, &state->desc, sizeof(t_gloadPipelineDesc))) {
+        return (0);
+    }
+
+    next = &state->desc;
+    cur = &g_pipeline.current;
+    calls = 0;
+
+    /* Capabilities and write masks are compared as bitmasks... */
+    flags = g_pipeline.valid ? cur->flags ^ next->flags : 0xFFFFFFFF;
+    for (size_t i = 0; i < sizeof(g_pipeline_caps) / sizeof(g_pipeline_caps[0]); i++) {
+        if (flags & g_pipeline_caps[i].flag) {
+            if (next->flags & g_pipeline_caps[i].flag) { glEnable(g_pipeline_caps[i].cap); }
+            else { glDisable(g_pipeline_caps[i].cap); }
+            calls++;
+        }
+    }
+    if (flags & GLOAD_PIPELINE_DEPTH_WRITE) {
+        glDepthMask((GLboolean) !!(next->flags & GLOAD_PIPELINE_DEPTH_WRITE));
+        calls++;
+    }
+    if (flags & GLOAD_PIPELINE_WRITE_COLOR) {
+        glColorMask((GLboolean) !!(next->flags & GLOAD_PIPELINE_WRITE_RED), (GLboolean) !!(next->flags & GLOAD_PIPELINE_WRITE_GREEN),
+                    (GLboolean) !!(next->flags & GLOAD_PIPELINE_WRITE_BLUE), (GLboolean) !!(next->flags & GLOAD_PIPELINE_WRITE_ALPHA));
+        calls++;
+    }
+    cur->flags = next->flags;
+
+    diff = gloadPipelineState_diff(next);
+    if (diff & GLOAD_PIPELINE_GROUP_BLEND_FUNC) {
+        glBlendFuncSeparate(next->blend_src_rgb, next->blend_dst_rgb, next->blend_src_alpha, next->blend_dst_alpha);
+        cur->blend_src_rgb = next->blend_src_rgb, cur->blend_dst_rgb = next->blend_dst_rgb;
+        cur->blend_src_alpha = next->blend_src_alpha, cur->blend_dst_alpha = next->blend_dst_alpha;
+        calls++;
+    }
+    if (diff & GLOAD_PIPELINE_GROUP_BLEND_OP) {
+        glBlendEquationSeparate(next->blend_op_rgb, next->blend_op_alpha);
+        cur->blend_op_rgb = next->blend_op_rgb, cur->blend_op_alpha = next->blend_op_alpha;
+        calls++;
+    }
+    if (diff & GLOAD_PIPELINE_GROUP_BLEND_COLOR) {
+        glBlendColor(next->blend_color[0], next->blend_color[1], next->blend_color[2], next->blend_color[3]);
+        memcpy(cur->blend_color, next->blend_color, sizeof(next->blend_color));
+        calls++;
+    }
+    if (diff & GLOAD_PIPELINE_GROUP_DEPTH_FUNC) {
+        glDepthFunc(next->depth_func);
+        cur->depth_func = next->depth_func;
+        calls++;
+    }
+    if (diff & GLOAD_PIPELINE_GROUP_STENCIL_FUNC) {
+        glStencilFunc(next->stencil_func, next->stencil_ref, next->stencil_read_mask);
+        cur->stencil_func = next->stencil_func, cur->stencil_ref = next->stencil_ref, cur->stencil_read_mask = next->stencil_read_mask;
+        calls++;
+    }
+    if (diff & GLOAD_PIPELINE_GROUP_STENCIL_OP) {
+        glStencilOp(next->stencil_fail, next->stencil_depth_fail, next->stencil_pass);
+        cur->stencil_fail = next->stencil_fail, cur->stencil_depth_fail = next->stencil_depth_fail, cur->stencil_pass = next->stencil_pass;
+        calls++;
+    }
+    if (diff & GLOAD_PIPELINE_GROUP_STENCIL_MASK) {
+        glStencilMask(next->stencil_write_mask);
+        cur->stencil_write_mask = next->stencil_write_mask;
+        calls++;
+    }
+    if (diff & GLOAD_PIPELINE_GROUP_CULL_FACE) {
+        glCullFace(next->cull_face);
+        cur->cull_face = next->cull_face;
+        calls++;
+    }
+    if (diff & GLOAD_PIPELINE_GROUP_FRONT_FACE) {
+        glFrontFace(next->front_face);
+        cur->front_face = next->front_face;
+        calls++;
+    }
+    if (diff & GLOAD_PIPELINE_GROUP_POLYGON_MODE) {
+        if (gloadPipelineState_polygonMode()) {
+            glPolygonMode(GL_FRONT_AND_BACK, next->polygon_mode);
+            calls++;
+        }
+        else if (next->polygon_mode != GL_FILL) {
+#   if defined (GLOAD_VERBOSE_WARN)
+            fprintf(stderr, "gload.h: polygon modes are not supported, filling polygons instead.\n");
+#   endif /* GLOAD_VERBOSE_WARN */
+        }
+        cur->polygon_mode = next->polygon_mode;
+    }
+    if (diff & GLOAD_PIPELINE_GROUP_POLYGON_OFFSET) {
+        glPolygonOffset(next->polygon_offset_factor, next->polygon_offset_units);
+        cur->polygon_offset_factor = next->polygon_offset_factor, cur->polygon_offset_units = next->polygon_offset_units;
+        calls++;
+    }
+    if (diff & GLOAD_PIPELINE_GROUP_SCISSOR) {
+        glScissor(next->scissor[0], next->scissor[1], next->scissor[2], next->scissor[3]);
+        memcpy(cur->scissor, next->scissor, sizeof(next->scissor));
+        calls++;
+    }
+    if (diff & GLOAD_PIPELINE_GROUP_VIEWPORT) {
+        glViewport(next->viewport[0], next->viewport[1], next->viewport[2], next->viewport[3]);
+        memcpy(cur->viewport, next->viewport, sizeof(next->viewport));
+        calls++;
+    }
+    if (diff & GLOAD_PIPELINE_GROUP_PROGRAM) {
+        glUseProgram(next->program);
+        cur->program = next->program;
+        calls++;
+    }
+
+    g_pipeline.known |= diff;
+    g_pipeline.valid = 1;
+    g_pipeline.hash = !memcmp(cur, next, sizeof(t_gloadPipelineDesc)) ? state->hash : 0;
+    return (calls);
+}
+
+/* `gloadPipelineStateInvalidate`:
+ *
+ * Forget the bound pipeline state, i.e. after switching contexts or changing the state with raw OpenGL calls.
+ * */
+GLAPI void  gloadPipelineStateInvalidate(void) {
+    memset(&g_pipeline, 0, sizeof(g_pipeline));
+}
+
+#   undef GLOAD_PIPELINE_GROUP_BLEND_FUNC
+#   undef GLOAD_PIPELINE_GROUP_BLEND_OP
+#   undef GLOAD_PIPELINE_GROUP_BLEND_COLOR
+#   undef GLOAD_PIPELINE_GROUP_DEPTH_FUNC
+#   undef GLOAD_PIPELINE_GROUP_STENCIL_FUNC
+#   undef GLOAD_PIPELINE_GROUP_STENCIL_OP
+#   undef GLOAD_PIPELINE_GROUP_STENCIL_MASK
+#   undef GLOAD_PIPELINE_GROUP_CULL_FACE
+#   undef GLOAD_PIPELINE_GROUP_FRONT_FACE
+#   undef GLOAD_PIPELINE_GROUP_POLYGON_MODE
+#   undef GLOAD_PIPELINE_GROUP_POLYGON_OFFSET
+#   undef GLOAD_PIPELINE_GROUP_SCISSOR
+#   undef GLOAD_PIPELINE_GROUP_VIEWPORT
+#   undef GLOAD_PIPELINE_GROUP_PROGRAM
+#  endif /* GLOAD_PIPELINE_STATE */
+#
+#  if defined (GLOAD_DRAW_QUEUE)
+
+/* SECTION:
+ *  gload draw queue API
+ * * * * * * * * * * * */
+
+/* `struct s_gloadDrawSortItem` - sort key paired with the index of its command.
+ * */
+struct s_gloadDrawSortItem {
+    GLuint64    key;
+    GLuint      index;
+};
+
+/* `gloadDrawQueue_sort`:
+ *
+ * Stable LSD radix sort of `count` items by their keys, 8 bits per pass.
+ * Histograms of every pass are built in a single pass over the keys, and passes where every key
+ * has the same digit are skipped, so keys sharing their high bits (i.e. few programs) sort in fewer passes.
+ *
+ * - return: sorted items (either `items` or `scratch`).
+ * */
+static struct s_gloadDrawSortItem   *gloadDrawQueue_sort(struct s_gloadDrawSortItem *items, struct s_gloadDrawSortItem *scratch, GLuint count) {
+    struct s_gloadDrawSortItem  *swap;
+    GLuint                      histogram[8][256];
+    GLuint                      offset;
+    GLuint                      digit;
+
+    memset(histogram, 0, sizeof(histogram));
+    for (GLuint i = 0; i < count; i++) {
+        GLuint64    key;
+
+        key = items[i].key;
+        histogram[0][key & 0xFF]++;
+        histogram[1][(key >> 8) & 0xFF]++;
+        histogram[2][(key >> 16) & 0xFF]++;
+        histogram[3][(key >> 24) & 0xFF]++;
+        histogram[4][(key >> 32) & 0xFF]++;
+        histogram[5][(key >> 40) & 0xFF]++;
+        histogram[6][(key >> 48) & 0xFF]++;
+        histogram[7][(key >> 56) & 0xFF]++;
+    }
+
+    for (GLuint pass = 0; pass < 8; pass++) {
+        if (histogram[pass][(items[0].key >> (pass * 8)) & 0xFF] == count) { continue; }
+
+        offset = 0;
+        for (GLuint i = 0; i < 256; i++) {
+            digit = histogram[pass][i];
+            histogram[pass][i] = offset;
+            offset += digit;
+        }
+        for (GLuint i = 0; i < count; i++) {
+            scratch[histogram[pass][(items[i].key >> (pass * 8)) & 0xFF]++] = items[i];
+        }
+        swap = items, items = scratch, scratch = swap;
+    }
+    return (items);
+}
+
+/* `gloadDrawQueue_compatible`:
+ *
+ * - return: `true` if `next` can be issued in the same multi-draw as `command`, `false` otherwise.
+ * */
+static int  gloadDrawQueue_compatible(const t_gloadDrawCommand *command, const t_gloadDrawCommand *next) {
+    return (!command->callback && !next->callback &&
+            command->program == next->program && command->vao == next->vao &&
+            command->mode == next->mode && command->type == next->type &&
+            command->texture_target == next->texture_target &&
+            !memcmp(command->textures, next->textures, sizeof(command->textures)));
+}
+
+/* `gloadDrawQueue_draw`:
+ *
+ * Issue a single command with the least specific draw call that covers it.
+ * */
+static void gloadDrawQueue_draw(t_gloadDrawQueue *queue, const t_gloadDrawCommand *command) {
+    if (command->callback) { command->callback(command); }
+    if (command->base_instance && queue->base_instance) {
+        glDrawElementsInstancedBaseVertexBaseInstance(command->mode, command->count, command->type, (const void *) command->offset,
+                                                      command->instances > 1 ? command->instances : 1, command->base_vertex, command->base_instance);
+    }
+    else if (command->instances > 1 || command->base_vertex) {
+        glDrawElementsInstancedBaseVertex(command->mode, command->count, command->type, (const void *) command->offset,
+                                          command->instances > 1 ? command->instances : 1, command->base_vertex);
+    }
+    else {
+        glDrawElements(command->mode, command->count, command->type, (const void *) command->offset);
+    }
+    queue->draws++;
+}
+
+/* `gloadDrawQueue_multiDraw`:
+ *
+ * Write up to `count` compatible commands into the indirect buffer and issue them with a single `glMultiDrawElementsIndirect`.
+ * A run larger than the space left in the region is split: the commands that fit are issued,
+ * and the region is advanced when none does.
+ *
+ * - return: number of commands issued, 0 if the commands have to be issued one by one.
+ * */
+static GLuint   gloadDrawQueue_multiDraw(t_gloadDrawQueue *queue, const struct s_gloadDrawSortItem *items, GLuint count) {
+    const t_gloadDrawCommand    *command;
+    GLuint                      *indirect;
+    GLintptr                    offset;
+    GLintptr                    size;
+    GLsizeiptr                  space;
+
+    if (!queue->multidraw) { return (0); }
+
+    command = &queue->commands[items[0].index];
+    size = command->type == GL_UNSIGNED_INT ? 4 : command->type == GL_UNSIGNED_SHORT ? 2 : 1;
+    for (GLuint i = 0; i < count; i++) {
+        if (queue->commands[items[i].index].offset % size) { return (0); }
+    }
+
+    /* `DrawElementsIndirectCommand`: count, instanceCount, firstIndex, baseVertex, baseInstance... */
+    space = queue->indirect.region - ((queue->indirect.tail + 3) & ~(GLsizeiptr) 3);
+    if (space < (GLsizeiptr) (5 * sizeof(GLuint))) {
+        gloadStreamBufferNextFrame(&queue->indirect);
+        space = queue->indirect.region;
+    }
+    if ((GLsizeiptr) count * (GLsizeiptr) (5 * sizeof(GLuint)) > space) { count = (GLuint) (space / (GLsizeiptr) (5 * sizeof(GLuint))); }
+    if (!count) { return (0); }
+    indirect = (GLuint *) gloadStreamBufferMap(&queue->indirect, (GLsizeiptr) count * 5 * sizeof(GLuint), 4, &offset);
+    if (!indirect) { return (0); }
+    for (GLuint i = 0; i < count; i++, indirect += 5) {
+        const t_gloadDrawCommand    *draw;
+
+        draw = &queue->commands[items[i].index];
+        indirect[0] = (GLuint) draw->count;
+        indirect[1] = (GLuint) (draw->instances > 1 ? draw->instances : 1);
+        indirect[2] = (GLuint) (draw->offset / size);
+        indirect[3] = (GLuint) draw->base_vertex;
+        indirect[4] = draw->base_instance;
+    }
+    gloadStreamBufferUnmap(&queue->indirect);
+
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, queue->indirect.buffer);
+    glMultiDrawElementsIndirect(command->mode, command->type, (const void *) offset, (GLsizei) count, 0);
+    queue->draws += count;
+    queue->multidraws++;
+    return (count);
+}
+
+/* `gloadDrawQueueKey`:
+ *
+ * Build a sort key, grouping draws by program, then vertex array, then texture set, then depth.
+ * NOTE:
+ *  Program and vertex array names are truncated to 12 bits, the texture set is hashed to 16 bits
+ *  and depth is quantized to 24 bits: equal keys are only a hint of equal state.
+ *
+ * - param: `GLuint program` - program of the draw
+ * - param: `GLuint vao` - vertex array of the draw
+ * - param: `const GLuint *textures` - texture set of the draw (GLOAD_DRAW_QUEUE_MAX_TEXTURES names, can be null)
+ * - param: `GLfloat depth` - view depth of the draw, in range 0.0 - 1.0 (front to back)
+ * - return: sort key.
+ * */
+GLAPI GLuint64  gloadDrawQueueKey(GLuint program, GLuint vao, const GLuint *textures, GLfloat depth) {
+    GLuint64    hash;
+    GLuint64    set;
+
+    set = 0;
+    if (textures) {
+        hash = 0xcbf29ce484222325ull;
+        for (GLuint i = 0; i < GLOAD_DRAW_QUEUE_MAX_TEXTURES; i++) {
+            hash = (hash ^ textures[i]) * 0x100000001b3ull;
+        }
+        set = (hash ^ (hash >> 16) ^ (hash >> 32) ^ (hash >> 48)) & 0xFFFF;
+    }
+    if (depth < 0.0f) { depth = 0.0f; }
+    if (depth > 1.0f) { depth = 1.0f; }
+
+    return (((GLuint64) (program & 0xFFF) << 52) |
+            ((GLuint64) (vao & 0xFFF) << 40) |
+            (set << 24) |
+            (GLuint64) (depth * 16777215.0f));
+}
+
+/* `gloadDrawQueueCreate`:
+ *
+ * Create a draw queue.
+ * NOTE:
+ *  This function requires a current context and loaded OpenGL functions.
+ *
+ * - param: `t_gloadDrawQueue *queue` - draw queue to initialize
+ * - param: `GLuint capacity` - initial number of commands; the queue grows as needed, but at most `capacity`
+ *   commands per submission are issued with multi-draws
+ * - return: `true` on success, `false` on failure.
+ * */
+GLAPI int   gloadDrawQueueCreate(t_gloadDrawQueue *queue, GLuint capacity) {
+    if (!queue) { return (0); }
+    memset(queue, 0, sizeof(t_gloadDrawQueue));
+
+    if (capacity < 64) { capacity = 64; }
+    queue->commands = (t_gloadDrawCommand *) malloc(capacity * sizeof(t_gloadDrawCommand));
+    queue->scratch = malloc(capacity * sizeof(struct s_gloadDrawSortItem) * 2);
+    if (!queue->commands || !queue->scratch) {
+        gloadDrawQueueDestroy(queue);
+        return (0);
+    }
+    queue->capacity = capacity;
+    queue->multibind = glBindTextures != 0 && (gloadIsVersionSupported(4, 4) || gloadIsExtensionSupported("GL_ARB_multi_bind"));
+    queue->base_instance = glDrawElementsInstancedBaseVertexBaseInstance != 0 &&
+                           (gloadIsVersionSupported(4, 2) || gloadIsExtensionSupported("GL_ARB_base_instance"));
+    if (glMultiDrawElementsIndirect && (gloadIsVersionSupported(4, 3) || gloadIsExtensionSupported("GL_ARB_multi_draw_indirect"))) {
+        queue->multidraw = gloadStreamBufferCreate(&queue->indirect, GL_DRAW_INDIRECT_BUFFER, (GLsizeiptr) capacity * 5 * sizeof(GLuint), 3);
+        glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+    }
+    return (1);
+}
+
+/* `gloadDrawQueueDestroy`:
+ *
+ * Release the draw queue.
+ *
+ * - param: `t_gloadDrawQueue *queue` - draw queue to destroy
+ * */
+GLAPI void  gloadDrawQueueDestroy(t_gloadDrawQueue *queue) {
+    if (!queue) { return; }
+
+    if (queue->multidraw) { gloadStreamBufferDestroy(&queue->indirect); }
+    free(queue->commands);
+    free(queue->scratch);
+    memset(queue, 0, sizeof(t_gloadDrawQueue));
+}
+
+/* `gloadDrawQueuePush`:
+ *
+ * Record a draw command. Doesn't call into OpenGL.
+ *
+ * - param: `t_gloadDrawQueue *queue` - draw queue
+ * - param: `const t_gloadDrawCommand *command` - command to record (copied)
+ * - return: `true` on success, `false` on failure.
+ * */
+GLAPI int   gloadDrawQueuePush(t_gloadDrawQueue *queue, const t_gloadDrawCommand *command) {
+    t_gloadDrawCommand  *commands;
+    void                *scratch;
+    GLuint              capacity;
+
+    if (!queue || !queue->commands || !command) { return (0); }
+
+    if (queue->count == queue->capacity) {
+        capacity = queue->capacity * 2;
+        commands = (t_gloadDrawCommand *) realloc(queue->commands, capacity * sizeof(t_gloadDrawCommand));
+        if (!commands) { return (0); }
+        queue->commands = commands;
+        scratch = realloc(queue->scratch, capacity * sizeof(struct s_gloadDrawSortItem) * 2);
+        if (!scratch) { return (0); }
+        queue->scratch = scratch;
+        queue->capacity = capacity;
+    }
+    queue->commands[queue->count++] = *command;
+    return (1);
+}
+
+/* `gloadDrawQueueSubmit`:
+ *
+ * Sort the recorded commands by their keys, issue them and empty the queue.
+ * Commands with equal keys keep the order they were recorded in.
+ * NOTE:
+ *  Program, vertex array and texture bindings are left as set by the last command,
+ *  `GL_DRAW_INDIRECT_BUFFER` is left unbound.
+ *
+ * - param: `t_gloadDrawQueue *queue` - draw queue
+ * */
+GLAPI void  gloadDrawQueueSubmit(t_gloadDrawQueue *queue) {
+    struct s_gloadDrawSortItem  *items;
+    const t_gloadDrawCommand    *command;
+    const t_gloadDrawCommand    *last;
+    GLuint64                    start;
+    GLuint                      units;
+    GLuint                      batch;
+    GLuint                      multidraws;
+
+    if (!queue || !queue->count) { return; }
+
+    start = gloadInternal_clock();
+    items = (struct s_gloadDrawSortItem *) queue->scratch;
+    for (GLuint i = 0; i < queue->count; i++) {
+        items[i].key = queue->commands[i].key;
+        items[i].index = i;
+    }
+    items = gloadDrawQueue_sort(items, items + queue->capacity, queue->count);
+    queue->sort_ns += gloadInternal_clock() - start;
+
+    multidraws = queue->multidraws;
+    last = 0;
+    for (GLuint i = 0; i < queue->count; i += batch) {
+        command = &queue->commands[items[i].index];
+        if (!last || last->program != command->program) {
+            glUseProgram(command->program);
+            queue->program_binds++;
+        }
+        if (!last || last->vao != command->vao) {
+            glBindVertexArray(command->vao);
+            queue->vao_binds++;
+        }
+
+        /* Bind only the range of units that changed... */
+        units = 0;
+        for (GLuint unit = 0; unit < GLOAD_DRAW_QUEUE_MAX_TEXTURES; unit++) {
+            if (!last || last->textures[unit] != command->textures[unit] || last->texture_target != command->texture_target) {
+                units = unit + 1;
+            }
+        }
+        if (units && queue->multibind) {
+            glBindTextures(0, units, command->textures);
+            queue->texture_binds++;
+        }
+        else if (units) {
+            for (GLuint unit = 0; unit < units; unit++) {
+                if (last && last->textures[unit] == command->textures[unit] && last->texture_target == command->texture_target) { continue; }
+                glActiveTexture(GL_TEXTURE0 + unit);
+                glBindTexture(command->texture_target, command->textures[unit]);
+                queue->texture_binds++;
+            }
+            glActiveTexture(GL_TEXTURE0);
+        }
+
+        /* Draws sharing the state and primitive end up next to each other after sorting,
+         * the rest of a run split by `gloadDrawQueue_multiDraw` is issued in the next iteration... */
+        batch = 1;
+        while (i + batch < queue->count && gloadDrawQueue_compatible(command, &queue->commands[items[i + batch].index])) { batch++; }
+        if (batch < 2 || !(batch = gloadDrawQueue_multiDraw(queue, items + i, batch))) {
+            batch = 1;
+            gloadDrawQueue_draw(queue, command);
+        }
+        last = command;
+    }
+    queue->count = 0;
+    if (queue->multidraw) {
+        if (queue->multidraws != multidraws) { glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0); }
+        gloadStreamBufferNextFrame(&queue->indirect);
+    }
+}
+
+#  endif /* GLOAD_DRAW_QUEUE */
+#
+#  if defined (GLOAD_VERTEX_ARRAY_CACHE)
+
+/* SECTION:
+ *  gload vertex array cache API
+ * * * * * * * * * * * * * * * */
+
+/* `gloadVertexArrayCache_canonicalize`:
+ *
+ * Write the canonical form of `layout` into `key`.
+ *
+ * - return: `true` on success, `false` if the layout is invalid.
+ * */
+static int  gloadVertexArrayCache_canonicalize(const t_gloadVertexLayout *layout, GLuint *key) {
+    const t_gloadVertexAttrib   *sorted[GLOAD_VERTEX_LAYOUT_MAX_ATTRIBS];
+    const t_gloadVertexAttrib   *attrib;
+    GLuint                      *out;
+    GLuint                      j;
+
+    if (layout->attrib_count > GLOAD_VERTEX_LAYOUT_MAX_ATTRIBS || layout->binding_count > GLOAD_VERTEX_LAYOUT_MAX_BINDINGS) { return (0); }
+
+    /* Insertion sort by location: layouts are short... */
+    for (GLuint i = 0; i < layout->attrib_count; i++) {
+        attrib = &layout->attribs[i];
+        if (attrib->binding >= layout->binding_count) { return (0); }
+        for (j = i; j > 0 && sorted[j - 1]->location > attrib->location; j--) { sorted[j] = sorted[j - 1]; }
+        if (j > 0 && sorted[j - 1]->location == attrib->location) { return (0); }
+        sorted[j] = attrib;
+    }
+
+    memset(key, 0, GLOAD_VERTEX_LAYOUT_KEY_SIZE * sizeof(GLuint));
+    out = key;
+    *out++ = layout->attrib_count;
+    for (GLuint i = 0; i < layout->attrib_count; i++) {
+        attrib = sorted[i];
+        *out++ = attrib->location;
+        *out++ = (GLuint) attrib->size;
+        *out++ = attrib->type;
+        *out++ = attrib->integer ? 0 : !!attrib->normalized;
+        *out++ = attrib->integer;
+        *out++ = attrib->binding;
+        *out++ = attrib->offset;
+    }
+    out = key + 1 + GLOAD_VERTEX_LAYOUT_MAX_ATTRIBS * 7;
+    *out++ = layout->binding_count;
+    for (GLuint i = 0; i < layout->binding_count; i++) {
+        *out++ = (GLuint) layout->strides[i];
+        *out++ = layout->divisors[i];
+    }
+    return (1);
+}
+
+/* `gloadVertexArrayCache_setup`:
+ *
+ * Create a vertex array and set up the formats of the canonical layout `key`.
+ *
+ * - return: name of the vertex array.
+ * */
+static GLuint   gloadVertexArrayCache_setup(t_gloadVertexArrayCache *cache, const GLuint *key) {
+    const GLuint    *attrib;
+    const GLuint    *binding;
+    GLuint          vao;
+
+    vao = 0;
+    if (cache->dsa) {
+        glCreateVertexArrays(1, &vao);
+    }
+    else {
+        glGenVertexArrays(1, &vao);
+        glBindVertexArray(vao);
+        cache->bound = vao;
+    }
+    if (!vao) { return (0); }
+
+    for (GLuint i = 0; i < key[0]; i++) {
+        attrib = key + 1 + i * 7;
+        if (cache->dsa) {
+            glEnableVertexArrayAttrib(vao, attrib[0]);
+            if (attrib[4] == 2) { glVertexArrayAttribLFormat(vao, attrib[0], (GLint) attrib[1], attrib[2], attrib[6]); }
+            else if (attrib[4]) { glVertexArrayAttribIFormat(vao, attrib[0], (GLint) attrib[1], attrib[2], attrib[6]); }
+            else { glVertexArrayAttribFormat(vao, attrib[0], (GLint) attrib[1], attrib[2], (GLboolean) attrib[3], attrib[6]); }
+            glVertexArrayAttribBinding(vao, attrib[0], attrib[5]);
+        }
+        else {
+            glEnableVertexAttribArray(attrib[0]);
+            if (attrib[4] == 2) { glVertexAttribLFormat(attrib[0], (GLint) attrib[1], attrib[2], attrib[6]); }
+            else if (attrib[4]) { glVertexAttribIFormat(attrib[0], (GLint) attrib[1], attrib[2], attrib[6]); }
+            else { glVertexAttribFormat(attrib[0], (GLint) attrib[1], attrib[2], (GLboolean) attrib[3], attrib[6]); }
+            glVertexAttribBinding(attrib[0], attrib[5]);
+        }
+    }
+    binding = key + 1 + GLOAD_VERTEX_LAYOUT_MAX_ATTRIBS * 7;
+    for (GLuint i = 0; i < binding[0]; i++) {
+        if (!binding[2 + i * 2]) { continue; }
+        if (cache->dsa) { glVertexArrayBindingDivisor(vao, i, binding[2 + i * 2]); }
+        else { glVertexBindingDivisor(i, binding[2 + i * 2]); }
+    }
+    return (vao);
+}
+
+/* `gloadVertexArrayCache_insert`:
+ *
+ * Insert an entry into the open-addressing index, growing it when needed.
+ *
+ * - return: `true` on success, `false` on failure.
+ * */
+static int  gloadVertexArrayCache_insert(t_gloadVertexArrayCache *cache, t_gloadVertexArray *entry) {
+    t_gloadVertexArray  **slots;
+    size_t              i;
+
+    /* Keep the load factor under 50%... */
+    if ((cache->count + 1) * 2 > cache->capacity) {
+        t_gloadVertexArray  **old;
+        GLuint              capacity;
+
+        old = (t_gloadVertexArray **) cache->index;
+        capacity = cache->capacity;
+        cache->capacity = capacity ? capacity * 2 : 64;
+        cache->index = calloc(cache->capacity, sizeof(t_gloadVertexArray *));
+        if (!cache->index) {
+            cache->index = old, cache->capacity = capacity;
+            return (0);
+        }
+        cache->count = 0;
+        for (GLuint j = 0; j < capacity; j++) {
+            if (old[j]) { gloadVertexArrayCache_insert(cache, old[j]); }
+        }
+        free(old);
+    }
+
+    slots = (t_gloadVertexArray **) cache->index;
+    for (i = (size_t) entry->hash & (cache->capacity - 1); slots[i]; i = (i + 1) & (cache->capacity - 1)) {}
+    slots[i] = entry;
+    cache->count++;
+    return (1);
+}
+
+/* `gloadVertexArrayCache_lookup`:
+ *
+ * - return: entry of `layout`, created on the first use; null on failure.
+ * */
+static t_gloadVertexArray  *gloadVertexArrayCache_lookup(t_gloadVertexArrayCache *cache, const t_gloadVertexLayout *layout) {
+    t_gloadVertexArray  **slots;
+    t_gloadVertexArray  *entry;
+    GLuint              key[GLOAD_VERTEX_LAYOUT_KEY_SIZE];
+    GLuint64            hash;
+
+    if (!gloadVertexArrayCache_canonicalize(layout, key)) { return (0); }
+    hash = gloadInternal_hash(0xcbf29ce484222325ull, key, sizeof(key));
+
+    if (cache->capacity) {
+        slots = (t_gloadVertexArray **) cache->index;
+        for (size_t i = (size_t) hash & (cache->capacity - 1); slots[i]; i = (i + 1) & (cache->capacity - 1)) {
+            if (slots[i]->hash == hash && !memcmp(slots[i]->key, key, sizeof(key))) {
+                cache->hits++;
+                return (slots[i]);
+            }
+        }
+    }
+
+    entry = (t_gloadVertexArray *) calloc(1, sizeof(t_gloadVertexArray));
+    if (!entry) { return (0); }
+    entry->hash = hash;
+    memcpy(entry->key, key, sizeof(key));
+    entry->vao = gloadVertexArrayCache_setup(cache, key);
+    if (!entry->vao || !gloadVertexArrayCache_insert(cache, entry)) {
+        if (entry->vao) { glDeleteVertexArrays(1, &entry->vao); }
+        free(entry);
+        return (0);
+    }
+    cache->misses++;
+    return (entry);
+}
+
+/* `gloadVertexArrayCacheCreate`:
+ *
+ * Create an empty vertex array cache for the current context.
+ * NOTE:
+ *  This function requires a current context and loaded OpenGL functions.
+ *
+ * - param: `t_gloadVertexArrayCache *cache` - cache to initialize
+ * - return: `true` on success, `false` if the context supports neither OpenGL 4.3 nor GL_ARB_vertex_attrib_binding.
+ * */
+GLAPI int   gloadVertexArrayCacheCreate(t_gloadVertexArrayCache *cache) {
+    if (!cache) { return (0); }
+    memset(cache, 0, sizeof(t_gloadVertexArrayCache));
+
+    cache->dsa = glCreateVertexArrays && glVertexArrayAttribFormat && glVertexArrayVertexBuffer && glVertexArrayElementBuffer &&
+                 (gloadIsVersionSupported(4, 5) || gloadIsExtensionSupported("GL_ARB_direct_state_access"));
+    cache->multibind = glBindVertexBuffers != 0 && (gloadIsVersionSupported(4, 4) || gloadIsExtensionSupported("GL_ARB_multi_bind"));
+    if (!cache->dsa && !(glVertexAttribFormat && glBindVertexBuffer &&
+                         (gloadIsVersionSupported(4, 3) || gloadIsExtensionSupported("GL_ARB_vertex_attrib_binding")))) {
+
+#   if defined (GLOAD_VERBOSE_ERROR)
+        fprintf(stderr, "gload.h: vertex array cache requires OpenGL 4.3 or GL_ARB_vertex_attrib_binding.\n");
+#   endif /* GLOAD_VERBOSE_ERROR */
+
+        return (0);
+    }
+    return (1);
+}
+
+/* `gloadVertexArrayCacheDestroy`:
+ *
+ * Delete every cached vertex array and release the cache.
+ *
+ * - param: `t_gloadVertexArrayCache *cache` - cache to destroy
+ * */
+GLAPI void  gloadVertexArrayCacheDestroy(t_gloadVertexArrayCache *cache) {
+    t_gloadVertexArray  **slots;
+
+    if (!cache) { return; }
+
+    slots = (t_gloadVertexArray **) cache->index;
+    for (GLuint i = 0; i < cache->capacity; i++) {
+        if (!slots[i]) { continue; }
+        glDeleteVertexArrays(1, &slots[i]->vao);
+        free(slots[i]);
+    }
+    free(cache->index);
+    memset(cache, 0, sizeof(t_gloadVertexArrayCache));
+}
+
+/* `gloadVertexArrayCacheGet`:
+ *
+ * Find the vertex array of a layout, creating and setting it up on the first use.
+ * Look the layout up once, i.e. when loading a mesh, and keep the result for `gloadVertexArrayCacheBind`.
+ *
+ * - param: `t_gloadVertexArrayCache *cache` - cache
+ * - param: `const t_gloadVertexLayout *layout` - vertex layout
+ * - return: vertex array on success, null on failure.
+ * */
+GLAPI t_gloadVertexArray  *gloadVertexArrayCacheGet(t_gloadVertexArrayCache *cache, const t_gloadVertexLayout *layout) {
+    if (!cache || !layout) { return (0); }
+
+    return (gloadVertexArrayCache_lookup(cache, layout));
+}
+
+/* `gloadVertexArrayCacheBind`:
+ *
+ * Bind a vertex array returned from `gloadVertexArrayCacheGet` along with its vertex and index buffers.
+ * Buffers already attached to the vertex array aren't bound again.
+ * NOTE:
+ *  With a vertex array bound by other means in between, call with a null `array` to reset the binding tracked by the cache.
+ *
+ * - param: `t_gloadVertexArrayCache *cache` - cache
+ * - param: `t_gloadVertexArray *array` - vertex array of the layout
+ * - param: `const GLuint *buffers` - vertex buffer of every binding (one name per binding of the layout)
+ * - param: `const GLintptr *offsets` - offset into every vertex buffer (can be null for all zeroes)
+ * - param: `GLuint index_buffer` - index buffer, 0 for none
+ * - return: name of the bound vertex array on success, 0 on failure.
+ * */
+GLAPI GLuint    gloadVertexArrayCacheBind(t_gloadVertexArrayCache *cache, t_gloadVertexArray *array, const GLuint *buffers, const GLintptr *offsets, GLuint index_buffer) {
+    const GLuint    *binding;
+    GLuint          count;
+    GLuint          first;
+    GLuint          last;
+
+    if (!cache) { return (0); }
+    if (!array) {
+        cache->bound = 0;
+        return (0);
+    }
+
+    /* Strides and the number of bindings come from the canonical layout... */
+    binding = array->key + 1 + GLOAD_VERTEX_LAYOUT_MAX_ATTRIBS * 7;
+    count = binding[0];
+    if (count && !buffers) { return (0); }
+    if (cache->bound != array->vao) {
+        glBindVertexArray(array->vao);
+        cache->bound = array->vao;
+    }
+
+    /* Find the range of bindings that changed... */
+    first = count, last = 0;
+    for (GLuint i = 0; i < count; i++) {
+        if (array->buffers[i] != buffers[i] || array->offsets[i] != (offsets ? offsets[i] : 0)) {
+            if (first > i) { first = i; }
+            last = i + 1;
+        }
+    }
+    if (first < last && cache->multibind) {
+        GLintptr    zeroes[GLOAD_VERTEX_LAYOUT_MAX_BINDINGS];
+        GLsizei     strides[GLOAD_VERTEX_LAYOUT_MAX_BINDINGS];
+
+        memset(zeroes, 0, sizeof(zeroes));
+        for (GLuint i = 0; i < count; i++) { strides[i] = (GLsizei) binding[1 + i * 2]; }
+        glBindVertexBuffers(first, last - first, buffers + first, (offsets ? offsets : zeroes) + first, strides + first);
+        cache->buffer_binds++;
+    }
+    else {
+        for (GLuint i = first; i < last; i++) {
+            if (array->buffers[i] == buffers[i] && array->offsets[i] == (offsets ? offsets[i] : 0)) { continue; }
+            if (cache->dsa) { glVertexArrayVertexBuffer(array->vao, i, buffers[i], offsets ? offsets[i] : 0, (GLsizei) binding[1 + i * 2]); }
+            else { glBindVertexBuffer(i, buffers[i], offsets ? offsets[i] : 0, (GLsizei) binding[1 + i * 2]); }
+            cache->buffer_binds++;
+        }
+    }
+    for (GLuint i = first; i < last; i++) {
+        array->buffers[i] = buffers[i];
+        array->offsets[i] = offsets ? offsets[i] : 0;
+    }
+
+    if (array->index_buffer != index_buffer) {
+        if (cache->dsa) { glVertexArrayElementBuffer(array->vao, index_buffer); }
+        else { glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, index_buffer); }
+        array->index_buffer = index_buffer;
+        cache->buffer_binds++;
+    }
+    return (array->vao);
+}
+
+#  endif /* GLOAD_VERTEX_ARRAY_CACHE */
+#
+#  if defined (GLOAD_PROGRAM_REFLECTION)
+
+/* SECTION:
+ *  gload program reflection API
+ * * * * * * * * * * * * * * * */
+
+/* `gloadProgramReflection_key`:
+ *
+ * - return: key of a resource in the table, so names of different kinds don't collide.
+ * */
+static GLuint64 gloadProgramReflection_key(GLenum kind, GLuint64 handle) {
+    return (handle ^ ((GLuint64) kind << 32));
+}
+
+/* `gloadProgramReflection_slot`:
+ *
+ * - return: slot of `key` in a table of `mask + 1` slots.
+ * */
+static GLuint   gloadProgramReflection_slot(GLuint64 key, GLuint64 seed, GLuint mask) {
+    /* Seeds are mixed in before the finalizer, so the bucket and the slot of a key are unrelated... */
+    key ^= seed * 0x9e3779b97f4a7c15ull;
+    key = (key ^ (key >> 33)) * 0xff51afd7ed558ccdull;
+    key = (key ^ (key >> 33)) * 0xc4ceb9fe1a85ec53ull;
+    return ((GLuint) (key ^ (key >> 33)) & mask);
+}
+
+/* `gloadProgramReflection_add`:
+ *
+ * Append a resource, copying its name into the name pool.
+ * Names of arrays ("name[0]") are also added without the subscript.
+ *
+ * - return: `true` on success, `false` on failure.
+ * */
+static int  gloadProgramReflection_add(t_gloadProgramReflection *reflection, GLuint *capacity, size_t *pool, size_t *used,
+                                       const char *name, GLenum kind, GLenum type, GLint size, GLint location, GLint binding, GLint data_size) {
+    t_gloadProgramResource  *resource;
+    size_t                  length;
+
+    length = strlen(name);
+    if (reflection->count == *capacity) {
+        t_gloadProgramResource  *resources;
+
+        resources = (t_gloadProgramResource *) realloc(reflection->resources, (*capacity ? *capacity * 2 : 32) * sizeof(t_gloadProgramResource));
+        if (!resources) { return (0); }
+        reflection->resources = resources;
+        *capacity = *capacity ? *capacity * 2 : 32;
+    }
+    if (*used + length + 1 > *pool) {
+        char    *names;
+
+        while (*used + length + 1 > *pool) { *pool = *pool ? *pool * 2 : 1024; }
+        names = (char *) realloc(reflection->names, *pool);
+        if (!names) { return (0); }
+        reflection->names = names;
+    }
+
+    /* Names point into the pool, which may still move; they're stored as offsets until the end... */
+    memcpy(reflection->names + *used, name, length + 1);
+    resource = &reflection->resources[reflection->count++];
+    resource->handle = gloadInternal_hash(0xcbf29ce484222325ull, name, length);
+    resource->name = (const char *) (uintptr_t) *used;
+    resource->kind = kind;
+    resource->type = type;
+    resource->size = size;
+    resource->location = location;
+    resource->binding = binding;
+    resource->data_size = data_size;
+    *used += length + 1;
+
+    if (length > 3 && !strcmp(name + length - 3, "[0]")) {
+        char    base[256];
+
+        if (length - 3 >= sizeof(base)) { return (1); }
+        memcpy(base, name, length - 3), base[length - 3] = 0;
+        return (gloadProgramReflection_add(reflection, capacity, pool, used, base, kind, type, size, location, binding, data_size));
+    }
+    return (1);
+}
+
+/* `gloadProgramReflection_bucket`:
+ *
+ * - return: bucket of the resource at `index`.
+ * */
+static GLuint   gloadProgramReflection_bucket(const t_gloadProgramReflection *reflection, GLuint index) {
+    const t_gloadProgramResource    *resource;
+
+    resource = &reflection->resources[index];
+    return (gloadProgramReflection_slot(gloadProgramReflection_key(resource->kind, resource->handle), 0, reflection->buckets));
+}
+
+/* `gloadProgramReflection_place`:
+ *
+ * Find the first displacement that puts every resource of a bucket in a free slot, and fill the slots.
+ * Duplicate keys are marked as 0xFFFFFFFF beforehand and skipped.
+ *
+ * - return: displacement on success, 0 on failure.
+ * */
+static GLuint   gloadProgramReflection_place(t_gloadProgramReflection *reflection, const GLuint *members, GLuint count) {
+    GLuint  slot;
+    GLuint  i;
+
+    for (GLuint displace = 1; displace < 0x100000; displace++) {
+        for (i = 0; i < count; i++) {
+            if (members[i] == 0xFFFFFFFF) { continue; }
+            slot = gloadProgramReflection_slot(gloadProgramReflection_key(reflection->resources[members[i]].kind, reflection->resources[members[i]].handle), displace, reflection->mask);
+            if (reflection->table[slot] != 0xFFFFFFFF) { break; }
+            reflection->table[slot] = members[i];
+        }
+        if (i == count) { return (displace); }
+
+        /* Take back the slots filled with this displacement... */
+        while (i-- > 0) {
+            if (members[i] == 0xFFFFFFFF) { continue; }
+            slot = gloadProgramReflection_slot(gloadProgramReflection_key(reflection->resources[members[i]].kind, reflection->resources[members[i]].handle), displace, reflection->mask);
+            reflection->table[slot] = 0xFFFFFFFF;
+        }
+    }
+    return (0);
+}
+
+/* `gloadProgramReflection_build`:
+ *
+ * Build a perfect hash of the resources with hash-and-displace (CHD):
+ * resources are split in buckets of about 4, and the buckets, largest first,
+ * get the first displacement that maps their resources to free slots.
+ *
+ * - return: `true` on success, `false` on failure.
+ * */
+static int  gloadProgramReflection_build(t_gloadProgramReflection *reflection) {
+    GLuint  *start;
+    GLuint  *members;
+    GLuint  *order;
+    GLuint  buckets;
+    GLuint  largest;
+    GLuint  size;
+    GLuint  n;
+    int     result;
+
+    buckets = 1;
+    while (buckets * 4 < reflection->count) { buckets *= 2; }
+    size = 8;
+    while (size < reflection->count * 2) { size *= 2; }
+    reflection->mask = size - 1;
+    reflection->buckets = buckets - 1;
+    reflection->table = (GLuint *) malloc(size * sizeof(GLuint));
+    reflection->displace = (GLuint *) calloc(buckets, sizeof(GLuint));
+    start = (GLuint *) calloc(buckets + 1, sizeof(GLuint));
+    members = (GLuint *) malloc((reflection->count + 1) * sizeof(GLuint));
+    order = (GLuint *) malloc(buckets * sizeof(GLuint));
+    result = reflection->table && reflection->displace && start && members && order;
+    if (result) {
+        memset(reflection->table, 0xFF, size * sizeof(GLuint));
+
+        /* Group the resources by bucket... */
+        for (GLuint i = 0; i < reflection->count; i++) { start[gloadProgramReflection_bucket(reflection, i) + 1]++; }
+        largest = 0;
+        for (GLuint b = 0; b < buckets; b++) {
+            largest = start[b + 1] > largest ? start[b + 1] : largest;
+            start[b + 1] += start[b];
+            order[b] = start[b];
+        }
+        for (GLuint i = 0; i < reflection->count; i++) { members[order[gloadProgramReflection_bucket(reflection, i)]++] = i; }
+
+        /* ... with equal keys (a name reflected twice) only reachable once... */
+        for (GLuint i = 0; i < reflection->count; i++) {
+            for (GLuint j = start[gloadProgramReflection_bucket(reflection, members[i])]; j < i; j++) {
+                if (members[j] != 0xFFFFFFFF &&
+                    reflection->resources[members[j]].kind == reflection->resources[members[i]].kind &&
+                    reflection->resources[members[j]].handle == reflection->resources[members[i]].handle) {
+                    members[i] = 0xFFFFFFFF;
+                    break;
+                }
+            }
+        }
+
+        /* ... then place the buckets from the largest one down; empty buckets keep displacement 0 */
+        n = 0;
+        for (GLuint length = largest; length > 0; length--) {
+            for (GLuint b = 0; b < buckets; b++) {
+                if (start[b + 1] - start[b] == length) { order[n++] = b; }
+            }
+        }
+        for (GLuint i = 0; i < n && result; i++) {
+            reflection->displace[order[i]] = gloadProgramReflection_place(reflection, members + start[order[i]], start[order[i] + 1] - start[order[i]]);
+            result = reflection->displace[order[i]] != 0;
+        }
+    }
+    free(start);
+    free(members);
+    free(order);
+    return (result);
+}
+
+/* `gloadProgramReflection_queryInterface`:
+ *
+ * Reflect a single program interface through `glGetProgramResource*`.
+ *
+ * - return: `true` on success, `false` on failure.
+ * */
+static int  gloadProgramReflection_queryInterface(t_gloadProgramReflection *reflection, GLenum kind, GLuint *capacity, size_t *pool, size_t *used) {
+    const GLenum    variable[4] = { GL_TYPE, GL_ARRAY_SIZE, GL_LOCATION, GL_BLOCK_INDEX };
+    const GLenum    block[2] = { GL_BUFFER_BINDING, GL_BUFFER_DATA_SIZE };
+    GLint           values[4];
+    GLint           count;
+    GLint           length;
+    char            *name;
+
+    count = length = 0;
+    glGetProgramInterfaceiv(reflection->program, kind, GL_ACTIVE_RESOURCES, &count);
+    glGetProgramInterfaceiv(reflection->program, kind, GL_MAX_NAME_LENGTH, &length);
+    if (count <= 0) { return (1); }
+
+    name = (char *) malloc((size_t) length + 1);
+    if (!name) { return (0); }
+    for (GLint i = 0; i < count; i++) {
+        glGetProgramResourceName(reflection->program, kind, (GLuint) i, length + 1, 0, name);
+        if (kind == GL_UNIFORM_BLOCK || kind == GL_SHADER_STORAGE_BLOCK) {
+            glGetProgramResourceiv(reflection->program, kind, (GLuint) i, 2, block, 2, 0, values);
+            if (!gloadProgramReflection_add(reflection, capacity, pool, used, name, kind, 0, 1, i, values[0], values[1])) {
+                free(name);
+                return (0);
+            }
+            continue;
+        }
+
+        /* Uniforms and attributes have no block index... */
+        values[3] = -1;
+        glGetProgramResourceiv(reflection->program, kind, (GLuint) i, kind == GL_UNIFORM ? 4 : 3, variable, 4, 0, values);
+        if (values[3] != -1) { continue; }
+        if (!gloadProgramReflection_add(reflection, capacity, pool, used, name, kind, (GLenum) values[0], values[1], values[2], -1, 0)) {
+            free(name);
+            return (0);
+        }
+    }
+    free(name);
+    return (1);
+}
+
+/* `gloadProgramReflection_queryActive`:
+ *
+ * Reflect the program through the pre-4.3 queries.
+ *
+ * - return: `true` on success, `false` on failure.
+ * */
+static int  gloadProgramReflection_queryActive(t_gloadProgramReflection *reflection, GLuint *capacity, size_t *pool, size_t *used) {
+    GLint   count;
+    GLint   length;
+    GLint   size;
+    GLenum  type;
+    GLint   values[2];
+    char    *name;
+
+    length = 0;
+    glGetProgramiv(reflection->program, GL_ACTIVE_UNIFORM_MAX_LENGTH, &values[0]);
+    length = values[0] > length ? values[0] : length;
+    glGetProgramiv(reflection->program, GL_ACTIVE_ATTRIBUTE_MAX_LENGTH, &values[0]);
+    length = values[0] > length ? values[0] : length;
+    if (glGetActiveUniformBlockName) {
+        values[0] = 0;
+        glGetProgramiv(reflection->program, GL_ACTIVE_UNIFORM_BLOCK_MAX_NAME_LENGTH, &values[0]);
+        length = values[0] > length ? values[0] : length;
+    }
+
+    name = (char *) malloc((size_t) length + 1);
+    if (!name) { return (0); }
+
+    count = 0;
+    glGetProgramiv(reflection->program, GL_ACTIVE_UNIFORMS, &count);
+    for (GLint i = 0; i < count; i++) {
+        glGetActiveUniform(reflection->program, (GLuint) i, length + 1, 0, &size, &type, name);
+
+        /* Members of uniform blocks have no location... */
+        values[0] = glGetUniformLocation(reflection->program, name);
+        if (values[0] == -1) { continue; }
+        if (!gloadProgramReflection_add(reflection, capacity, pool, used, name, GL_UNIFORM, type, size, values[0], -1, 0)) {
+            free(name);
+            return (0);
+        }
+    }
+
+    count = 0;
+    glGetProgramiv(reflection->program, GL_ACTIVE_ATTRIBUTES, &count);
+    for (GLint i = 0; i < count; i++) {
+        glGetActiveAttrib(reflection->program, (GLuint) i, length + 1, 0, &size, &type, name);
+        values[0] = glGetAttribLocation(reflection->program, name);
+        if (!gloadProgramReflection_add(reflection, capacity, pool, used, name, GL_PROGRAM_INPUT, type, size, values[0], -1, 0)) {
+            free(name);
+            return (0);
+        }
+    }
+
+    count = 0;
+    if (glGetActiveUniformBlockName && glGetActiveUniformBlockiv) {
+        glGetProgramiv(reflection->program, GL_ACTIVE_UNIFORM_BLOCKS, &count);
+    }
+    for (GLint i = 0; i < count; i++) {
+        glGetActiveUniformBlockName(reflection->program, (GLuint) i, length + 1, 0, name);
+        glGetActiveUniformBlockiv(reflection->program, (GLuint) i, GL_UNIFORM_BLOCK_BINDING, &values[0]);
+        glGetActiveUniformBlockiv(reflection->program, (GLuint) i, GL_UNIFORM_BLOCK_DATA_SIZE, &values[1]);
+        if (!gloadProgramReflection_add(reflection, capacity, pool, used, name, GL_UNIFORM_BLOCK, 0, 1, i, values[0], values[1])) {
+            free(name);
+            return (0);
+        }
+    }
+    free(name);
+    return (1);
+}
+
+/* `gloadProgramReflectionHash`:
+ *
+ * Compute the handle of a resource name (64-bit FNV-1a).
+ * NOTE:
+ *  In C++11 and newer, `gloadProgramReflectionHashConst` computes the same handle at compile time.
+ *
+ * - param: `const char *name` - name of the resource
+ * - return: handle of the name.
+ * */
+GLAPI GLuint64  gloadProgramReflectionHash(const char *name) {
+    if (!name) { return (0); }
+    return (gloadInternal_hash(0xcbf29ce484222325ull, name, strlen(name)));
+}
+
+/* `gloadProgramReflectionCreate`:
+ *
+ * Reflect the resources of a linked program.
+ * NOTE:
+ *  This function requires a current context and loaded OpenGL functions.
+ *
+ * - param: `t_gloadProgramReflection *reflection` - reflection to initialize
+ * - param: `GLuint program` - linked program
+ * - return: `true` on success, `false` on failure.
+ * */
+GLAPI int   gloadProgramReflectionCreate(t_gloadProgramReflection *reflection, GLuint program) {
+    GLuint  capacity;
+    size_t  pool;
+    size_t  used;
+    GLint   status;
+    int     result;
+
+    if (!reflection) { return (0); }
+    memset(reflection, 0, sizeof(t_gloadProgramReflection));
+
+    status = 0;
+    glGetProgramiv(program, GL_LINK_STATUS, &status);
+    if (!status) { return (0); }
+
+    reflection->program = program;
+    capacity = 0, pool = 0, used = 0;
+    if (glGetProgramInterfaceiv && glGetProgramResourceName && glGetProgramResourceiv &&
+        (gloadIsVersionSupported(4, 3) || gloadIsExtensionSupported("GL_ARB_program_interface_query"))) {
+        result = gloadProgramReflection_queryInterface(reflection, GL_UNIFORM, &capacity, &pool, &used) &&
+                 gloadProgramReflection_queryInterface(reflection, GL_UNIFORM_BLOCK, &capacity, &pool, &used) &&
+                 gloadProgramReflection_queryInterface(reflection, GL_SHADER_STORAGE_BLOCK, &capacity, &pool, &used) &&
+                 gloadProgramReflection_queryInterface(reflection, GL_PROGRAM_INPUT, &capacity, &pool, &used);
+    }
+    else {
+        result = gloadProgramReflection_queryActive(reflection, &capacity, &pool, &used);
+    }
+    if (!result || !gloadProgramReflection_build(reflection)) {
+        gloadProgramReflectionDestroy(reflection);
+        return (0);
+    }
+
+    for (GLuint i = 0; i < reflection->count; i++) {
+        reflection->resources[i].name = reflection->names + (uintptr_t) reflection->resources[i].name;
+    }
+    return (1);
+}
+
+/* `gloadProgramReflectionDestroy`:
+ *
+ * Release the reflection. The program itself is left untouched.
+ *
+ * - param: `t_gloadProgramReflection *reflection` - reflection to destroy
+ * */
+GLAPI void  gloadProgramReflectionDestroy(t_gloadProgramReflection *reflection) {
+    if (!reflection) { return; }
+
+    free(reflection->resources);
+    free(reflection->table);
+    free(reflection->displace);
+    free(reflection->names);
+    memset(reflection, 0, sizeof(t_gloadProgramReflection));
+}
+
+/* `gloadProgramReflectionFind`:
+ *
+ * Find a resource by its handle.
+ *
+ * - param: `const t_gloadProgramReflection *reflection` - reflection
+ * - param: `GLenum kind` - kind of the resource (i.e. `GL_UNIFORM`)
+ * - param: `GLuint64 handle` - handle of the name, from `gloadProgramReflectionHash`
+ * - return: the resource on success, null if the program has no such resource.
+ * */
+GLAPI const t_gloadProgramResource  *gloadProgramReflectionFind(const t_gloadProgramReflection *reflection, GLenum kind, GLuint64 handle) {
+    const t_gloadProgramResource    *resource;
+    GLuint64                        key;
+    GLuint                          index;
+
+    if (!reflection || !reflection->table) { return (0); }
+
+    key = gloadProgramReflection_key(kind, handle);
+    index = reflection->table[gloadProgramReflection_slot(key, reflection->displace[gloadProgramReflection_slot(key, 0, reflection->buckets)], reflection->mask)];
+    if (index >= reflection->count) { return (0); }
+    resource = &reflection->resources[index];
+    return (resource->handle == handle && resource->kind == kind ? resource : 0);
+}
+
+/* `gloadProgramReflectionLocation`:
+ *
+ * Find the location of a uniform by its handle, to use with `glProgramUniform*` or `glUniform*`.
+ *
+ * - param: `const t_gloadProgramReflection *reflection` - reflection
+ * - param: `GLuint64 handle` - handle of the name, from `gloadProgramReflectionHash`
+ * - return: location of the uniform, -1 if the program has no such uniform.
+ * */
+GLAPI GLint gloadProgramReflectionLocation(const t_gloadProgramReflection *reflection, GLuint64 handle) {
+    const t_gloadProgramResource    *resource;
+
+    resource = gloadProgramReflectionFind(reflection, GL_UNIFORM, handle);
+    return (resource ? resource->location : -1);
+}
+
+#  endif /* GLOAD_PROGRAM_REFLECTION */
+#
+#  if defined (GLOAD_OBJECT_CACHE)
+
+/* SECTION:
+ *  gload object cache API
+ * * * * * * * * * * * * */
+
+/* `struct s_gloadObjectCacheEntry` - header of a cached object.
+ * Entries with `object` 0 are free; `used` is the tick of the last lookup, for LRU eviction,
+ * and `frame` the frame of the last lookup, which can't be evicted.
+ * */
+struct s_gloadObjectCacheEntry {
+    GLuint64    hash;
+    GLuint64    used;
+    GLuint64    frame;
+    GLuint      object;
+};
+
+struct s_gloadSamplerEntry {
+    struct s_gloadObjectCacheEntry  entry;
+    t_gloadSamplerDesc              desc;
+};
+
+struct s_gloadFramebufferEntry {
+    struct s_gloadObjectCacheEntry  entry;
+    t_gloadFramebufferDesc          desc;
+};
+
+/* `static struct s_gloadObjectCache g_objects` - state of the object caches.
+ * Descriptions are made of 32-bit fields only, so they're hashed and compared as a whole.
+ * */
+static struct s_gloadObjectCache {
+    int                         init;
+    int                         dsa;
+    GLuint64                    tick;
+    GLuint64                    frame;
+    t_gloadObjectCacheStats     stats;
+
+    struct s_gloadSamplerEntry      samplers[GLOAD_OBJECT_CACHE_SAMPLERS];
+    struct s_gloadFramebufferEntry  framebuffers[GLOAD_OBJECT_CACHE_FRAMEBUFFERS];
+
+    /* original procedures */
+    PFNGLDELETETEXTURESPROC     orig_glDeleteTextures;
+}   g_objects;
+
+/* `gloadObjectCache_glDeleteTextures`:
+ *
+ * Release every cached framebuffer with one of the deleted textures attached, then delete the textures.
+ * */
+static void APIENTRY    gloadObjectCache_glDeleteTextures(GLsizei n, const GLuint *textures) {
+    for (GLuint i = 0; i < GLOAD_OBJECT_CACHE_FRAMEBUFFERS; i++) {
+        const t_gloadFramebufferDesc    *desc;
+        int                             attached;
+
+        if (!g_objects.framebuffers[i].entry.object) { continue; }
+        desc = &g_objects.framebuffers[i].desc;
+        attached = 0;
+        for (GLsizei j = 0; j < n && !attached; j++) {
+            if (!textures[j]) { continue; }
+            attached = desc->depth == textures[j];
+            for (GLuint k = 0; k < GLOAD_OBJECT_CACHE_MAX_COLOR_ATTACHMENTS && !attached; k++) {
+                attached = desc->colors[k] == textures[j];
+            }
+        }
+        if (attached) {
+            glDeleteFramebuffers(1, &g_objects.framebuffers[i].entry.object);
+            g_objects.framebuffers[i].entry.object = 0;
+            g_objects.stats.invalidations++;
+        }
+    }
+    g_objects.orig_glDeleteTextures(n, textures);
+}
+
+/* `gloadObjectCache_slot`:
+ *
+ * Find the entry of `hash` and `desc` among `count` entries of `stride` bytes (description at `offset`),
+ * or the entry to replace: a free one, or the least recently used one not looked up in the current frame.
+ *
+ * - return: index of the entry, `count` if every entry is used in the current frame; `*found` tells whether it holds `desc`.
+ * */
+static GLuint   gloadObjectCache_slot(void *entries, size_t stride, size_t offset, GLuint count, GLuint64 hash, const void *desc, size_t size, int *found) {
+    const struct s_gloadObjectCacheEntry    *entry;
+    GLuint64                                oldest;
+    GLuint64                                used;
+    GLuint                                  victim;
+
+    victim = count, oldest = ~(GLuint64) 0;
+    for (GLuint i = 0; i < count; i++) {
+        entry = (const struct s_gloadObjectCacheEntry *) ((GLubyte *) entries + i * stride);
+        if (entry->object && entry->hash == hash && !memcmp((const GLubyte *) entry + offset, desc, size)) {
+            *found = 1;
+            return (i);
+        }
+        if (entry->object && entry->frame == g_objects.frame) { continue; }
+        used = entry->object ? entry->used : 0;
+        if (used < oldest) { oldest = used, victim = i; }
+    }
+    *found = 0;
+    return (victim);
+}
+
+/* `gloadObjectCacheInit`:
+ *
+ * Initialize the object caches and start tracking `glDeleteTextures`.
+ * NOTE:
+ *  This function requires a current context and loaded OpenGL functions (OpenGL 3.3 or GL_ARB_sampler_objects).
+ *
+ * - return: `true` on success, `false` on failure.
+ * */
+GLAPI int   gloadObjectCacheInit(void) {
+    PFNGLDELETETEXTURESPROC orig;
+
+    if (g_objects.init) { return (1); }
+    if (!glGenSamplers || !glSamplerParameteri || !glGenFramebuffers || !glDeleteTextures ||
+        !(gloadIsVersionSupported(3, 3) || gloadIsExtensionSupported("GL_ARB_sampler_objects"))) {
+        return (0);
+    }
+
+    orig = g_objects.orig_glDeleteTextures;
+    memset(&g_objects, 0, sizeof(g_objects));
+    g_objects.dsa = glCreateSamplers && glCreateFramebuffers && glNamedFramebufferTexture && glNamedFramebufferTextureLayer &&
+                    glNamedFramebufferDrawBuffers && glCheckNamedFramebufferStatus &&
+                    (gloadIsVersionSupported(4, 5) || gloadIsExtensionSupported("GL_ARB_direct_state_access"));
+
+    /* The hook may still be installed under another one since the last `gloadObjectCacheTerminate`... */
+    if (orig) { g_objects.orig_glDeleteTextures = orig; }
+    else {
+        g_objects.orig_glDeleteTextures = gload_glDeleteTextures;
+        gload_glDeleteTextures = gloadObjectCache_glDeleteTextures;
+    }
+    g_objects.frame = 1;
+    g_objects.init = 1;
+    return (1);
+}
+
+/* `gloadObjectCacheTerminate`:
+ *
+ * Delete every cached object and stop tracking `glDeleteTextures`.
+ * */
+GLAPI void  gloadObjectCacheTerminate(void) {
+    PFNGLDELETETEXTURESPROC orig;
+
+    if (!g_objects.init) { return; }
+
+    for (GLuint i = 0; i < GLOAD_OBJECT_CACHE_SAMPLERS; i++) {
+        if (g_objects.samplers[i].entry.object) { glDeleteSamplers(1, &g_objects.samplers[i].entry.object); }
+    }
+    for (GLuint i = 0; i < GLOAD_OBJECT_CACHE_FRAMEBUFFERS; i++) {
+        if (g_objects.framebuffers[i].entry.object) { glDeleteFramebuffers(1, &g_objects.framebuffers[i].entry.object); }
+    }
+    orig = g_objects.orig_glDeleteTextures;
+    memset(&g_objects, 0, sizeof(g_objects));
+
+    /* If another hook was installed on top of this one, it still calls it: keep forwarding to the original procedure... */
+    if (gload_glDeleteTextures == gloadObjectCache_glDeleteTextures) { gload_glDeleteTextures = orig; }
+    else { g_objects.orig_glDeleteTextures = orig; }
+}
+
+/* `gloadObjectCacheNextFrame`:
+ *
+ * Start a new frame: objects returned before this call may be evicted by the next lookups.
+ * Objects are only evicted when the cache is full, so names can be kept across frames as long as they're looked up again.
+ * */
+GLAPI void  gloadObjectCacheNextFrame(void) {
+    if (!g_objects.init) { return; }
+    g_objects.frame++;
+}
+
+/* `gloadObjectCacheGetStats`:
+ *
+ * - param: `t_gloadObjectCacheStats *stats` - statistics of the object caches
+ * */
+GLAPI void  gloadObjectCacheGetStats(t_gloadObjectCacheStats *stats) {
+    if (!stats) { return; }
+    *stats = g_objects.stats;
+}
+
+/* `gloadSamplerDefaults`:
+ *
+ * Initialize a sampler description with the default state of OpenGL.
+ *
+ * - param: `t_gloadSamplerDesc *desc` - description to initialize
+ * */
+GLAPI void  gloadSamplerDefaults(t_gloadSamplerDesc *desc) {
+    if (!desc) { return; }
+
+    memset(desc, 0, sizeof(t_gloadSamplerDesc));
+    desc->min_filter = GL_NEAREST_MIPMAP_LINEAR;
+    desc->mag_filter = GL_LINEAR;
+    desc->wrap_s = desc->wrap_t = desc->wrap_r = GL_REPEAT;
+    desc->min_lod = -1000.0f;
+    desc->max_lod = 1000.0f;
+    desc->max_anisotropy = 1.0f;
+    desc->compare_mode = GL_NONE;
+    desc->compare_func = GL_LEQUAL;
+}
+
+/* `gloadSamplerCacheGet`:
+ *
+ * Find the sampler object of a description, creating it on the first use.
+ * The sampler is owned by the cache; don't delete it.
+ *
+ * - param: `const t_gloadSamplerDesc *desc` - sampler description
+ * - return: name of the sampler on success, 0 on failure.
+ * */
+GLAPI GLuint    gloadSamplerCacheGet(const t_gloadSamplerDesc *desc) {
+    GLuint64    hash;
+    GLuint      slot;
+    GLuint      sampler;
+    int         found;
+
+    if (!g_objects.init || !desc) { return (0); }
+
+    hash = gloadInternal_hash(0xcbf29ce484222325ull, desc, sizeof(t_gloadSamplerDesc));
+    slot = gloadObjectCache_slot(g_objects.samplers, sizeof(struct s_gloadSamplerEntry), offsetof(struct s_gloadSamplerEntry, desc),
+                                 GLOAD_OBJECT_CACHE_SAMPLERS, hash, desc, sizeof(t_gloadSamplerDesc), &found);
+    if (found) {
+        g_objects.samplers[slot].entry.used = ++g_objects.tick;
+        g_objects.samplers[slot].entry.frame = g_objects.frame;
+        g_objects.stats.sampler_hits++;
+        return (g_objects.samplers[slot].entry.object);
+    }
+    if (slot == GLOAD_OBJECT_CACHE_SAMPLERS) {
+
+#   if defined (GLOAD_VERBOSE_ERROR)
+        fprintf(stderr, "gload.h: every sampler of the cache is used in this frame.\n");
+#   endif /* GLOAD_VERBOSE_ERROR */
+
+        return (0);
+    }
+
+    sampler = 0;
+    if (g_objects.dsa) { glCreateSamplers(1, &sampler); }
+    else { glGenSamplers(1, &sampler); }
+    if (!sampler) { return (0); }
+    glSamplerParameteri(sampler, GL_TEXTURE_MIN_FILTER, (GLint) desc->min_filter);
+    glSamplerParameteri(sampler, GL_TEXTURE_MAG_FILTER, (GLint) desc->mag_filter);
+    glSamplerParameteri(sampler, GL_TEXTURE_WRAP_S, (GLint) desc->wrap_s);
+    glSamplerParameteri(sampler, GL_TEXTURE_WRAP_T, (GLint) desc->wrap_t);
+    glSamplerParameteri(sampler, GL_TEXTURE_WRAP_R, (GLint) desc->wrap_r);
+    glSamplerParameterf(sampler, GL_TEXTURE_MIN_LOD, desc->min_lod);
+    glSamplerParameterf(sampler, GL_TEXTURE_MAX_LOD, desc->max_lod);
+    glSamplerParameterf(sampler, GL_TEXTURE_LOD_BIAS, desc->lod_bias);
+    glSamplerParameteri(sampler, GL_TEXTURE_COMPARE_MODE, (GLint) desc->compare_mode);
+    glSamplerParameteri(sampler, GL_TEXTURE_COMPARE_FUNC, (GLint) desc->compare_func);
+    glSamplerParameterfv(sampler, GL_TEXTURE_BORDER_COLOR, desc->border_color);
+    if (desc->max_anisotropy > 1.0f &&
+        (gloadIsVersionSupported(4, 6) || gloadIsExtensionSupported("GL_EXT_texture_filter_anisotropic") || gloadIsExtensionSupported("GL_ARB_texture_filter_anisotropic"))) {
+        glSamplerParameterf(sampler, GL_TEXTURE_MAX_ANISOTROPY, desc->max_anisotropy);
+    }
+
+    if (g_objects.samplers[slot].entry.object) {
+        glDeleteSamplers(1, &g_objects.samplers[slot].entry.object);
+        g_objects.stats.evictions++;
+    }
+    g_objects.samplers[slot].entry.hash = hash;
+    g_objects.samplers[slot].entry.used = ++g_objects.tick;
+    g_objects.samplers[slot].entry.frame = g_objects.frame;
+    g_objects.samplers[slot].entry.object = sampler;
+    g_objects.samplers[slot].desc = *desc;
+    g_objects.stats.sampler_misses++;
+    return (sampler);
+}
+
+/* `gloadFramebufferCacheGet`:
+ *
+ * Find the framebuffer object of a set of attachments, creating it on the first use.
+ * The framebuffer is owned by the cache; don't delete it.
+ *
+ * - param: `const t_gloadFramebufferDesc *desc` - framebuffer attachments
+ * - return: name of the framebuffer on success, 0 on failure or if the attachments aren't framebuffer-complete.
+ * */
+GLAPI GLuint    gloadFramebufferCacheGet(const t_gloadFramebufferDesc *desc) {
+    GLenum      buffers[GLOAD_OBJECT_CACHE_MAX_COLOR_ATTACHMENTS];
+    GLuint64    hash;
+    GLuint      slot;
+    GLuint      framebuffer;
+    GLint       previous;
+    GLenum      status;
+    int         found;
+
+    if (!g_objects.init || !desc) { return (0); }
+
+    hash = gloadInternal_hash(0xcbf29ce484222325ull, desc, sizeof(t_gloadFramebufferDesc));
+    slot = gloadObjectCache_slot(g_objects.framebuffers, sizeof(struct s_gloadFramebufferEntry), offsetof(struct s_gloadFramebufferEntry, desc),
+                                 GLOAD_OBJECT_CACHE_FRAMEBUFFERS, hash, desc, sizeof(t_gloadFramebufferDesc), &found);
+    if (found) {
+        g_objects.framebuffers[slot].entry.used = ++g_objects.tick;
+        g_objects.framebuffers[slot].entry.frame = g_objects.frame;
+        g_objects.stats.framebuffer_hits++;
+        return (g_objects.framebuffers[slot].entry.object);
+    }
+    if (slot == GLOAD_OBJECT_CACHE_FRAMEBUFFERS) {
+
+#   if defined (GLOAD_VERBOSE_ERROR)
+        fprintf(stderr, "gload.h: every framebuffer of the cache is used in this frame.\n");
+#   endif /* GLOAD_VERBOSE_ERROR */
+
+        return (0);
+    }
+
+    for (GLuint i = 0; i < GLOAD_OBJECT_CACHE_MAX_COLOR_ATTACHMENTS; i++) {
+        buffers[i] = desc->colors[i] ? GL_COLOR_ATTACHMENT0 + i : GL_NONE;
+    }
+
+    framebuffer = 0;
+    if (g_objects.dsa) {
+        glCreateFramebuffers(1, &framebuffer);
+        if (!framebuffer) { return (0); }
+        for (GLuint i = 0; i < GLOAD_OBJECT_CACHE_MAX_COLOR_ATTACHMENTS; i++) {
+            if (!desc->colors[i]) { continue; }
+            if (desc->color_layers[i] < 0) { glNamedFramebufferTexture(framebuffer, GL_COLOR_ATTACHMENT0 + i, desc->colors[i], desc->color_levels[i]); }
+            else { glNamedFramebufferTextureLayer(framebuffer, GL_COLOR_ATTACHMENT0 + i, desc->colors[i], desc->color_levels[i], desc->color_layers[i]); }
+        }
+        if (desc->depth) {
+            if (desc->depth_layer < 0) { glNamedFramebufferTexture(framebuffer, desc->depth_attachment, desc->depth, desc->depth_level); }
+            else { glNamedFramebufferTextureLayer(framebuffer, desc->depth_attachment, desc->depth, desc->depth_level, desc->depth_layer); }
+        }
+        glNamedFramebufferDrawBuffers(framebuffer, GLOAD_OBJECT_CACHE_MAX_COLOR_ATTACHMENTS, buffers);
+        status = glCheckNamedFramebufferStatus(framebuffer, GL_DRAW_FRAMEBUFFER);
+    }
+    else {
+        previous = 0;
+        glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &previous);
+        glGenFramebuffers(1, &framebuffer);
+        if (!framebuffer) { return (0); }
+        glBindFramebuffer(GL_DRAW_FRAMEBUFFER, framebuffer);
+        for (GLuint i = 0; i < GLOAD_OBJECT_CACHE_MAX_COLOR_ATTACHMENTS; i++) {
+            if (!desc->colors[i]) { continue; }
+            if (desc->color_layers[i] < 0) { glFramebufferTexture(GL_DRAW_FRAMEBUFFER, GL_COLOR_ATTACHMENT0 + i, desc->colors[i], desc->color_levels[i]); }
+            else { glFramebufferTextureLayer(GL_DRAW_FRAMEBUFFER, GL_COLOR_ATTACHMENT0 + i, desc->colors[i], desc->color_levels[i], desc->color_layers[i]); }
+        }
+        if (desc->depth) {
+            if (desc->depth_layer < 0) { glFramebufferTexture(GL_DRAW_FRAMEBUFFER, desc->depth_attachment, desc->depth, desc->depth_level); }
+            else { glFramebufferTextureLayer(GL_DRAW_FRAMEBUFFER, desc->depth_attachment, desc->depth, desc->depth_level, desc->depth_layer); }
+        }
+        glDrawBuffers(GLOAD_OBJECT_CACHE_MAX_COLOR_ATTACHMENTS, buffers);
+        status = glCheckFramebufferStatus(GL_DRAW_FRAMEBUFFER);
+        glBindFramebuffer(GL_DRAW_FRAMEBUFFER, (GLuint) previous);
+    }
+
+    /* Incomplete framebuffers aren't cached, so they don't push out the valid ones... */
+    if (status != GL_FRAMEBUFFER_COMPLETE) {
+
+#   if defined (GLOAD_VERBOSE_ERROR)
+        fprintf(stderr, "gload.h: framebuffer is incomplete (0x%04x).\n", status);
+#   endif /* GLOAD_VERBOSE_ERROR */
+
+        glDeleteFramebuffers(1, &framebuffer);
+        return (0);
+    }
+
+    if (g_objects.framebuffers[slot].entry.object) {
+        glDeleteFramebuffers(1, &g_objects.framebuffers[slot].entry.object);
+        g_objects.stats.evictions++;
+    }
+    g_objects.framebuffers[slot].entry.hash = hash;
+    g_objects.framebuffers[slot].entry.used = ++g_objects.tick;
+    g_objects.framebuffers[slot].entry.frame = g_objects.frame;
+    g_objects.framebuffers[slot].entry.object = framebuffer;
+    g_objects.framebuffers[slot].desc = *desc;
+    g_objects.stats.framebuffer_misses++;
+    return (framebuffer);
+}
+
+#  endif /* GLOAD_OBJECT_CACHE */
+#
+#  if defined (GLOAD_BINDLESS)
+
+/* SECTION:
+ *  gload bindless texture API
+ * * * * * * * * * * * * * * */
+
+/* `gloadBindless_store`:
+ *
+ * Write the handle of a slot, to be uploaded by the next `gloadBindlessBind`.
+ * */
+static void gloadBindless_store(t_gloadBindless *bindless, GLuint slot, GLuint64 handle) {
+    bindless->handles[slot] = handle;
+    if (slot < bindless->dirty_begin) { bindless->dirty_begin = slot; }
+    if (slot + 1 > bindless->dirty_end) { bindless->dirty_end = slot + 1; }
+}
+
+/* `gloadBindless_evict`:
+ *
+ * Make the least recently used resident handle non-resident, ignoring handles of the current frame.
+ *
+ * - return: `true` if a handle was made non-resident, `false` otherwise.
+ * */
+static int  gloadBindless_evict(t_gloadBindless *bindless) {
+    t_gloadBindlessTexture  *victim;
+
+    victim = 0;
+    for (GLuint i = 0; i < bindless->count; i++) {
+        t_gloadBindlessTexture  *entry;
+
+        entry = &bindless->textures[i];
+        if (!entry->resident || entry->frame == bindless->frame) { continue; }
+        if (!victim || entry->frame < victim->frame) { victim = entry; }
+    }
+    if (!victim) { return (0); }
+
+    glMakeTextureHandleNonResidentARB(victim->handle);
+    victim->resident = 0;
+    bindless->resident--;
+    bindless->evictions++;
+    return (1);
+}
+
+/* `gloadBindlessCreate`:
+ *
+ * Create a table of `capacity` handles, with at most `budget` of them resident at once.
+ * NOTE:
+ *  This function requires a current context, loaded OpenGL functions, GL_ARB_bindless_texture
+ *  and shader storage buffers (OpenGL 4.3 or GL_ARB_shader_storage_buffer_object).
+ *
+ * - param: `t_gloadBindless *bindless` - table to initialize
+ * - param: `GLuint capacity` - number of slots
+ * - param: `GLuint budget` - maximum number of resident handles, 0 for `capacity`
+ * - return: `true` on success, `false` on failure.
+ * */
+GLAPI int   gloadBindlessCreate(t_gloadBindless *bindless, GLuint capacity, GLuint budget) {
+    if (!bindless || !capacity) { return (0); }
+    memset(bindless, 0, sizeof(t_gloadBindless));
+
+    if (!glGetTextureHandleARB || !glGetTextureSamplerHandleARB || !glMakeTextureHandleResidentARB ||
+        !glMakeTextureHandleNonResidentARB || !gloadIsExtensionSupported("GL_ARB_bindless_texture") ||
+        !(gloadIsVersionSupported(4, 3) || gloadIsExtensionSupported("GL_ARB_shader_storage_buffer_object"))) {
+
+#   if defined (GLOAD_VERBOSE_ERROR)
+        fprintf(stderr, "gload.h: bindless textures require GL_ARB_bindless_texture and shader storage buffers.\n");
+#   endif /* GLOAD_VERBOSE_ERROR */
+
+        return (0);
+    }
+
+    bindless->textures = (t_gloadBindlessTexture *) calloc(capacity, sizeof(t_gloadBindlessTexture));
+    bindless->handles = (GLuint64 *) calloc(capacity, sizeof(GLuint64));
+    if (!bindless->textures || !bindless->handles) {
+        gloadBindlessDestroy(bindless);
+        return (0);
+    }
+    bindless->capacity = capacity;
+    bindless->budget = budget && budget < capacity ? budget : capacity;
+    bindless->dirty_begin = capacity;
+    bindless->dsa = glCreateBuffers && glNamedBufferData && glNamedBufferSubData &&
+                    (gloadIsVersionSupported(4, 5) || gloadIsExtensionSupported("GL_ARB_direct_state_access"));
+
+    if (bindless->dsa) {
+        glCreateBuffers(1, &bindless->buffer);
+        glNamedBufferData(bindless->buffer, (GLsizeiptr) (capacity * sizeof(GLuint64)), 0, GL_DYNAMIC_DRAW);
+    }
+    else {
+        glGenBuffers(1, &bindless->buffer);
+        glBindBuffer(GL_SHADER_STORAGE_BUFFER, bindless->buffer);
+        glBufferData(GL_SHADER_STORAGE_BUFFER, (GLsizeiptr) (capacity * sizeof(GLuint64)), 0, GL_DYNAMIC_DRAW);
+        glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+    }
+    if (!bindless->buffer) {
+        gloadBindlessDestroy(bindless);
+        return (0);
+    }
+    return (1);
+}
+
+/* `gloadBindlessDestroy`:
+ *
+ * Make every handle non-resident and release the table. The textures themselves are left untouched.
+ *
+ * - param: `t_gloadBindless *bindless` - table to destroy
+ * */
+GLAPI void  gloadBindlessDestroy(t_gloadBindless *bindless) {
+    if (!bindless) { return; }
+
+    for (GLuint i = 0; i < bindless->count; i++) {
+        if (bindless->textures[i].resident) { glMakeTextureHandleNonResidentARB(bindless->textures[i].handle); }
+    }
+    if (bindless->buffer) { glDeleteBuffers(1, &bindless->buffer); }
+    free(bindless->textures);
+    free(bindless->handles);
+    memset(bindless, 0, sizeof(t_gloadBindless));
+}
+
+/* `gloadBindlessAdd`:
+ *
+ * Get the handle of a texture (with a sampler, if not 0) and store it in a free slot.
+ * The handle isn't resident until the slot is used.
+ *
+ * - param: `t_gloadBindless *bindless` - table
+ * - param: `GLuint texture` - texture
+ * - param: `GLuint sampler` - sampler, or 0 for the sampling state of the texture
+ * - return: slot of the texture on success, -1 on failure.
+ * */
+GLAPI GLint gloadBindlessAdd(t_gloadBindless *bindless, GLuint texture, GLuint sampler) {
+    t_gloadBindlessTexture  *entry;
+    GLuint64                handle;
+    GLuint                  slot;
+
+    if (!bindless || !bindless->textures || !texture) { return (-1); }
+
+    /* Slots are packed at the front, so only the scan for a hole is linear... */
+    slot = bindless->count;
+    if (slot == bindless->capacity) {
+        for (slot = 0; slot < bindless->count && bindless->textures[slot].texture; slot++) { }
+        if (slot == bindless->count) { return (-1); }
+    }
+
+    handle = sampler ? glGetTextureSamplerHandleARB(texture, sampler) : glGetTextureHandleARB(texture);
+    if (!handle) { return (-1); }
+
+    entry = &bindless->textures[slot];
+    entry->handle = handle;
+    entry->frame = 0;
+    entry->texture = texture;
+    entry->sampler = sampler;
+    entry->resident = 0;
+    if (slot == bindless->count) { bindless->count++; }
+    gloadBindless_store(bindless, slot, handle);
+    return ((GLint) slot);
+}
+
+/* `gloadBindlessRemove`:
+ *
+ * Make the handle of a slot non-resident and free the slot.
+ * NOTE:
+ *  Remove textures from the table before deleting them.
+ *
+ * - param: `t_gloadBindless *bindless` - table
+ * - param: `GLint slot` - slot to free
+ * */
+GLAPI void  gloadBindlessRemove(t_gloadBindless *bindless, GLint slot) {
+    t_gloadBindlessTexture  *entry;
+
+    if (!bindless || slot < 0 || (GLuint) slot >= bindless->count) { return; }
+
+    entry = &bindless->textures[slot];
+    if (entry->resident) {
+        glMakeTextureHandleNonResidentARB(entry->handle);
+        bindless->resident--;
+    }
+    memset(entry, 0, sizeof(t_gloadBindlessTexture));
+    gloadBindless_store(bindless, (GLuint) slot, 0);
+    while (bindless->count && !bindless->textures[bindless->count - 1].texture) { bindless->count--; }
+}
+
+/* `gloadBindlessUse`:
+ *
+ * Add a slot to the working set of the current frame, making its handle resident if needed.
+ * Above the budget, handles not used during the current frame are made non-resident, least recently used first.
+ *
+ * - param: `t_gloadBindless *bindless` - table
+ * - param: `GLint slot` - slot used by the next draws
+ * - return: `true` on success, `false` on failure.
+ * */
+GLAPI int   gloadBindlessUse(t_gloadBindless *bindless, GLint slot) {
+    t_gloadBindlessTexture  *entry;
+
+    if (!bindless || slot < 0 || (GLuint) slot >= bindless->count) { return (0); }
+
+    entry = &bindless->textures[slot];
+    if (!entry->texture) { return (0); }
+    entry->frame = bindless->frame;
+    if (entry->resident) { return (1); }
+
+    /* The working set of a frame may exceed the budget: it must be resident for the draws... */
+    while (bindless->resident >= bindless->budget && gloadBindless_evict(bindless)) { }
+
+#   if defined (GLOAD_VERBOSE_WARN)
+    if (bindless->resident >= bindless->budget) {
+        fprintf(stderr, "gload.h: working set of the frame exceeds the residency budget (%u).\n", bindless->budget);
+    }
+#   endif /* GLOAD_VERBOSE_WARN */
+
+    glMakeTextureHandleResidentARB(entry->handle);
+    entry->resident = 1;
+    bindless->resident++;
+    bindless->residencies++;
+    return (1);
+}
+
+/* `gloadBindlessTrim`:
+ *
+ * Make handles non-resident, least recently used first, until at most `resident` remain.
+ * Handles used during the current frame are kept; call this when the application detects memory pressure.
+ *
+ * - param: `t_gloadBindless *bindless` - table
+ * - param: `GLuint resident` - number of handles to keep resident
+ * - return: number of handles made non-resident.
+ * */
+GLAPI GLuint    gloadBindlessTrim(t_gloadBindless *bindless, GLuint resident) {
+    GLuint  count;
+
+    if (!bindless) { return (0); }
+
+    count = 0;
+    while (bindless->resident > resident && gloadBindless_evict(bindless)) { count++; }
+    return (count);
+}
+
+/* `gloadBindlessBeginFrame`:
+ *
+ * Start a new frame: the working set is empty again.
+ *
+ * - param: `t_gloadBindless *bindless` - table
+ * */
+GLAPI void  gloadBindlessBeginFrame(t_gloadBindless *bindless) {
+    if (!bindless) { return; }
+    bindless->frame++;
+}
+
+/* `gloadBindlessBind`:
+ *
+ * Upload the handles changed since the last call and bind the table to a shader storage buffer binding point.
+ *
+ * - param: `t_gloadBindless *bindless` - table
+ * - param: `GLuint binding` - index of the binding point
+ * */
+GLAPI void  gloadBindlessBind(t_gloadBindless *bindless, GLuint binding) {
+    GLintptr    offset;
+    GLsizeiptr  size;
+
+    if (!bindless || !bindless->buffer) { return; }
+
+    if (bindless->dirty_begin < bindless->dirty_end) {
+        offset = (GLintptr) (bindless->dirty_begin * sizeof(GLuint64));
+        size = (GLsizeiptr) ((bindless->dirty_end - bindless->dirty_begin) * sizeof(GLuint64));
+        if (bindless->dsa) {
+            glNamedBufferSubData(bindless->buffer, offset, size, &bindless->handles[bindless->dirty_begin]);
+        }
+        else {
+            glBindBuffer(GL_SHADER_STORAGE_BUFFER, bindless->buffer);
+            glBufferSubData(GL_SHADER_STORAGE_BUFFER, offset, size, &bindless->handles[bindless->dirty_begin]);
+        }
+        bindless->dirty_begin = bindless->capacity;
+        bindless->dirty_end = 0;
+        bindless->uploads++;
+    }
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, binding, bindless->buffer);
+}
+
+#  endif /* GLOAD_BINDLESS */
+#
+#  if defined (GLOAD_DELETION_QUEUE)
+
+/* SECTION:
+ *  gload deletion queue API
+ * * * * * * * * * * * * * */
+
+/* `struct s_gloadDeletion` - single queued object.
+ * `recycle` marks retired buffers, with their `size` and `flags`.
+ * */
+struct s_gloadDeletion {
+    GLuint64    frame;
+    GLsizeiptr  size;
+    GLenum      kind;
+    GLuint      name;
+    GLbitfield  flags;
+    int         recycle;
+};
+
+/* `static const GLenum g_deletion_kinds` - types of objects, in the order their batches are deleted.
+ * */
+static const GLenum g_deletion_kinds[] = {
+    GL_FRAMEBUFFER, GL_VERTEX_ARRAY, GL_QUERY, GL_SAMPLER, GL_RENDERBUFFER, GL_TEXTURE, GL_BUFFER
+};
+
+/* `gloadDeletionQueue_delete`:
+ *
+ * Delete `n` objects of a single type with one call.
+ * */
+static void gloadDeletionQueue_delete(GLenum kind, GLsizei n, const GLuint *names) {
+    switch (kind) {
+        case (GL_BUFFER):       { glDeleteBuffers(n, names); break; }
+        case (GL_TEXTURE):      { glDeleteTextures(n, names); break; }
+        case (GL_FRAMEBUFFER):  { glDeleteFramebuffers(n, names); break; }
+        case (GL_RENDERBUFFER): { glDeleteRenderbuffers(n, names); break; }
+        case (GL_VERTEX_ARRAY): { glDeleteVertexArrays(n, names); break; }
+        case (GL_SAMPLER):      { glDeleteSamplers(n, names); break; }
+        case (GL_QUERY):        { glDeleteQueries(n, names); break; }
+        default:                { break; }
+    }
+}
+
+/* `gloadDeletionQueue_push`:
+ *
+ * Append an object to the queue, growing it if needed.
+ *
+ * - return: `true` on success, `false` on failure.
+ * */
+static int  gloadDeletionQueue_push(t_gloadDeletionQueue *queue, const struct s_gloadDeletion *deletion) {
+    if (queue->count == queue->capacity) {
+        struct s_gloadDeletion  *pending;
+        GLuint                  *scratch;
+        GLuint                  capacity;
+
+        capacity = queue->capacity ? queue->capacity * 2 : 64;
+        pending = (struct s_gloadDeletion *) realloc(queue->pending, capacity * sizeof(struct s_gloadDeletion));
+        if (!pending) { return (0); }
+        queue->pending = pending;
+        scratch = (GLuint *) realloc(queue->scratch, capacity * sizeof(GLuint));
+        if (!scratch) { return (0); }
+        queue->scratch = scratch;
+        queue->capacity = capacity;
+    }
+    ((struct s_gloadDeletion *) queue->pending)[queue->count++] = *deletion;
+    return (1);
+}
+
+/* `gloadDeletionQueue_poll`:
+ *
+ * Advance `completed` over the frames whose fence has signalled, waiting for the frames up to `until`.
+ * */
+static void gloadDeletionQueue_poll(t_gloadDeletionQueue *queue, GLuint64 until) {
+    GLsync  *fence;
+    GLenum  status;
+    int     wait;
+
+    while (queue->completed + 1 < queue->frame) {
+        fence = &queue->fences[(queue->completed + 1) % GLOAD_DELETION_QUEUE_FRAMES];
+        if (*fence) {
+            wait = queue->completed + 1 <= until;
+            status = glClientWaitSync(*fence, wait ? GL_SYNC_FLUSH_COMMANDS_BIT : 0, wait ? 0xFFFFFFFFFFFFFFFFull : 0);
+            if (status == GL_TIMEOUT_EXPIRED) { break; }
+            glDeleteSync(*fence);
+            *fence = 0;
+        }
+        queue->completed++;
+    }
+}
+
+/* `gloadDeletionQueue_release`:
+ *
+ * Move the retired buffers of completed frames to the pool and delete the other objects, one batch per type.
+ * With `recycle` false, retired buffers are deleted too.
+ * */
+static void gloadDeletionQueue_release(t_gloadDeletionQueue *queue, int recycle) {
+    struct s_gloadDeletion  *pending;
+    struct s_gloadDeletion  *pool;
+    GLsizei                 n;
+    GLuint                  kept;
+
+    pending = (struct s_gloadDeletion *) queue->pending;
+    pool = (struct s_gloadDeletion *) queue->pool;
+    for (GLuint i = 0; i < queue->count; i++) {
+        if (pending[i].frame > queue->completed || !pending[i].recycle) { continue; }
+        if (recycle && queue->pool_count < GLOAD_DELETION_QUEUE_POOL) {
+            pool[queue->pool_count++] = pending[i];
+            pending[i].name = 0;
+        }
+        pending[i].recycle = 0;
+    }
+
+    for (GLuint k = 0; k < sizeof(g_deletion_kinds) / sizeof(*g_deletion_kinds); k++) {
+        n = 0;
+        for (GLuint i = 0; i < queue->count; i++) {
+            if (pending[i].frame <= queue->completed && pending[i].kind == g_deletion_kinds[k] && pending[i].name) {
+                queue->scratch[n++] = pending[i].name;
+            }
+        }
+        if (!n) { continue; }
+        gloadDeletionQueue_delete(g_deletion_kinds[k], n, queue->scratch);
+        queue->deleted += (GLuint64) n;
+        queue->batches++;
+    }
+
+    kept = 0;
+    for (GLuint i = 0; i < queue->count; i++) {
+        if (pending[i].frame > queue->completed) { pending[kept++] = pending[i]; }
+    }
+    queue->count = kept;
+}
+
+/* `gloadDeletionQueueCreate`:
+ *
+ * Create an empty deletion queue.
+ * NOTE:
+ *  This function requires a current context and loaded OpenGL functions (OpenGL 3.2 or GL_ARB_sync).
+ *
+ * - param: `t_gloadDeletionQueue *queue` - queue to initialize
+ * - return: `true` on success, `false` on failure.
+ * */
+GLAPI int   gloadDeletionQueueCreate(t_gloadDeletionQueue *queue) {
+    if (!queue) { return (0); }
+    memset(queue, 0, sizeof(t_gloadDeletionQueue));
+
+    if (!glFenceSync || !glClientWaitSync || !glDeleteSync || !(gloadIsVersionSupported(3, 2) || gloadIsExtensionSupported("GL_ARB_sync"))) {
+
+#   if defined (GLOAD_VERBOSE_ERROR)
+        fprintf(stderr, "gload.h: deletion queue requires OpenGL 3.2 or GL_ARB_sync.\n");
+#   endif /* GLOAD_VERBOSE_ERROR */
+
+        return (0);
+    }
+
+    queue->pool = calloc(GLOAD_DELETION_QUEUE_POOL, sizeof(struct s_gloadDeletion));
+    if (!queue->pool) { return (0); }
+    queue->frame = 1;
+    queue->storage = glBufferStorage != 0 && (gloadIsVersionSupported(4, 4) || gloadIsExtensionSupported("GL_ARB_buffer_storage"));
+    queue->dsa = queue->storage && glCreateBuffers && glNamedBufferStorage &&
+                 (gloadIsVersionSupported(4, 5) || gloadIsExtensionSupported("GL_ARB_direct_state_access"));
+    return (1);
+}
+
+/* `gloadDeletionQueueDestroy`:
+ *
+ * Wait for the GPU, then delete every queued and pooled object and release the queue.
+ *
+ * - param: `t_gloadDeletionQueue *queue` - queue to destroy
+ * */
+GLAPI void  gloadDeletionQueueDestroy(t_gloadDeletionQueue *queue) {
+    struct s_gloadDeletion  *pool;
+
+    if (!queue) { return; }
+
+    /* The objects of the current frame have no fence yet... */
+    if (queue->count) { glFinish(); }
+    for (GLuint i = 0; i < GLOAD_DELETION_QUEUE_FRAMES; i++) {
+        if (queue->fences[i]) { glDeleteSync(queue->fences[i]); }
+    }
+    queue->completed = queue->frame;
+    gloadDeletionQueue_release(queue, 0);
+
+    pool = (struct s_gloadDeletion *) queue->pool;
+    for (GLuint i = 0; i < queue->pool_count; i++) { glDeleteBuffers(1, &pool[i].name); }
+    free(queue->pending);
+    free(queue->scratch);
+    free(queue->pool);
+    memset(queue, 0, sizeof(t_gloadDeletionQueue));
+}
+
+/* `gloadDeletionQueueDelete`:
+ *
+ * Queue objects for deletion at the end of the current frame.
+ *
+ * - param: `t_gloadDeletionQueue *queue` - queue
+ * - param: `GLenum kind` - type of the objects: `GL_BUFFER`, `GL_TEXTURE`, `GL_FRAMEBUFFER`, `GL_RENDERBUFFER`,
+ *          `GL_VERTEX_ARRAY`, `GL_SAMPLER` or `GL_QUERY`
+ * - param: `GLsizei n` - number of objects
+ * - param: `const GLuint *names` - names of the objects
+ * - return: `true` on success, `false` on failure.
+ * */
+GLAPI int   gloadDeletionQueueDelete(t_gloadDeletionQueue *queue, GLenum kind, GLsizei n, const GLuint *names) {
+    struct s_gloadDeletion  deletion;
+    GLuint                  k;
+
+    if (!queue || !queue->pool || n < 0 || (n && !names)) { return (0); }
+
+    /* Names of any other kind would never be released... */
+    for (k = 0; k < sizeof(g_deletion_kinds) / sizeof(*g_deletion_kinds) && g_deletion_kinds[k] != kind; k++) { }
+    if (k == sizeof(g_deletion_kinds) / sizeof(*g_deletion_kinds)) {
+
+#   if defined (GLOAD_VERBOSE_ERROR)
+        fprintf(stderr, "gload.h: unknown deletion kind (0x%04x).\n", kind);
+#   endif /* GLOAD_VERBOSE_ERROR */
+
+        return (0);
+    }
+
+    memset(&deletion, 0, sizeof(struct s_gloadDeletion));
+    deletion.frame = queue->frame;
+    deletion.kind = kind;
+    for (GLsizei i = 0; i < n; i++) {
+        if (!names[i]) { continue; }
+        deletion.name = names[i];
+        if (!gloadDeletionQueue_push(queue, &deletion)) { return (0); }
+    }
+    return (1);
+}
+
+/* `gloadDeletionQueueRetireBuffer`:
+ *
+ * Queue a buffer created by `gloadDeletionQueueAcquireBuffer` to be recycled at the end of the current frame.
+ *
+ * - param: `t_gloadDeletionQueue *queue` - queue
+ * - param: `GLuint buffer` - buffer to retire
+ * - param: `GLsizeiptr size` - size of the buffer
+ * - param: `GLbitfield flags` - storage flags of the buffer
+ * - return: `true` on success, `false` on failure.
+ * */
+GLAPI int   gloadDeletionQueueRetireBuffer(t_gloadDeletionQueue *queue, GLuint buffer, GLsizeiptr size, GLbitfield flags) {
+    struct s_gloadDeletion  deletion;
+
+    if (!queue || !queue->pool || !buffer) { return (0); }
+
+    memset(&deletion, 0, sizeof(struct s_gloadDeletion));
+    deletion.frame = queue->frame;
+    deletion.size = size;
+    deletion.kind = GL_BUFFER;
+    deletion.name = buffer;
+    deletion.flags = flags;
+    deletion.recycle = 1;
+    return (gloadDeletionQueue_push(queue, &deletion));
+}
+
+/* `gloadDeletionQueueAcquireBuffer`:
+ *
+ * Take a recycled buffer of the same size and flags, or create a new one.
+ * Without OpenGL 4.4 or GL_ARB_buffer_storage, buffers are mutable and `flags` only selects the usage hint.
+ *
+ * - param: `t_gloadDeletionQueue *queue` - queue
+ * - param: `GLsizeiptr size` - size of the buffer
+ * - param: `GLbitfield flags` - storage flags (`glBufferStorage`)
+ * - return: name of the buffer on success, 0 on failure.
+ * */
+GLAPI GLuint    gloadDeletionQueueAcquireBuffer(t_gloadDeletionQueue *queue, GLsizeiptr size, GLbitfield flags) {
+    struct s_gloadDeletion  *pool;
+    GLuint                  buffer;
+
+    if (!queue || !queue->pool || size <= 0) { return (0); }
+
+    pool = (struct s_gloadDeletion *) queue->pool;
+    for (GLuint i = 0; i < queue->pool_count; i++) {
+        if (pool[i].size != size || pool[i].flags != flags) { continue; }
+        buffer = pool[i].name;
+        pool[i] = pool[--queue->pool_count];
+        queue->recycled++;
+        return (buffer);
+    }
+
+    buffer = 0;
+    if (queue->dsa) {
+        glCreateBuffers(1, &buffer);
+        if (!buffer) { return (0); }
+        glNamedBufferStorage(buffer, size, 0, flags);
+    }
+    else {
+        glGenBuffers(1, &buffer);
+        if (!buffer) { return (0); }
+        glBindBuffer(GL_COPY_WRITE_BUFFER, buffer);
+        if (queue->storage) { glBufferStorage(GL_COPY_WRITE_BUFFER, size, 0, flags); }
+        else { glBufferData(GL_COPY_WRITE_BUFFER, size, 0, flags & (GL_DYNAMIC_STORAGE_BIT | GL_MAP_WRITE_BIT) ? GL_DYNAMIC_DRAW : GL_STATIC_DRAW); }
+        glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+    }
+    queue->allocated++;
+    return (buffer);
+}
+
+/* `gloadDeletionQueueEndFrame`:
+ *
+ * Insert the fence of the current frame and release the objects of completed frames.
+ * Waits for the oldest frame if more than GLOAD_DELETION_QUEUE_FRAMES are in flight.
+ *
+ * - param: `t_gloadDeletionQueue *queue` - queue
+ * */
+GLAPI void  gloadDeletionQueueEndFrame(t_gloadDeletionQueue *queue) {
+    if (!queue || !queue->pool) { return; }
+
+    gloadDeletionQueue_poll(queue, 0);
+    if (queue->completed + GLOAD_DELETION_QUEUE_FRAMES < queue->frame) {
+        queue->stalls++;
+        gloadDeletionQueue_poll(queue, queue->frame - GLOAD_DELETION_QUEUE_FRAMES);
+    }
+    queue->fences[queue->frame % GLOAD_DELETION_QUEUE_FRAMES] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    queue->frame++;
+    gloadDeletionQueue_release(queue, 1);
+}
+
+/* `gloadDeletionQueueProcess`:
+ *
+ * Release the objects of completed frames, without waiting.
+ *
+ * - param: `t_gloadDeletionQueue *queue` - queue
+ * - return: number of objects still queued.
+ * */
+GLAPI GLuint    gloadDeletionQueueProcess(t_gloadDeletionQueue *queue) {
+    if (!queue || !queue->pool) { return (0); }
+
+    gloadDeletionQueue_poll(queue, 0);
+    gloadDeletionQueue_release(queue, 1);
+    return (queue->count);
+}
+
+#  endif /* GLOAD_DELETION_QUEUE */
+#
+#  if defined (GLOAD_BUFFER_ALLOCATOR)
+
+/* SECTION:
+ *  gload buffer allocator API
+ * * * * * * * * * * * * * * */
+
+#   define GLOAD_BUFFER_ALLOCATOR_NONE 0xFFFFFFFFu
+#   define GLOAD_BUFFER_ALLOCATOR_MANTISSA 3
+
+/* `struct s_gloadBufferNode` - block of the buffer, used or free.
+ * `prev`/`next` link the blocks in address order, `bin_prev`/`bin_next` the free blocks of a size class.
+ * */
+struct s_gloadBufferNode {
+    GLuint  offset;
+    GLuint  size;
+    GLuint  prev;
+    GLuint  next;
+    GLuint  bin_prev;
+    GLuint  bin_next;
+    int     used;
+};
+
+/* `gloadBufferAllocator_lsb`:
+ *
+ * - return: index of the lowest set bit of `mask`, GLOAD_BUFFER_ALLOCATOR_NONE if `mask` is 0.
+ * */
+static GLuint   gloadBufferAllocator_lsb(GLuint mask) {
+    if (!mask) { return (GLOAD_BUFFER_ALLOCATOR_NONE); }
+
+#   if defined (__GNUC__) || defined (__clang__)
+    return ((GLuint) __builtin_ctz(mask));
+#   else
+    GLuint  index;
+
+    for (index = 0; !(mask & 1u); index++) { mask >>= 1; }
+    return (index);
+#   endif /* __GNUC__ */
+}
+
+/* `gloadBufferAllocator_msb`:
+ *
+ * - return: index of the highest set bit of `value`, which must not be 0.
+ * */
+static GLuint   gloadBufferAllocator_msb(GLuint value) {
+
+#   if defined (__GNUC__) || defined (__clang__)
+    return (31u - (GLuint) __builtin_clz(value));
+#   else
+    GLuint  index;
+
+    for (index = 0; value >>= 1; index++) { }
+    return (index);
+#   endif /* __GNUC__ */
+}
+
+/* `gloadBufferAllocator_bin`:
+ *
+ * Map a size to its size class, as a small float: 5-bit exponent and 3-bit mantissa.
+ * Rounding up gives the first class whose blocks are all large enough, rounding down the class a block belongs to.
+ * */
+static GLuint   gloadBufferAllocator_bin(GLuint size, int round_up) {
+    GLuint  shift;
+    GLuint  bin;
+
+    if (size < (1u << GLOAD_BUFFER_ALLOCATOR_MANTISSA)) { return (size); }
+    shift = gloadBufferAllocator_msb(size) - GLOAD_BUFFER_ALLOCATOR_MANTISSA;
+    bin = ((shift + 1) << GLOAD_BUFFER_ALLOCATOR_MANTISSA) + ((size >> shift) & ((1u << GLOAD_BUFFER_ALLOCATOR_MANTISSA) - 1));
+    if (round_up && (size & ((1u << shift) - 1))) { bin++; }
+    return (bin);
+}
+
+/* `gloadBufferAllocator_insert`:
+ *
+ * Add a free block to the list of its size class.
+ * */
+static void gloadBufferAllocator_insert(t_gloadBufferAllocator *allocator, GLuint index) {
+    struct s_gloadBufferNode    *nodes;
+    GLuint                      bin;
+
+    nodes = (struct s_gloadBufferNode *) allocator->nodes;
+    bin = gloadBufferAllocator_bin(nodes[index].size, 0);
+    nodes[index].used = 0;
+    nodes[index].bin_prev = GLOAD_BUFFER_ALLOCATOR_NONE;
+    nodes[index].bin_next = allocator->bins[bin];
+    if (allocator->bins[bin] != GLOAD_BUFFER_ALLOCATOR_NONE) { nodes[allocator->bins[bin]].bin_prev = index; }
+    allocator->bins[bin] = index;
+    allocator->bin_masks[bin >> GLOAD_BUFFER_ALLOCATOR_MANTISSA] |= (GLubyte) (1u << (bin & 7u));
+    allocator->bin_mask |= 1u << (bin >> GLOAD_BUFFER_ALLOCATOR_MANTISSA);
+}
+
+/* `gloadBufferAllocator_remove`:
+ *
+ * Remove a free block from the list of its size class.
+ * */
+static void gloadBufferAllocator_remove(t_gloadBufferAllocator *allocator, GLuint index) {
+    struct s_gloadBufferNode    *nodes;
+    struct s_gloadBufferNode    *node;
+    GLuint                      bin;
+
+    nodes = (struct s_gloadBufferNode *) allocator->nodes;
+    node = &nodes[index];
+    if (node->bin_prev != GLOAD_BUFFER_ALLOCATOR_NONE) { nodes[node->bin_prev].bin_next = node->bin_next; }
+    else {
+        bin = gloadBufferAllocator_bin(node->size, 0);
+        allocator->bins[bin] = node->bin_next;
+        if (node->bin_next == GLOAD_BUFFER_ALLOCATOR_NONE) {
+            allocator->bin_masks[bin >> GLOAD_BUFFER_ALLOCATOR_MANTISSA] &= (GLubyte) ~(1u << (bin & 7u));
+            if (!allocator->bin_masks[bin >> GLOAD_BUFFER_ALLOCATOR_MANTISSA]) {
+                allocator->bin_mask &= ~(1u << (bin >> GLOAD_BUFFER_ALLOCATOR_MANTISSA));
+            }
+        }
+    }
+    if (node->bin_next != GLOAD_BUFFER_ALLOCATOR_NONE) { nodes[node->bin_next].bin_prev = node->bin_prev; }
+}
+
+/* `gloadBufferAllocator_reset`:
+ *
+ * Empty the size classes and the node stack; every node is free to use again.
+ * */
+static void gloadBufferAllocator_reset(t_gloadBufferAllocator *allocator) {
+    for (GLuint i = 0; i < 256; i++) { allocator->bins[i] = GLOAD_BUFFER_ALLOCATOR_NONE; }
+    memset(allocator->bin_masks, 0, sizeof(allocator->bin_masks));
+    allocator->bin_mask = 0;
+    for (GLuint i = 0; i < allocator->capacity; i++) { allocator->free_nodes[i] = allocator->capacity - 1 - i; }
+    allocator->free_count = allocator->capacity;
+}
+
+/* `gloadBufferAllocator_storage`:
+ *
+ * Create a buffer with the size and flags of the allocator.
+ *
+ * - return: name of the buffer, 0 on failure.
+ * */
+static GLuint   gloadBufferAllocator_storage(t_gloadBufferAllocator *allocator) {
+    GLuint  buffer;
+
+    buffer = 0;
+    if (allocator->dsa) {
+        glCreateBuffers(1, &buffer);
+        if (buffer) { glNamedBufferStorage(buffer, allocator->size, 0, allocator->flags); }
+    }
+    else {
+        glGenBuffers(1, &buffer);
+        if (!buffer) { return (0); }
+        glBindBuffer(GL_COPY_WRITE_BUFFER, buffer);
+        if (glBufferStorage && (gloadIsVersionSupported(4, 4) || gloadIsExtensionSupported("GL_ARB_buffer_storage"))) {
+            glBufferStorage(GL_COPY_WRITE_BUFFER, allocator->size, 0, allocator->flags);
+        }
+        else { glBufferData(GL_COPY_WRITE_BUFFER, allocator->size, 0, GL_STATIC_DRAW); }
+        glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+    }
+    return (buffer);
+}
+
+/* `gloadBufferAllocatorCreate`:
+ *
+ * Create an allocator over a new buffer of `size` bytes.
+ * Allocations are aligned to `GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT` for `GL_UNIFORM_BUFFER`,
+ * `GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT` for `GL_SHADER_STORAGE_BUFFER`, and 16 bytes otherwise.
+ * NOTE:
+ *  This function requires a current context and loaded OpenGL functions.
+ *  Without OpenGL 4.4 or GL_ARB_buffer_storage, the buffer is mutable and `flags` is ignored.
+ *
+ * - param: `t_gloadBufferAllocator *allocator` - allocator to initialize
+ * - param: `GLenum target` - main binding target of the buffer
+ * - param: `GLsizeiptr size` - size of the buffer in bytes
+ * - param: `GLbitfield flags` - storage flags of the buffer (`glBufferStorage`)
+ * - param: `GLuint max_allocations` - maximum number of live allocations
+ * - return: `true` on success, `false` on failure.
+ * */
+GLAPI int   gloadBufferAllocatorCreate(t_gloadBufferAllocator *allocator, GLenum target, GLsizeiptr size, GLbitfield flags, GLuint max_allocations) {
+    struct s_gloadBufferNode    *nodes;
+    GLint                       alignment;
+    GLuint                      first;
+
+    if (!allocator || size <= 0 || !max_allocations) { return (0); }
+    memset(allocator, 0, sizeof(t_gloadBufferAllocator));
+    if (!glGenBuffers || !glCopyBufferSubData) { return (0); }
+
+    alignment = 16;
+    if (target == GL_UNIFORM_BUFFER) { glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &alignment); }
+    else if (target == GL_SHADER_STORAGE_BUFFER) { glGetIntegerv(GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT, &alignment); }
+    if (alignment < 16) { alignment = 16; }
+    if ((GLuint64) size / (GLuint) alignment > 0xFFFFFFFEull) { return (0); }
+
+    allocator->target = target;
+    allocator->flags = flags;
+    allocator->alignment = (GLuint) alignment;
+    allocator->units = (GLuint) ((GLuint64) size / (GLuint) alignment);
+    allocator->size = (GLsizeiptr) ((GLuint64) allocator->units * (GLuint) alignment);
+    allocator->dsa = glCreateBuffers && glNamedBufferStorage && glCopyNamedBufferSubData &&
+                     (gloadIsVersionSupported(4, 5) || gloadIsExtensionSupported("GL_ARB_direct_state_access"));
+
+    /* A free block sits between two used ones at most, so there are never more than twice the allocations... */
+    if (max_allocations > 0x7FFFFFFE) { return (0); }
+    allocator->max_allocations = max_allocations;
+    allocator->capacity = max_allocations * 2 + 1;
+    allocator->nodes = calloc(allocator->capacity, sizeof(struct s_gloadBufferNode));
+    allocator->generations = (GLuint *) calloc(allocator->capacity, sizeof(GLuint));
+    allocator->free_nodes = (GLuint *) calloc(allocator->capacity, sizeof(GLuint));
+    if (!allocator->units || !allocator->nodes || !allocator->generations || !allocator->free_nodes) {
+        gloadBufferAllocatorDestroy(allocator);
+        return (0);
+    }
+    allocator->buffer = gloadBufferAllocator_storage(allocator);
+    if (!allocator->buffer) {
+        gloadBufferAllocatorDestroy(allocator);
+        return (0);
+    }
+
+    gloadBufferAllocator_reset(allocator);
+    nodes = (struct s_gloadBufferNode *) allocator->nodes;
+    first = allocator->free_nodes[--allocator->free_count];
+    nodes[first].offset = 0;
+    nodes[first].size = allocator->units;
+    nodes[first].prev = nodes[first].next = GLOAD_BUFFER_ALLOCATOR_NONE;
+    gloadBufferAllocator_insert(allocator, first);
+    return (1);
+}
+
+/* `gloadBufferAllocatorDestroy`:
+ *
+ * Delete the buffer and release the allocator.
+ *
+ * - param: `t_gloadBufferAllocator *allocator` - allocator to destroy
+ * */
+GLAPI void  gloadBufferAllocatorDestroy(t_gloadBufferAllocator *allocator) {
+    if (!allocator) { return; }
+
+    if (allocator->buffer) { glDeleteBuffers(1, &allocator->buffer); }
+    free(allocator->nodes);
+    free(allocator->generations);
+    free(allocator->free_nodes);
+    memset(allocator, 0, sizeof(t_gloadBufferAllocator));
+}
+
+/* `gloadBufferAllocatorAllocate`:
+ *
+ * Allocate a range of the buffer.
+ *
+ * - param: `t_gloadBufferAllocator *allocator` - allocator
+ * - param: `GLsizeiptr size` - size of the range in bytes
+ * - param: `t_gloadBufferAllocation *allocation` - allocated range
+ * - return: `true` on success, `false` if no free block is large enough or `max_allocations` are already live.
+ * */
+GLAPI int   gloadBufferAllocatorAllocate(t_gloadBufferAllocator *allocator, GLsizeiptr size, t_gloadBufferAllocation *allocation) {
+    struct s_gloadBufferNode    *nodes;
+    GLuint                      units;
+    GLuint                      bin;
+    GLuint                      top;
+    GLuint                      leaf;
+    GLuint                      index;
+    GLuint                      rest;
+
+    if (!allocator || !allocator->nodes || !allocation || size <= 0 || size > allocator->size) { return (0); }
+    memset(allocation, 0, sizeof(t_gloadBufferAllocation));
+
+    if (allocator->allocations == allocator->max_allocations) {
+
+#   if defined (GLOAD_VERBOSE_WARN)
+        fprintf(stderr, "gload.h: buffer allocator reached its maximum of %u allocations.\n", allocator->max_allocations);
+#   endif /* GLOAD_VERBOSE_WARN */
+
+        allocator->failures++;
+        return (0);
+    }
+    units = (GLuint) (((GLuint64) size + allocator->alignment - 1) / allocator->alignment);
+
+    /* First non-empty class from the rounded-up one, in its group of 8 first, then in the next groups... */
+    bin = gloadBufferAllocator_bin(units, 1);
+    top = bin >> GLOAD_BUFFER_ALLOCATOR_MANTISSA;
+    leaf = GLOAD_BUFFER_ALLOCATOR_NONE;
+    if (top < 32 && (allocator->bin_mask & (1u << top))) {
+        leaf = gloadBufferAllocator_lsb(allocator->bin_masks[top] & ~((1u << (bin & 7u)) - 1u));
+    }
+    if (leaf == GLOAD_BUFFER_ALLOCATOR_NONE) {
+        top = top + 1 < 32 ? gloadBufferAllocator_lsb(allocator->bin_mask & ~((1u << (top + 1)) - 1u)) : GLOAD_BUFFER_ALLOCATOR_NONE;
+        if (top == GLOAD_BUFFER_ALLOCATOR_NONE) {
+
+#   if defined (GLOAD_VERBOSE_WARN)
+            fprintf(stderr, "gload.h: buffer allocator out of memory (%lld bytes requested).\n", (long long) size);
+#   endif /* GLOAD_VERBOSE_WARN */
+
+            allocator->failures++;
+            return (0);
+        }
+        leaf = gloadBufferAllocator_lsb(allocator->bin_masks[top]);
+    }
+
+    nodes = (struct s_gloadBufferNode *) allocator->nodes;
+    index = allocator->bins[(top << GLOAD_BUFFER_ALLOCATOR_MANTISSA) | leaf];
+
+    /* The rest of the block stays free, right after the allocation; with `max_allocations` enforced
+     * there's always a node left for it, but the block is never handed out whole if there isn't... */
+    rest = nodes[index].size - units;
+    if (rest && !allocator->free_count) {
+        allocator->failures++;
+        return (0);
+    }
+    gloadBufferAllocator_remove(allocator, index);
+    if (rest) {
+        GLuint  split;
+
+        split = allocator->free_nodes[--allocator->free_count];
+        nodes[split].offset = nodes[index].offset + units;
+        nodes[split].size = rest;
+        nodes[split].prev = index;
+        nodes[split].next = nodes[index].next;
+        if (nodes[index].next != GLOAD_BUFFER_ALLOCATOR_NONE) { nodes[nodes[index].next].prev = split; }
+        nodes[index].next = split;
+        nodes[index].size = units;
+        gloadBufferAllocator_insert(allocator, split);
+    }
+    nodes[index].used = 1;
+    allocator->used_units += nodes[index].size;
+    allocator->allocations++;
+
+    allocation->offset = (GLintptr) ((GLuint64) nodes[index].offset * allocator->alignment);
+    allocation->size = size;
+    allocation->handle = ((GLuint64) allocator->generations[index] << 32) | index;
+    return (1);
+}
+
+/* `gloadBufferAllocatorFree`:
+ *
+ * Release a range, merging it with its free neighbours.
+ *
+ * - param: `t_gloadBufferAllocator *allocator` - allocator
+ * - param: `const t_gloadBufferAllocation *allocation` - range to release
+ * */
+GLAPI void  gloadBufferAllocatorFree(t_gloadBufferAllocator *allocator, const t_gloadBufferAllocation *allocation) {
+    struct s_gloadBufferNode    *nodes;
+    GLuint                      index;
+    GLuint                      other;
+
+    if (!allocator || !allocator->nodes || !allocation || (allocation->handle & 0xFFFFFFFFu) >= allocator->capacity) { return; }
+
+    nodes = (struct s_gloadBufferNode *) allocator->nodes;
+    index = (GLuint) (allocation->handle & 0xFFFFFFFFu);
+    if (!nodes[index].used || allocator->generations[index] != (GLuint) (allocation->handle >> 32)) { return; }
+    allocator->generations[index]++;
+    allocator->used_units -= nodes[index].size;
+    allocator->allocations--;
+
+    other = nodes[index].prev;
+    if (other != GLOAD_BUFFER_ALLOCATOR_NONE && !nodes[other].used) {
+        gloadBufferAllocator_remove(allocator, other);
+        nodes[index].offset = nodes[other].offset;
+        nodes[index].size += nodes[other].size;
+        nodes[index].prev = nodes[other].prev;
+        if (nodes[other].prev != GLOAD_BUFFER_ALLOCATOR_NONE) { nodes[nodes[other].prev].next = index; }
+        memset(&nodes[other], 0, sizeof(struct s_gloadBufferNode));
+        allocator->free_nodes[allocator->free_count++] = other;
+    }
+    other = nodes[index].next;
+    if (other != GLOAD_BUFFER_ALLOCATOR_NONE && !nodes[other].used) {
+        gloadBufferAllocator_remove(allocator, other);
+        nodes[index].size += nodes[other].size;
+        nodes[index].next = nodes[other].next;
+        if (nodes[other].next != GLOAD_BUFFER_ALLOCATOR_NONE) { nodes[nodes[other].next].prev = index; }
+        memset(&nodes[other], 0, sizeof(struct s_gloadBufferNode));
+        allocator->free_nodes[allocator->free_count++] = other;
+    }
+    gloadBufferAllocator_insert(allocator, index);
+}
+
+/* `gloadBufferAllocatorOffset`:
+ *
+ * - param: `const t_gloadBufferAllocator *allocator` - allocator
+ * - param: `GLuint64 handle` - handle of an allocation
+ * - return: current offset of the allocation in bytes, -1 if the handle is invalid or the allocation was released.
+ * */
+GLAPI GLintptr  gloadBufferAllocatorOffset(const t_gloadBufferAllocator *allocator, GLuint64 handle) {
+    const struct s_gloadBufferNode  *nodes;
+    GLuint                          index;
+
+    if (!allocator || !allocator->nodes || (handle & 0xFFFFFFFFu) >= allocator->capacity) { return (-1); }
+
+    nodes = (const struct s_gloadBufferNode *) allocator->nodes;
+    index = (GLuint) (handle & 0xFFFFFFFFu);
+    if (!nodes[index].used || allocator->generations[index] != (GLuint) (handle >> 32)) { return (-1); }
+    return ((GLintptr) ((GLuint64) nodes[index].offset * allocator->alignment));
+}
+
+/* `gloadBufferAllocatorDefragment`:
+ *
+ * Move every allocation to the front of a new buffer, in order, leaving a single free block at the end.
+ * The name of the buffer changes: bind it again and read the new offsets with `gloadBufferAllocatorOffset`.
+ * NOTE:
+ *  The copies are queued on the GPU; the old buffer is deleted after them.
+ *
+ * - param: `t_gloadBufferAllocator *allocator` - allocator
+ * - return: `true` on success, `false` on failure (the allocator is left untouched).
+ * */
+GLAPI int   gloadBufferAllocatorDefragment(t_gloadBufferAllocator *allocator) {
+    struct s_gloadBufferNode    *nodes;
+    GLuint                      buffer;
+    GLuint                      index;
+    GLuint                      last;
+    GLuint                      cursor;
+    GLuint                      tail;
+
+    if (!allocator || !allocator->nodes) { return (0); }
+
+    /* Copies within a single buffer can't overlap, so everything moves to a new one... */
+    buffer = gloadBufferAllocator_storage(allocator);
+    if (!buffer) { return (0); }
+    if (!allocator->dsa) {
+        glBindBuffer(GL_COPY_READ_BUFFER, allocator->buffer);
+        glBindBuffer(GL_COPY_WRITE_BUFFER, buffer);
+    }
+
+    nodes = (struct s_gloadBufferNode *) allocator->nodes;
+    for (index = 0; index < allocator->capacity; index++) {
+        if (nodes[index].size && !nodes[index].offset && nodes[index].prev == GLOAD_BUFFER_ALLOCATOR_NONE) { break; }
+    }
+
+    /* Used blocks keep their node, and so their handle; the free ones are dropped... */
+    gloadBufferAllocator_reset(allocator);
+    last = GLOAD_BUFFER_ALLOCATOR_NONE;
+    cursor = 0;
+    while (index != GLOAD_BUFFER_ALLOCATOR_NONE && index < allocator->capacity) {
+        GLuint  next;
+
+        next = nodes[index].next;
+        if (nodes[index].used) {
+            if (nodes[index].offset != cursor) { allocator->moves++; }
+            if (allocator->dsa) {
+                glCopyNamedBufferSubData(allocator->buffer, buffer, (GLintptr) ((GLuint64) nodes[index].offset * allocator->alignment),
+                                         (GLintptr) ((GLuint64) cursor * allocator->alignment), (GLsizeiptr) ((GLuint64) nodes[index].size * allocator->alignment));
+            }
+            else {
+                glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, (GLintptr) ((GLuint64) nodes[index].offset * allocator->alignment),
+                                    (GLintptr) ((GLuint64) cursor * allocator->alignment), (GLsizeiptr) ((GLuint64) nodes[index].size * allocator->alignment));
+            }
+            nodes[index].offset = cursor;
+            nodes[index].prev = last;
+            nodes[index].next = GLOAD_BUFFER_ALLOCATOR_NONE;
+            if (last != GLOAD_BUFFER_ALLOCATOR_NONE) { nodes[last].next = index; }
+            cursor += nodes[index].size;
+            last = index;
+        }
+        else { memset(&nodes[index], 0, sizeof(struct s_gloadBufferNode)); }
+        index = next;
+    }
+
+    /* Unused nodes are zeroed, so the stack is rebuilt from the ones that don't hold an allocation... */
+    allocator->free_count = 0;
+    for (GLuint i = allocator->capacity; i-- > 0;) {
+        if (!nodes[i].used) { allocator->free_nodes[allocator->free_count++] = i; }
+    }
+    if (cursor < allocator->units) {
+        tail = allocator->free_nodes[--allocator->free_count];
+        nodes[tail].offset = cursor;
+        nodes[tail].size = allocator->units - cursor;
+        nodes[tail].prev = last;
+        nodes[tail].next = GLOAD_BUFFER_ALLOCATOR_NONE;
+        if (last != GLOAD_BUFFER_ALLOCATOR_NONE) { nodes[last].next = tail; }
+        gloadBufferAllocator_insert(allocator, tail);
+    }
+
+    if (!allocator->dsa) {
+        glBindBuffer(GL_COPY_READ_BUFFER, 0);
+        glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+    }
+    glDeleteBuffers(1, &allocator->buffer);
+    allocator->buffer = buffer;
+    return (1);
+}
+
+/* `gloadBufferAllocatorGetStats`:
+ *
+ * - param: `const t_gloadBufferAllocator *allocator` - allocator
+ * - param: `t_gloadBufferAllocatorStats *stats` - usage of the allocator
+ * */
+GLAPI void  gloadBufferAllocatorGetStats(const t_gloadBufferAllocator *allocator, t_gloadBufferAllocatorStats *stats) {
+    const struct s_gloadBufferNode  *nodes;
+    GLuint                          largest;
+
+    if (!stats) { return; }
+    memset(stats, 0, sizeof(t_gloadBufferAllocatorStats));
+    if (!allocator || !allocator->nodes) { return; }
+
+    nodes = (const struct s_gloadBufferNode *) allocator->nodes;
+    largest = 0;
+    for (GLuint i = 0; i < 256; i++) {
+        for (GLuint index = allocator->bins[i]; index != GLOAD_BUFFER_ALLOCATOR_NONE; index = nodes[index].bin_next) {
+            if (nodes[index].size > largest) { largest = nodes[index].size; }
+            stats->free_blocks++;
+        }
+    }
+    stats->used = (GLuint64) allocator->used_units * allocator->alignment;
+    stats->free = (GLuint64) (allocator->units - allocator->used_units) * allocator->alignment;
+    stats->largest_free = (GLuint64) largest * allocator->alignment;
+    stats->allocations = allocator->allocations;
+    stats->fragmentation = stats->free ? 1.0f - (GLfloat) ((double) stats->largest_free / (double) stats->free) : 0.0f;
+}
+
+#   undef GLOAD_BUFFER_ALLOCATOR_MANTISSA
+#   undef GLOAD_BUFFER_ALLOCATOR_NONE
+#  endif /* GLOAD_BUFFER_ALLOCATOR */
+#
+#  if defined (GLOAD_RENDER_GRAPH)
+
+/* SECTION:
+ *  gload render graph API
+ * * * * * * * * * * * * */
+
+#   define GLOAD_RENDER_GRAPH_MAX_ATTACHMENTS 16
+#   define GLOAD_RENDER_GRAPH_REGION_BITS (GL_ATOMIC_COUNTER_BARRIER_BIT | GL_FRAMEBUFFER_BARRIER_BIT | GL_SHADER_IMAGE_ACCESS_BARRIER_BIT | \
+                                           GL_SHADER_STORAGE_BARRIER_BIT | GL_TEXTURE_FETCH_BARRIER_BIT | GL_UNIFORM_BARRIER_BIT)
+
+/* `struct s_gloadRenderGraphPass` - recorded pass; its accesses are `graph->accesses[first]` to `[first + count - 1]`,
+ * its attachments `graph->attachments[target_first]` to `[target_first + target_count - 1]`.
+ * */
+struct s_gloadRenderGraphPass {
+    t_gloadRenderGraphCallback  callback;
+    void                        *user;
+    GLuint                      first;
+    GLuint                      count;
+    GLbitfield                  flags;
+    int                         target;
+    GLuint                      framebuffer;
+    GLuint                      target_first;
+    GLuint                      target_count;
+};
+
+/* `struct s_gloadRenderGraphResource` - state of a resource.
+ * `written` is the sequence number of its last incoherent write, `region` tells whether that pass was by region.
+ * `bytes` is the size of level 0 of an attachment, queried on its first invalidation.
+ * */
+struct s_gloadRenderGraphResource {
+    GLenum      kind;
+    GLuint      name;
+    GLuint64    written;
+    int         region;
+    int         sized;
+    GLuint64    bytes;
+};
+
+/* `gloadRenderGraph_resource`:
+ *
+ * Find the state of a resource, adding it on its first use.
+ *
+ * - return: state of the resource, `NULL` on failure.
+ * */
+static struct s_gloadRenderGraphResource    *gloadRenderGraph_resource(t_gloadRenderGraph *graph, GLenum kind, GLuint name) {
+    struct s_gloadRenderGraphResource   *resources;
+
+    resources = (struct s_gloadRenderGraphResource *) graph->resources;
+    for (GLuint i = 0; i < graph->resource_count; i++) {
+        if (resources[i].name == name && resources[i].kind == kind) { return (&resources[i]); }
+    }
+    if (graph->resource_count == graph->resource_capacity) {
+        GLuint  capacity;
+
+        capacity = graph->resource_capacity ? graph->resource_capacity * 2 : 32;
+        resources = (struct s_gloadRenderGraphResource *) realloc(graph->resources, capacity * sizeof(struct s_gloadRenderGraphResource));
+        if (!resources) { return (0); }
+        graph->resources = resources;
+        graph->resource_capacity = capacity;
+    }
+    memset(&resources[graph->resource_count], 0, sizeof(struct s_gloadRenderGraphResource));
+    resources[graph->resource_count].kind = kind;
+    resources[graph->resource_count].name = name;
+    return (&resources[graph->resource_count++]);
+}
+
+/* `gloadRenderGraph_barrier`:
+ *
+ * Compute and issue the barrier bits a pass needs: a bit is needed when the pass accesses a resource that way,
+ * and the resource was written after the last barrier holding that bit.
+ *
+ * - return: `true` if a barrier was issued, `false` otherwise.
+ * */
+static int  gloadRenderGraph_barrier(t_gloadRenderGraph *graph, const struct s_gloadRenderGraphPass *pass) {
+    struct s_gloadRenderGraphResource   *resource;
+    const t_gloadRenderGraphAccess      *access;
+    GLbitfield                          needed;
+    GLbitfield                          bits;
+    int                                 region;
+
+    if (!graph->barrier) { return (0); }
+
+    needed = 0;
+    region = graph->by_region && (pass->flags & GLOAD_RENDER_GRAPH_BY_REGION);
+    for (GLuint i = 0; i < pass->count; i++) {
+        access = &graph->accesses[pass->first + i];
+        resource = gloadRenderGraph_resource(graph, access->kind, access->name);
+        if (!resource) {
+            needed = GL_ALL_BARRIER_BITS;
+            region = 0;
+            break;
+        }
+        if (!resource->written) { continue; }
+
+        bits = access->read | access->write;
+        for (GLuint bit = 0; bit < 32; bit++) {
+            if (!(bits & (1u << bit))) { continue; }
+            if (resource->written > (region && resource->region ? graph->issued_region[bit] : graph->issued[bit])) {
+                needed |= 1u << bit;
+                region = region && resource->region;
+            }
+        }
+    }
+    if (!needed) { return (0); }
+
+    /* A barrier by region only covers fragment shaders of the same framebuffer region... */
+    if (region && !(needed & ~GLOAD_RENDER_GRAPH_REGION_BITS)) {
+        glMemoryBarrierByRegion(needed);
+        for (GLuint bit = 0; bit < 32; bit++) {
+            if (needed & (1u << bit)) { graph->issued_region[bit] = graph->sequence; }
+        }
+        graph->region_barriers++;
+    }
+    else {
+        glMemoryBarrier(needed);
+        for (GLuint bit = 0; bit < 32; bit++) {
+            if (needed & (1u << bit)) { graph->issued[bit] = graph->issued_region[bit] = graph->sequence; }
+        }
+        graph->barriers++;
+    }
+    return (1);
+}
+
+/* `gloadRenderGraph_bytes`:
+ *
+ * Compute the size of an attachment from the sizes of its components, once.
+ * Textures are only measured with OpenGL 4.5 or GL_ARB_direct_state_access, the default framebuffer never.
+ * Renderbuffers are queried by name with DSA; otherwise the `GL_RENDERBUFFER` binding is restored afterwards.
+ * */
+static GLuint64 gloadRenderGraph_bytes(t_gloadRenderGraph *graph, GLenum kind, GLuint name) {
+    static const GLenum                 texture_sizes[] = {
+        GL_TEXTURE_RED_SIZE, GL_TEXTURE_GREEN_SIZE, GL_TEXTURE_BLUE_SIZE, GL_TEXTURE_ALPHA_SIZE, GL_TEXTURE_DEPTH_SIZE, GL_TEXTURE_STENCIL_SIZE
+    };
+    static const GLenum                 renderbuffer_sizes[] = {
+        GL_RENDERBUFFER_RED_SIZE, GL_RENDERBUFFER_GREEN_SIZE, GL_RENDERBUFFER_BLUE_SIZE, GL_RENDERBUFFER_ALPHA_SIZE,
+        GL_RENDERBUFFER_DEPTH_SIZE, GL_RENDERBUFFER_STENCIL_SIZE
+    };
+    struct s_gloadRenderGraphResource   *resource;
+    GLint                               width;
+    GLint                               height;
+    GLint                               samples;
+    GLint                               bits;
+    GLint                               size;
+    GLint                               bound;
+
+    resource = gloadRenderGraph_resource(graph, kind, name);
+    if (!resource) { return (0); }
+    if (resource->sized) { return (resource->bytes); }
+    resource->sized = 1;
+
+    width = height = samples = bits = 0;
+    if (kind == GL_TEXTURE && name && graph->dsa) {
+        glGetTextureLevelParameteriv(name, 0, GL_TEXTURE_WIDTH, &width);
+        glGetTextureLevelParameteriv(name, 0, GL_TEXTURE_HEIGHT, &height);
+        glGetTextureLevelParameteriv(name, 0, GL_TEXTURE_SAMPLES, &samples);
+        for (GLuint i = 0; i < sizeof(texture_sizes) / sizeof(*texture_sizes); i++) {
+            size = 0;
+            glGetTextureLevelParameteriv(name, 0, texture_sizes[i], &size);
+            bits += size;
+        }
+    }
+    else if (kind == GL_RENDERBUFFER && name && graph->dsa && glGetNamedRenderbufferParameteriv) {
+        glGetNamedRenderbufferParameteriv(name, GL_RENDERBUFFER_WIDTH, &width);
+        glGetNamedRenderbufferParameteriv(name, GL_RENDERBUFFER_HEIGHT, &height);
+        glGetNamedRenderbufferParameteriv(name, GL_RENDERBUFFER_SAMPLES, &samples);
+        for (GLuint i = 0; i < sizeof(renderbuffer_sizes) / sizeof(*renderbuffer_sizes); i++) {
+            size = 0;
+            glGetNamedRenderbufferParameteriv(name, renderbuffer_sizes[i], &size);
+            bits += size;
+        }
+    }
+    else if (kind == GL_RENDERBUFFER && name && glGetRenderbufferParameteriv) {
+        bound = 0;
+        glGetIntegerv(GL_RENDERBUFFER_BINDING, &bound);
+        glBindRenderbuffer(GL_RENDERBUFFER, name);
+        glGetRenderbufferParameteriv(GL_RENDERBUFFER, GL_RENDERBUFFER_WIDTH, &width);
+        glGetRenderbufferParameteriv(GL_RENDERBUFFER, GL_RENDERBUFFER_HEIGHT, &height);
+        glGetRenderbufferParameteriv(GL_RENDERBUFFER, GL_RENDERBUFFER_SAMPLES, &samples);
+        for (GLuint i = 0; i < sizeof(renderbuffer_sizes) / sizeof(*renderbuffer_sizes); i++) {
+            size = 0;
+            glGetRenderbufferParameteriv(GL_RENDERBUFFER, renderbuffer_sizes[i], &size);
+            bits += size;
+        }
+        glBindRenderbuffer(GL_RENDERBUFFER, (GLuint) bound);
+    }
+    resource->bytes = (GLuint64) width * (GLuint64) height * (GLuint64) (samples > 1 ? samples : 1) * (GLuint64) bits / 8;
+    return (resource->bytes);
+}
+
+/* `gloadRenderGraph_stored`:
+ *
+ * Check if an attachment of the pass `index` must be stored: it is kept, or a later pass reads it (or renders to it
+ * without clearing) before another pass clears it.
+ * */
+static int  gloadRenderGraph_stored(const t_gloadRenderGraph *graph, GLuint index, const t_gloadRenderGraphAttachment *attachment) {
+    const struct s_gloadRenderGraphPass *passes;
+    const t_gloadRenderGraphAccess      *access;
+    const t_gloadRenderGraphAttachment  *other;
+
+    if (attachment->flags & GLOAD_RENDER_GRAPH_KEEP) { return (1); }
+
+    passes = (const struct s_gloadRenderGraphPass *) graph->passes;
+    for (GLuint i = index + 1; i < graph->pass_count; i++) {
+        for (GLuint j = 0; j < passes[i].count; j++) {
+            access = &graph->accesses[passes[i].first + j];
+            if (access->name == attachment->name && access->kind == attachment->kind) { return (1); }
+        }
+
+        /* Attachments of the default framebuffer have no name, only an attachment point... */
+        for (GLuint j = 0; j < passes[i].target_count; j++) {
+            other = &graph->attachments[passes[i].target_first + j];
+            if (other->name != attachment->name || other->kind != attachment->kind) { continue; }
+            if (!attachment->name && (other->attachment != attachment->attachment || passes[i].framebuffer)) { continue; }
+            return (!(other->flags & GLOAD_RENDER_GRAPH_CLEAR));
+        }
+    }
+    return (0);
+}
+
+/* `gloadRenderGraph_invalidate`:
+ *
+ * Invalidate attachments of a framebuffer; without DSA, the framebuffer is bound.
+ * */
+static void gloadRenderGraph_invalidate(t_gloadRenderGraph *graph, GLuint framebuffer, GLsizei count, const GLenum *attachments) {
+    if (!count) { return; }
+
+    if (graph->invalidate == 1) { glInvalidateNamedFramebufferData(framebuffer, count, attachments); }
+    else {
+        glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+        if (graph->invalidate == 2) { glInvalidateFramebuffer(GL_FRAMEBUFFER, count, attachments); }
+        else { glDiscardFramebufferEXT(GL_FRAMEBUFFER, count, attachments); }
+    }
+    graph->invalidations++;
+}
+
+/* `gloadRenderGraphCreate`:
+ *
+ * Create an empty render graph.
+ * NOTE:
+ *  This function requires a current context and loaded OpenGL functions.
+ *  Barriers require OpenGL 4.2 or GL_ARB_shader_image_load_store; invalidation OpenGL 4.3, OpenGL ES 3.0,
+ *  GL_ARB_invalidate_subdata or GL_EXT_discard_framebuffer. Without either, the graph only runs the passes.
+ *
+ * - param: `t_gloadRenderGraph *graph` - graph to initialize
+ * - param: `int timing` - measure the GPU time of `gloadRenderGraphExecute` with a `GL_TIME_ELAPSED` query
+ * - return: `true` on success, `false` on failure.
+ * */
+GLAPI int   gloadRenderGraphCreate(t_gloadRenderGraph *graph, int timing) {
+    const char  *version;
+    int         es;
+
+    if (!graph) { return (0); }
+    memset(graph, 0, sizeof(t_gloadRenderGraph));
+    if (!glGetString) { return (0); }
+
+    version = (const char *) glGetString(GL_VERSION);
+    es = version && !strncmp(version, "OpenGL ES", 9);
+    graph->barrier = glMemoryBarrier != 0 && (gloadIsVersionSupported(4, 2) || gloadIsExtensionSupported("GL_ARB_shader_image_load_store"));
+    graph->by_region = graph->barrier && glMemoryBarrierByRegion != 0 &&
+                       (gloadIsVersionSupported(4, 5) || gloadIsExtensionSupported("GL_ARB_ES3_1_compatibility"));
+
+    /* Invalidation through DSA (1), the bound framebuffer (2), or GL_EXT_discard_framebuffer on OpenGLES 2 (3)... */
+    if (glInvalidateFramebuffer && (gloadIsVersionSupported(es ? 3 : 4, es ? 0 : 3) || gloadIsExtensionSupported("GL_ARB_invalidate_subdata"))) {
+        graph->invalidate = 2;
+        graph->dsa = glInvalidateNamedFramebufferData && glGetTextureLevelParameteriv &&
+                     (gloadIsVersionSupported(4, 5) || gloadIsExtensionSupported("GL_ARB_direct_state_access"));
+        if (graph->dsa) { graph->invalidate = 1; }
+    }
+    else if (glDiscardFramebufferEXT && gloadIsExtensionSupported("GL_EXT_discard_framebuffer")) { graph->invalidate = 3; }
+
+#   if defined (GLOAD_VERBOSE_WARN)
+    if (!graph->barrier) { fprintf(stderr, "gload.h: render graph can't issue memory barriers without OpenGL 4.2.\n"); }
+#   endif /* GLOAD_VERBOSE_WARN */
+
+    if (timing && glGenQueries && glGetQueryObjectui64v && (gloadIsVersionSupported(3, 3) || gloadIsExtensionSupported("GL_ARB_timer_query"))) {
+        glGenQueries(1, &graph->query);
+    }
+    return (1);
+}
+
+/* `gloadRenderGraphDestroy`:
+ *
+ * Release the graph.
+ *
+ * - param: `t_gloadRenderGraph *graph` - graph to destroy
+ * */
+GLAPI void  gloadRenderGraphDestroy(t_gloadRenderGraph *graph) {
+    if (!graph) { return; }
+
+    if (graph->query) { glDeleteQueries(1, &graph->query); }
+    free(graph->passes);
+    free(graph->accesses);
+    free(graph->attachments);
+    free(graph->resources);
+    memset(graph, 0, sizeof(t_gloadRenderGraph));
+}
+
+/* `gloadRenderGraphAddPass`:
+ *
+ * Append a pass to the graph. The accesses are copied.
+ *
+ * - param: `t_gloadRenderGraph *graph` - graph
+ * - param: `t_gloadRenderGraphCallback callback` - records the commands of the pass
+ * - param: `void *user` - parameter of the callback
+ * - param: `const t_gloadRenderGraphAccess *accesses` - resources used by the pass
+ * - param: `GLuint count` - number of accesses
+ * - param: `GLbitfield flags` - `GLOAD_RENDER_GRAPH_*` flags
+ * - return: `true` on success, `false` on failure.
+ * */
+GLAPI int   gloadRenderGraphAddPass(t_gloadRenderGraph *graph, t_gloadRenderGraphCallback callback, void *user, const t_gloadRenderGraphAccess *accesses, GLuint count, GLbitfield flags) {
+    struct s_gloadRenderGraphPass   *pass;
+
+    if (!graph || !callback || (count && !accesses)) { return (0); }
+
+    if (graph->pass_count == graph->pass_capacity) {
+        GLuint  capacity;
+        void    *passes;
+
+        capacity = graph->pass_capacity ? graph->pass_capacity * 2 : 16;
+        passes = realloc(graph->passes, capacity * sizeof(struct s_gloadRenderGraphPass));
+        if (!passes) { return (0); }
+        graph->passes = passes;
+        graph->pass_capacity = capacity;
+    }
+    if (graph->access_count + count > graph->access_capacity) {
+        t_gloadRenderGraphAccess    *list;
+        GLuint                      capacity;
+
+        capacity = graph->access_capacity ? graph->access_capacity : 32;
+        while (capacity < graph->access_count + count) { capacity *= 2; }
+        list = (t_gloadRenderGraphAccess *) realloc(graph->accesses, capacity * sizeof(t_gloadRenderGraphAccess));
+        if (!list) { return (0); }
+        graph->accesses = list;
+        graph->access_capacity = capacity;
+    }
+
+    if (count) { memcpy(&graph->accesses[graph->access_count], accesses, count * sizeof(t_gloadRenderGraphAccess)); }
+    pass = &((struct s_gloadRenderGraphPass *) graph->passes)[graph->pass_count++];
+    pass->callback = callback;
+    pass->user = user;
+    pass->first = graph->access_count;
+    pass->count = count;
+    pass->flags = flags;
+    pass->target = 0;
+    pass->framebuffer = 0;
+    pass->target_first = pass->target_count = 0;
+    graph->access_count += count;
+    return (1);
+}
+
+/* `gloadRenderGraphSetTarget`:
+ *
+ * Set the framebuffer the last added pass renders to. The attachments are copied.
+ * The framebuffer is bound before the callback of the pass, which must leave it bound.
+ *
+ * - param: `t_gloadRenderGraph *graph` - graph
+ * - param: `GLuint framebuffer` - framebuffer of the pass
+ * - param: `const t_gloadRenderGraphAttachment *attachments` - attachments of the framebuffer
+ * - param: `GLuint count` - number of attachments
+ * - return: `true` on success, `false` on failure.
+ * */
+GLAPI int   gloadRenderGraphSetTarget(t_gloadRenderGraph *graph, GLuint framebuffer, const t_gloadRenderGraphAttachment *attachments, GLuint count) {
+    struct s_gloadRenderGraphPass   *pass;
+
+    if (!graph || !graph->pass_count || (count && !attachments)) { return (0); }
+
+    if (graph->attachment_count + count > graph->attachment_capacity) {
+        t_gloadRenderGraphAttachment    *list;
+        GLuint                          capacity;
+
+        capacity = graph->attachment_capacity ? graph->attachment_capacity : 16;
+        while (capacity < graph->attachment_count + count) { capacity *= 2; }
+        list = (t_gloadRenderGraphAttachment *) realloc(graph->attachments, capacity * sizeof(t_gloadRenderGraphAttachment));
+        if (!list) { return (0); }
+        graph->attachments = list;
+        graph->attachment_capacity = capacity;
+    }
+
+    if (count) { memcpy(&graph->attachments[graph->attachment_count], attachments, count * sizeof(t_gloadRenderGraphAttachment)); }
+    pass = &((struct s_gloadRenderGraphPass *) graph->passes)[graph->pass_count - 1];
+    pass->target = 1;
+    pass->framebuffer = framebuffer;
+    pass->target_first = graph->attachment_count;
+    pass->target_count = count;
+    graph->attachment_count += count;
+    return (1);
+}
+
+/* `gloadRenderGraphExecute`:
+ *
+ * Run the passes in order, each preceded by the barrier bits its reads and writes need, merged in a single call,
+ * then empty the graph. Writes not yet made visible carry over to the passes of the next execution.
+ * Cleared attachments are invalidated before their pass, and transient attachments no later pass reads after it.
+ *
+ * - param: `t_gloadRenderGraph *graph` - graph
+ * - return: number of barriers issued.
+ * */
+GLAPI GLuint    gloadRenderGraphExecute(t_gloadRenderGraph *graph) {
+    struct s_gloadRenderGraphResource   *resource;
+    struct s_gloadRenderGraphPass       *pass;
+    GLuint                              count;
+    int                                 timing;
+
+    if (!graph) { return (0); }
+
+    /* The result of the previous query is read without waiting, so some executions go unmeasured... */
+    timing = 0;
+    if (graph->query) {
+        if (graph->query_pending) {
+            GLuint  available;
+
+            available = 0;
+            glGetQueryObjectuiv(graph->query, GL_QUERY_RESULT_AVAILABLE, &available);
+            if (available) {
+                glGetQueryObjectui64v(graph->query, GL_QUERY_RESULT, &graph->gpu_time);
+                graph->query_pending = 0;
+            }
+        }
+        if (!graph->query_pending) {
+            glBeginQuery(GL_TIME_ELAPSED, graph->query);
+            timing = 1;
+        }
+    }
+
+    count = 0;
+    for (GLuint i = 0; i < graph->pass_count; i++) {
+        const t_gloadRenderGraphAttachment  *attachment;
+        GLenum                              list[GLOAD_RENDER_GRAPH_MAX_ATTACHMENTS];
+        GLsizei                             n;
+
+        pass = &((struct s_gloadRenderGraphPass *) graph->passes)[i];
+        count += (GLuint) gloadRenderGraph_barrier(graph, pass);
+
+        /* Contents about to be cleared are never loaded into the tiles... */
+        if (pass->target) {
+            glBindFramebuffer(GL_FRAMEBUFFER, pass->framebuffer);
+            n = 0;
+            for (GLuint j = 0; j < pass->target_count && graph->invalidate; j++) {
+                attachment = &graph->attachments[pass->target_first + j];
+                if (n < GLOAD_RENDER_GRAPH_MAX_ATTACHMENTS && (attachment->flags & GLOAD_RENDER_GRAPH_CLEAR)) { list[n++] = attachment->attachment; }
+            }
+            gloadRenderGraph_invalidate(graph, pass->framebuffer, n, list);
+        }
+        pass->callback(pass->user);
+
+        /* ...and transient ones no later pass reads are never stored back */
+        if (pass->target && graph->invalidate) {
+            n = 0;
+            for (GLuint j = 0; j < pass->target_count; j++) {
+                attachment = &graph->attachments[pass->target_first + j];
+                if (n == GLOAD_RENDER_GRAPH_MAX_ATTACHMENTS || gloadRenderGraph_stored(graph, i, attachment)) { continue; }
+                list[n++] = attachment->attachment;
+                graph->invalidated_bytes += gloadRenderGraph_bytes(graph, attachment->kind, attachment->name);
+            }
+            gloadRenderGraph_invalidate(graph, pass->framebuffer, n, list);
+        }
+
+        graph->sequence++;
+        for (GLuint j = 0; j < pass->count; j++) {
+            if (!graph->accesses[pass->first + j].write) { continue; }
+            resource = gloadRenderGraph_resource(graph, graph->accesses[pass->first + j].kind, graph->accesses[pass->first + j].name);
+            if (!resource) { continue; }
+            resource->written = graph->sequence;
+            resource->region = (pass->flags & GLOAD_RENDER_GRAPH_BY_REGION) != 0;
+        }
+    }
+    graph->executed += graph->pass_count;
+    graph->pass_count = 0;
+    graph->access_count = 0;
+    graph->attachment_count = 0;
+
+    if (timing) {
+        glEndQuery(GL_TIME_ELAPSED);
+        graph->query_pending = 1;
+    }
+    return (count);
+}
+
+#   undef GLOAD_RENDER_GRAPH_REGION_BITS
+#   undef GLOAD_RENDER_GRAPH_MAX_ATTACHMENTS
+#  endif /* GLOAD_RENDER_GRAPH */
+#
+#  if defined (GLOAD_CONTEXT_POOL)
+
+/* SECTION:
+ *  gload context pool API
+ * * * * * * * * * * * * * */
+
+/* `struct s_gloadContextPoolJob` - single job submitted to the pool.
+ * */
+struct s_gloadContextPoolJob {
+    struct s_gloadContextPoolJob    *next;
+    GLsync                          fence;
+    t_gloadContextJob               job;
+    t_gloadContextJob               done;
+    void                            *user;
+};
+
+/* `struct s_gloadContextPoolWorker` - worker thread and the hidden context it owns.
+ * */
+struct s_gloadContextPoolWorker {
+    t_gloadInternalThread               thread;
+    void                                *context;
+    struct s_gloadContextPoolWorkers    *workers;
+};
+
+/* `struct s_gloadContextPoolWorkers` - state shared between the pool and its worker threads.
+ * `queue` holds the jobs waiting for a worker, `done` the fenced jobs waiting for `gloadContextPoolPoll`.
+ * */
+struct s_gloadContextPoolWorkers {
+    t_gloadInternalMutex            mutex;
+    t_gloadInternalCond             work;
+    t_gloadInternalCond             finished;
+    struct s_gloadContextPoolJob    *queue;
+    struct s_gloadContextPoolJob    **queue_tail;
+    struct s_gloadContextPoolJob    *done;
+    GLuint                          outstanding;
+    GLuint                          ready;
+    GLuint                          dead;
+    int                             stop;
+    t_gloadContextBackend           backend;
+    GLuint                          count;
+    struct s_gloadContextPoolWorker worker[1];
+};
+
+#   if defined (GLOAD_EGL) || defined (GLOAD_GLX)
+
+/* `struct s_gloadContextPoolContext` - hidden context created through the platform backend.
+ * */
+struct s_gloadContextPoolContext {
+
+#    if defined (GLOAD_EGL)
+    EGLDisplay  display;
+    EGLContext  context;
+    EGLSurface  surface;
+    EGLenum     api;
+#    endif /* GLOAD_EGL */
+#    if defined (GLOAD_GLX)
+    Display     *display;
+    GLXContext  context;
+    GLXPbuffer  drawable;
+#    endif /* GLOAD_GLX */
+
+};
+
+/* `gloadContextPool_version`:
+ *
+ * Query the version and profile of the current context, to create the hidden ones alike.
+ * Both are left at 0 before OpenGL 3.0, the profile too on OpenGL ES or before OpenGL 3.2.
+ * */
+static void gloadContextPool_version(GLint *major, GLint *minor, GLint *profile, int desktop) {
+    *major = *minor = *profile = 0;
+    if (!gloadIsVersionSupported(3, 0)) { return; }
+
+    glGetIntegerv(GL_MAJOR_VERSION, major);
+    glGetIntegerv(GL_MINOR_VERSION, minor);
+    if (desktop && gloadIsVersionSupported(3, 2)) { glGetIntegerv(GL_CONTEXT_PROFILE_MASK, profile); }
+}
+
+#   endif /* GLOAD_EGL, GLOAD_GLX */
+#   if defined (GLOAD_EGL)
+
+/* `gloadContextPool_create`:
+ *
+ * Create an EGL context shared with the current one, with its config, client API, version and profile.
+ * It is made current without a surface with EGL_KHR_surfaceless_context, on a 1x1 pbuffer otherwise.
+ * */
+static void *gloadContextPool_create(void *user) {
+    struct s_gloadContextPoolContext    *ctx;
+    EGLContext                          share;
+    EGLConfig                           config;
+    const char                          *extensions;
+    EGLint                              config_id;
+    EGLint                              count;
+    EGLint                              attribs[8];
+    EGLint                              n;
+    GLint                               major;
+    GLint                               minor;
+    GLint                               profile;
+
+    (void) user;
+    share = eglGetCurrentContext();
+    if (share == EGL_NO_CONTEXT) { return (0); }
+    ctx = (struct s_gloadContextPoolContext *) calloc(1, sizeof(struct s_gloadContextPoolContext));
+    if (!ctx) { return (0); }
+    ctx->display = eglGetCurrentDisplay();
+    ctx->api = eglQueryAPI();
+
+    /* Contexts created without a config (EGL_KHR_no_config_context) report a config id of 0... */
+    config = (EGLConfig) 0;
+    config_id = 0;
+    eglQueryContext(ctx->display, share, EGL_CONFIG_ID, &config_id);
+    if (config_id) {
+        EGLint  select[] = { EGL_CONFIG_ID, 0, EGL_NONE };
+
+        select[1] = config_id;
+        count = 0;
+        if (!eglChooseConfig(ctx->display, select, &config, 1, &count) || !count) { config = (EGLConfig) 0; }
+    }
+
+    gloadContextPool_version(&major, &minor, &profile, ctx->api == EGL_OPENGL_API);
+    n = 0;
+    if (major) {
+        attribs[n++] = EGL_CONTEXT_MAJOR_VERSION_KHR, attribs[n++] = major;
+        attribs[n++] = EGL_CONTEXT_MINOR_VERSION_KHR, attribs[n++] = minor;
+    }
+    if (profile) { attribs[n++] = EGL_CONTEXT_OPENGL_PROFILE_MASK_KHR, attribs[n++] = profile; }
+    attribs[n] = EGL_NONE;
+
+    ctx->context = eglCreateContext(ctx->display, config, share, attribs);
+    if (ctx->context == EGL_NO_CONTEXT) {
+        free(ctx);
+        return (0);
+    }
+
+    /* Without EGL_KHR_surfaceless_context, the context is made current on a 1x1 pbuffer... */
+    ctx->surface = EGL_NO_SURFACE;
+    extensions = eglQueryString(ctx->display, EGL_EXTENSIONS);
+    if (config && (!extensions || !strstr(extensions, "EGL_KHR_surfaceless_context"))) {
+        EGLint  size[] = { EGL_WIDTH, 1, EGL_HEIGHT, 1, EGL_NONE };
+
+        ctx->surface = eglCreatePbufferSurface(ctx->display, config, size);
+    }
+    return (ctx);
+}
+
+/* `gloadContextPool_makeCurrent`:
+ *
+ * Make a hidden context current on the calling thread, or release the current one and the thread's EGL state.
+ * */
+static int  gloadContextPool_makeCurrent(void *context, void *user) {
+    struct s_gloadContextPoolContext    *ctx;
+
+    (void) user;
+    ctx = (struct s_gloadContextPoolContext *) context;
+    if (!ctx) {
+        eglMakeCurrent(eglGetCurrentDisplay(), EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+        return (eglReleaseThread());
+    }
+
+    /* The bound client API is a per-thread state, set on the worker before the first binding... */
+    eglBindAPI(ctx->api);
+    return (eglMakeCurrent(ctx->display, ctx->surface, ctx->surface, ctx->context));
+}
+
+/* `gloadContextPool_destroy`:
+ *
+ * Destroy a hidden EGL context and its pbuffer, if any.
+ * */
+static void gloadContextPool_destroy(void *context, void *user) {
+    struct s_gloadContextPoolContext    *ctx;
+
+    (void) user;
+    ctx = (struct s_gloadContextPoolContext *) context;
+    eglDestroyContext(ctx->display, ctx->context);
+    if (ctx->surface != EGL_NO_SURFACE) { eglDestroySurface(ctx->display, ctx->surface); }
+    free(ctx);
+}
+
+#   endif /* GLOAD_EGL */
+#   if defined (GLOAD_GLX)
+
+/* `gloadContextPool_create`:
+ *
+ * Create a GLX context shared with the current one, with its framebuffer config, version and profile,
+ * and the 1x1 pbuffer it is made current on.
+ * */
+static void *gloadContextPool_create(void *user) {
+    struct s_gloadContextPoolContext    *ctx;
+    PFNGLXCREATECONTEXTATTRIBSARBPROC   create;
+    GLXContext                          share;
+    GLXFBConfig                         *configs;
+    int                                 select[] = { GLX_FBCONFIG_ID, 0, None };
+    int                                 size[] = { GLX_PBUFFER_WIDTH, 1, GLX_PBUFFER_HEIGHT, 1, None };
+    int                                 attribs[8];
+    int                                 screen;
+    int                                 count;
+    int                                 n;
+    GLint                               major;
+    GLint                               minor;
+    GLint                               profile;
+
+    (void) user;
+    share = glXGetCurrentContext();
+    if (!share) { return (0); }
+    ctx = (struct s_gloadContextPoolContext *) calloc(1, sizeof(struct s_gloadContextPoolContext));
+    if (!ctx) { return (0); }
+    ctx->display = glXGetCurrentDisplay();
+
+    screen = 0;
+    glXQueryContext(ctx->display, share, GLX_SCREEN, &screen);
+    glXQueryContext(ctx->display, share, GLX_FBCONFIG_ID, &select[1]);
+    count = 0;
+    configs = glXChooseFBConfig(ctx->display, screen, select, &count);
+    if (!configs || !count) {
+        if (configs) { XFree(configs); }
+        free(ctx);
+        return (0);
+    }
+
+    gloadContextPool_version(&major, &minor, &profile, 1);
+    create = (PFNGLXCREATECONTEXTATTRIBSARBPROC) glXGetProcAddress((const GLubyte *) "glXCreateContextAttribsARB");
+    if (create && major) {
+        n = 0;
+        attribs[n++] = GLX_CONTEXT_MAJOR_VERSION_ARB, attribs[n++] = major;
+        attribs[n++] = GLX_CONTEXT_MINOR_VERSION_ARB, attribs[n++] = minor;
+        if (profile) { attribs[n++] = GLX_CONTEXT_PROFILE_MASK_ARB, attribs[n++] = profile; }
+        attribs[n] = None;
+        ctx->context = create(ctx->display, configs[0], share, True, attribs);
+    }
+    else {
+        ctx->context = glXCreateNewContext(ctx->display, configs[0], GLX_RGBA_TYPE, share, True);
+    }
+    if (ctx->context) { ctx->drawable = glXCreatePbuffer(ctx->display, configs[0], size); }
+    XFree(configs);
+    if (!ctx->context) {
+        free(ctx);
+        return (0);
+    }
+    return (ctx);
+}
+
+/* `gloadContextPool_makeCurrent`:
+ *
+ * Make a hidden context current on the calling thread with its pbuffer, or release the current one.
+ * */
+static int  gloadContextPool_makeCurrent(void *context, void *user) {
+    struct s_gloadContextPoolContext    *ctx;
+
+    (void) user;
+    ctx = (struct s_gloadContextPoolContext *) context;
+    if (!ctx) { return (glXMakeContextCurrent(glXGetCurrentDisplay(), None, None, 0)); }
+    return (glXMakeContextCurrent(ctx->display, ctx->drawable, ctx->drawable, ctx->context));
+}
+
+/* `gloadContextPool_destroy`:
+ *
+ * Destroy a hidden GLX context and its pbuffer.
+ * */
+static void gloadContextPool_destroy(void *context, void *user) {
+    struct s_gloadContextPoolContext    *ctx;
+
+    (void) user;
+    ctx = (struct s_gloadContextPoolContext *) context;
+    glXDestroyContext(ctx->display, ctx->context);
+    if (ctx->drawable) { glXDestroyPbuffer(ctx->display, ctx->drawable); }
+    free(ctx);
+}
+
+#   endif /* GLOAD_GLX */
+
+GLOAD_INTERNAL_THREADPROC(gloadContextPool_worker, arg) {
+    struct s_gloadContextPoolWorker     *worker;
+    struct s_gloadContextPoolWorkers    *workers;
+    struct s_gloadContextPoolJob        *job;
+
+    worker = (struct s_gloadContextPoolWorker *) arg;
+    workers = worker->workers;
+    if (!workers->backend.make_current(worker->context, workers->backend.user)) {
+        gloadInternal_mutexLock(&workers->mutex);
+        workers->dead++;
+        gloadInternal_condBroadcast(&workers->finished);
+        gloadInternal_mutexUnlock(&workers->mutex);
+        GLOAD_INTERNAL_THREADEXIT;
+    }
+
+    gloadInternal_mutexLock(&workers->mutex);
+    workers->ready++;
+    gloadInternal_condBroadcast(&workers->finished);
+    for (;;) {
+        while (!workers->queue && !workers->stop) {
+            gloadInternal_condWait(&workers->work, &workers->mutex);
+        }
+        if (!workers->queue) { break; }
+
+        job = workers->queue;
+        workers->queue = job->next;
+        if (!workers->queue) { workers->queue_tail = &workers->queue; }
+        gloadInternal_mutexUnlock(&workers->mutex);
+
+        /* The fence must be flushed, or a context waiting on it from another thread may never see it signaled... */
+        job->job(job->user);
+        job->fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        glFlush();
+
+        gloadInternal_mutexLock(&workers->mutex);
+        job->next = workers->done;
+        workers->done = job;
+        workers->outstanding--;
+        gloadInternal_condBroadcast(&workers->finished);
+    }
+    gloadInternal_mutexUnlock(&workers->mutex);
+
+    workers->backend.make_current(0, workers->backend.user);
+    GLOAD_INTERNAL_THREADEXIT;
+}
+
+/* Hand the finished jobs over and call their completion procedures; with `wait`, block until every job is finished... */
+static GLuint   gloadContextPool_poll(t_gloadContextPool *pool, int wait) {
+    struct s_gloadContextPoolWorkers    *workers;
+    struct s_gloadContextPoolJob        *job;
+
+    workers = (struct s_gloadContextPoolWorkers *) pool->workers;
+    if (workers) {
+        gloadInternal_mutexLock(&workers->mutex);
+        while (wait && workers->outstanding) {
+            gloadInternal_condWait(&workers->finished, &workers->mutex);
+        }
+        while (workers->done) {
+            job = workers->done;
+            workers->done = job->next;
+            job->next = (struct s_gloadContextPoolJob *) pool->pending;
+            pool->pending = job;
+        }
+        gloadInternal_mutexUnlock(&workers->mutex);
+    }
+
+    while (pool->pending) {
+        job = (struct s_gloadContextPoolJob *) pool->pending;
+        pool->pending = job->next;
+        if (job->fence) {
+            glWaitSync(job->fence, 0, GL_TIMEOUT_IGNORED);
+            glDeleteSync(job->fence);
+        }
+        pool->completed++;
+        if (job->done) { job->done(job->user); }
+        free(job);
+    }
+    return (pool->submitted - pool->completed);
+}
+
+/* `gloadContextPoolCreate`:
+ *
+ * Create `count` hidden contexts shared with the current one and start a worker thread for each of them.
+ * NOTE:
+ *  This function requires a current context and loaded OpenGL functions.
+ *  Objects created by the jobs must be bound again in the rendering context to see their contents.
+ *  It fails if a worker thread can't make its context current.
+ *
+ * - param: `t_gloadContextPool *pool` - pool to initialize
+ * - param: `GLuint count` - number of worker threads
+ * - param: `const t_gloadContextBackend *backend` - procedures managing the contexts (null for EGL or GLX)
+ * - return: `true` on success, `false` on failure.
+ * */
+GLAPI int   gloadContextPoolCreate(t_gloadContextPool *pool, GLuint count, const t_gloadContextBackend *backend) {
+    struct s_gloadContextPoolWorkers    *workers;
+
+    if (!pool) { return (0); }
+    memset(pool, 0, sizeof(t_gloadContextPool));
+    if (!count || !glFenceSync || !glWaitSync || !glDeleteSync) { return (!count); }
+
+#   if !defined (GLOAD_EGL) && !defined (GLOAD_GLX)
+    if (!backend) { return (0); }
+#   endif /* GLOAD_EGL, GLOAD_GLX */
+
+    if (backend && (!backend->create || !backend->make_current)) { return (0); }
+
+    workers = (struct s_gloadContextPoolWorkers *) calloc(1, sizeof(struct s_gloadContextPoolWorkers) +
+                                                             (count - 1) * sizeof(struct s_gloadContextPoolWorker));
+    if (!workers) { return (0); }
+    gloadInternal_mutexInit(&workers->mutex);
+    gloadInternal_condInit(&workers->work);
+    gloadInternal_condInit(&workers->finished);
+    workers->queue_tail = &workers->queue;
+    pool->workers = workers;
+
+    if (backend) { workers->backend = *backend; }
+
+#   if defined (GLOAD_EGL) || defined (GLOAD_GLX)
+    else {
+        workers->backend.create = gloadContextPool_create;
+        workers->backend.make_current = gloadContextPool_makeCurrent;
+        workers->backend.destroy = gloadContextPool_destroy;
+    }
+#   endif /* GLOAD_EGL, GLOAD_GLX */
+
+    for (GLuint i = 0; i < count; i++) {
+        struct s_gloadContextPoolWorker *worker;
+
+        worker = &workers->worker[i];
+        worker->workers = workers;
+        worker->context = workers->backend.create(workers->backend.user);
+        if (!worker->context) {
+
+#   if defined (GLOAD_VERBOSE_ERROR)
+            fprintf(stderr, "gload.h: could not create a shared context for the context pool.\n");
+#   endif /* GLOAD_VERBOSE_ERROR */
+
+            gloadContextPoolDestroy(pool);
+            return (0);
+        }
+        if (!gloadInternal_threadCreate(&worker->thread, gloadContextPool_worker, worker)) {
+            if (workers->backend.destroy) { workers->backend.destroy(worker->context, workers->backend.user); }
+            gloadContextPoolDestroy(pool);
+            return (0);
+        }
+        workers->count++;
+    }
+
+    /* a worker without a current context would run its jobs on no context at all... */
+    gloadInternal_mutexLock(&workers->mutex);
+    while (workers->ready + workers->dead < workers->count) {
+        gloadInternal_condWait(&workers->finished, &workers->mutex);
+    }
+    gloadInternal_mutexUnlock(&workers->mutex);
+    if (workers->dead) {
+
+#   if defined (GLOAD_VERBOSE_ERROR)
+        fprintf(stderr, "gload.h: a context pool worker could not make its context current.\n");
+#   endif /* GLOAD_VERBOSE_ERROR */
+
+        gloadContextPoolDestroy(pool);
+        return (0);
+    }
+    return (1);
+}
+
+/* `gloadContextPoolDestroy`:
+ *
+ * Finish every submitted job, stop the worker threads and destroy their contexts.
+ *
+ * - param: `t_gloadContextPool *pool` - pool to destroy
+ * */
+GLAPI void  gloadContextPoolDestroy(t_gloadContextPool *pool) {
+    struct s_gloadContextPoolWorkers    *workers;
+
+    if (!pool) { return; }
+
+    gloadContextPool_poll(pool, 1);
+    workers = (struct s_gloadContextPoolWorkers *) pool->workers;
+    if (workers) {
+        gloadInternal_mutexLock(&workers->mutex);
+        workers->stop = 1;
+        gloadInternal_condBroadcast(&workers->work);
+        gloadInternal_mutexUnlock(&workers->mutex);
+        for (GLuint i = 0; i < workers->count; i++) {
+            gloadInternal_threadJoin(&workers->worker[i].thread);
+            if (workers->backend.destroy) { workers->backend.destroy(workers->worker[i].context, workers->backend.user); }
+        }
+        gloadInternal_condDestroy(&workers->finished);
+        gloadInternal_condDestroy(&workers->work);
+        gloadInternal_mutexDestroy(&workers->mutex);
+        free(workers);
+    }
+    memset(pool, 0, sizeof(t_gloadContextPool));
+}
+
+/* `gloadContextPoolSubmit`:
+ *
+ * Submit a job to the first idle worker thread.
+ *
+ * - param: `t_gloadContextPool *pool` - pool
+ * - param: `t_gloadContextJob job` - procedure run on a worker thread
+ * - param: `t_gloadContextJob done` - procedure called on the polling thread once the job is handed over (may be null)
+ * - param: `void *user` - user pointer passed to both procedures
+ * - return: `true` on success, `false` on failure.
+ * */
+GLAPI int   gloadContextPoolSubmit(t_gloadContextPool *pool, t_gloadContextJob job, t_gloadContextJob done, void *user) {
+    struct s_gloadContextPoolWorkers    *workers;
+    struct s_gloadContextPoolJob        *entry;
+
+    if (!pool || !job) { return (0); }
+
+    entry = (struct s_gloadContextPoolJob *) calloc(1, sizeof(struct s_gloadContextPoolJob));
+    if (!entry) { return (0); }
+    entry->job = job;
+    entry->done = done;
+    entry->user = user;
+    pool->submitted++;
+
+    workers = (struct s_gloadContextPoolWorkers *) pool->workers;
+    if (workers) {
+        gloadInternal_mutexLock(&workers->mutex);
+        *workers->queue_tail = entry;
+        workers->queue_tail = &entry->next;
+        workers->outstanding++;
+        gloadInternal_condBroadcast(&workers->work);
+        gloadInternal_mutexUnlock(&workers->mutex);
+        return (1);
+    }
+
+    /* Without workers, the job runs in the current context and needs no fence... */
+    job(user);
+    pool->inlined++;
+    entry->next = (struct s_gloadContextPoolJob *) pool->pending;
+    pool->pending = entry;
+    return (1);
+}
+
+/* `gloadContextPoolPoll`:
+ *
+ * Hand the finished jobs over to the current context and call their completion procedures, without blocking.
+ *
+ * - param: `t_gloadContextPool *pool` - pool
+ * - return: number of jobs still running.
+ * */
+GLAPI GLuint    gloadContextPoolPoll(t_gloadContextPool *pool) {
+    if (!pool) { return (0); }
+    return (gloadContextPool_poll(pool, 0));
+}
+
+/* `gloadContextPoolFinish`:
+ *
+ * Block until every submitted job is finished and handed over to the current context.
+ *
+ * - param: `t_gloadContextPool *pool` - pool
+ * */
+GLAPI void  gloadContextPoolFinish(t_gloadContextPool *pool) {
+    if (!pool) { return; }
+    gloadContextPool_poll(pool, 1);
+}
+
+#  endif /* GLOAD_CONTEXT_POOL */
+#
+#  if defined (GLOAD_STALL_DETECTOR)
+
+/* SECTION:
+ *  gload stall detector API
+ * * * * * * * * * * * * * * */
+
+#   if defined (__GNUC__) || defined (__clang__)
+#    define GLOAD_STALL_DETECTOR_CALLER __builtin_return_address(0)
+#   elif defined (_MSC_VER)
+#    define GLOAD_STALL_DETECTOR_CALLER _ReturnAddress()
+#   else
+#    define GLOAD_STALL_DETECTOR_CALLER ((void *) 0)
+#   endif /* __GNUC__, _MSC_VER */
+
+/* Number of query objects remembered as checked available, indexed by name... */
+#   define GLOAD_STALL_DETECTOR_QUERIES 64
+
+/* `struct s_gloadStallDetectorSite` - recorded call site and the hash of its name and return addresses.
+ * */
+struct s_gloadStallDetectorSite {
+    GLuint64            hash;
+    GLuint64            last_frame;
+    t_gloadStallSite    site;
+};
+
+/* `static struct s_gloadStallDetector g_stalls` - state of the stall detector.
+ * */
+static struct s_gloadStallDetector {
+    int                         init;
+    int                         armed;
+    int                         query_buffer;
+    t_gloadInternalMutex        mutex;
+    GLuint                      available[GLOAD_STALL_DETECTOR_QUERIES];
+    t_gloadStallDetectorStats   stats;
+
+    struct s_gloadStallDetectorSite sites[GLOAD_STALL_DETECTOR_MAX_SITES];
+
+    /* original procedures, kept by `gloadStallDetectorTerminate` for the hooks still called by another one */
+    PFNGLGETBOOLEANVPROC            orig_glGetBooleanv;
+    PFNGLGETINTEGERVPROC            orig_glGetIntegerv;
+    PFNGLGETINTEGER64VPROC          orig_glGetInteger64v;
+    PFNGLGETFLOATVPROC              orig_glGetFloatv;
+    PFNGLGETDOUBLEVPROC             orig_glGetDoublev;
+    PFNGLGETERRORPROC               orig_glGetError;
+    PFNGLGETBUFFERSUBDATAPROC       orig_glGetBufferSubData;
+    PFNGLGETTEXIMAGEPROC            orig_glGetTexImage;
+    PFNGLREADPIXELSPROC             orig_glReadPixels;
+    PFNGLFINISHPROC                 orig_glFinish;
+    PFNGLMAPBUFFERPROC              orig_glMapBuffer;
+    PFNGLMAPBUFFERRANGEPROC         orig_glMapBufferRange;
+    PFNGLMAPNAMEDBUFFERPROC         orig_glMapNamedBuffer;
+    PFNGLMAPNAMEDBUFFERRANGEPROC    orig_glMapNamedBufferRange;
+    PFNGLGETQUERYOBJECTIVPROC       orig_glGetQueryObjectiv;
+    PFNGLGETQUERYOBJECTUIVPROC      orig_glGetQueryObjectuiv;
+    PFNGLGETQUERYOBJECTI64VPROC     orig_glGetQueryObjecti64v;
+    PFNGLGETQUERYOBJECTUI64VPROC    orig_glGetQueryObjectui64v;
+    PFNGLCLIENTWAITSYNCPROC         orig_glClientWaitSync;
+}   g_stalls;
+
+/* `gloadStallDetector_start`:
+ *
+ * - return: start time of a synchronizing call, 0 when it's not timed.
+ * */
+static GLuint64 gloadStallDetector_start(int synchronizing) {
+    return (g_stalls.armed && synchronizing ? gloadInternal_clock() : 0);
+}
+
+/* `gloadStallDetector_record`:
+ *
+ * Add the time elapsed since `start` to the call site of `name` called from `caller`.
+ * */
+static void gloadStallDetector_record(const char *name, void *caller, GLuint64 start) {
+    struct s_gloadStallDetectorSite *entry;
+    void                            *callers[GLOAD_STALL_DETECTOR_DEPTH];
+    GLuint64                        elapsed;
+    GLuint64                        hash;
+    GLuint                          slot;
+
+    elapsed = gloadInternal_clock() - start;
+    memset(callers, 0, sizeof(callers));
+    callers[0] = caller;
+
+#   if GLOAD_STALL_DETECTOR_DEPTH > 1 && (defined (GLOAD_LINUX) || defined (GLOAD_APPLE))
+    {
+        void    *trace[GLOAD_STALL_DETECTOR_DEPTH + 4];
+        int     count;
+        int     i;
+
+        /* Skip the frames of gload itself, up to the caller of the hooked procedure... */
+        count = backtrace(trace, GLOAD_STALL_DETECTOR_DEPTH + 4);
+        for (i = 0; i < count && trace[i] != caller; i++) { }
+        for (int j = 0; j < GLOAD_STALL_DETECTOR_DEPTH && i < count; j++, i++) { callers[j] = trace[i]; }
+    }
+#   endif /* GLOAD_STALL_DETECTOR_DEPTH, GLOAD_LINUX, GLOAD_APPLE */
+
+    hash = gloadInternal_hash(0xcbf29ce484222325ull, &name, sizeof(name));
+    hash = gloadInternal_hash(hash, callers, sizeof(callers));
+
+    gloadInternal_mutexLock(&g_stalls.mutex);
+    g_stalls.stats.stalls++;
+    g_stalls.stats.total_ns += elapsed;
+
+    entry = 0;
+    slot = (GLuint) (hash % GLOAD_STALL_DETECTOR_MAX_SITES);
+    for (GLuint i = 0; i < GLOAD_STALL_DETECTOR_MAX_SITES; i++, slot = (slot + 1) % GLOAD_STALL_DETECTOR_MAX_SITES) {
+        if (!g_stalls.sites[slot].site.calls || g_stalls.sites[slot].hash == hash) {
+            entry = &g_stalls.sites[slot];
+            break;
+        }
+    }
+    if (!entry) {
+        g_stalls.stats.dropped++;
+        gloadInternal_mutexUnlock(&g_stalls.mutex);
+        return;
+    }
+
+    if (!entry->site.calls) {
+        entry->hash = hash;
+        entry->site.name = name;
+        memcpy(entry->site.callers, callers, sizeof(callers));
+        g_stalls.stats.sites++;
+    }
+    if (!entry->site.frames || entry->last_frame != g_stalls.stats.frames) {
+        entry->last_frame = g_stalls.stats.frames;
+        entry->site.frames++;
+    }
+    entry->site.calls++;
+    entry->site.total_ns += elapsed;
+    if (elapsed > entry->site.max_ns) { entry->site.max_ns = elapsed; }
+    gloadInternal_mutexUnlock(&g_stalls.mutex);
+}
+
+static void APIENTRY    gloadStallDetector_glGetBooleanv(GLenum pname, GLboolean *data) {
+    GLuint64    start;
+
+    start = gloadStallDetector_start(1);
+    g_stalls.orig_glGetBooleanv(pname, data);
+    if (start) { gloadStallDetector_record("glGetBooleanv", GLOAD_STALL_DETECTOR_CALLER, start); }
+}
+
+static void APIENTRY    gloadStallDetector_glGetIntegerv(GLenum pname, GLint *data) {
+    GLuint64    start;
+
+    start = gloadStallDetector_start(1);
+    g_stalls.orig_glGetIntegerv(pname, data);
+    if (start) { gloadStallDetector_record("glGetIntegerv", GLOAD_STALL_DETECTOR_CALLER, start); }
+}
+
+static void APIENTRY    gloadStallDetector_glGetInteger64v(GLenum pname, GLint64 *data) {
+    GLuint64    start;
+
+    start = gloadStallDetector_start(1);
+    g_stalls.orig_glGetInteger64v(pname, data);
+    if (start) { gloadStallDetector_record("glGetInteger64v", GLOAD_STALL_DETECTOR_CALLER, start); }
+}
+
+static void APIENTRY    gloadStallDetector_glGetFloatv(GLenum pname, GLfloat *data) {
+    GLuint64    start;
+
+    start = gloadStallDetector_start(1);
+    g_stalls.orig_glGetFloatv(pname, data);
+    if (start) { gloadStallDetector_record("glGetFloatv", GLOAD_STALL_DETECTOR_CALLER, start); }
+}
+
+static void APIENTRY    gloadStallDetector_glGetDoublev(GLenum pname, GLdouble *data) {
+    GLuint64    start;
+
+    start = gloadStallDetector_start(1);
+    g_stalls.orig_glGetDoublev(pname, data);
+    if (start) { gloadStallDetector_record("glGetDoublev", GLOAD_STALL_DETECTOR_CALLER, start); }
+}
+
+static GLenum APIENTRY  gloadStallDetector_glGetError(void) {
+    GLuint64    start;
+    GLenum      error;
+
+    start = gloadStallDetector_start(1);
+    error = g_stalls.orig_glGetError();
+    if (start) { gloadStallDetector_record("glGetError", GLOAD_STALL_DETECTOR_CALLER, start); }
+    return (error);
+}
+
+static void APIENTRY    gloadStallDetector_glGetBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, void *data) {
+    GLuint64    start;
+
+    start = gloadStallDetector_start(1);
+    g_stalls.orig_glGetBufferSubData(target, offset, size, data);
+    if (start) { gloadStallDetector_record("glGetBufferSubData", GLOAD_STALL_DETECTOR_CALLER, start); }
+}
+
+static void APIENTRY    gloadStallDetector_glGetTexImage(GLenum target, GLint level, GLenum format, GLenum type, void *pixels) {
+    GLuint64    start;
+    GLint       pack;
+
+    /* Into a pixel-pack buffer, the copy is queued like any other command... */
+    pack = 0;
+    if (g_stalls.armed) { g_stalls.orig_glGetIntegerv(GL_PIXEL_PACK_BUFFER_BINDING, &pack); }
+    start = gloadStallDetector_start(!pack);
+    g_stalls.orig_glGetTexImage(target, level, format, type, pixels);
+    if (start) { gloadStallDetector_record("glGetTexImage", GLOAD_STALL_DETECTOR_CALLER, start); }
+}
+
+static void APIENTRY    gloadStallDetector_glReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels) {
+    GLuint64    start;
+    GLint       pack;
+
+    pack = 0;
+    if (g_stalls.armed) { g_stalls.orig_glGetIntegerv(GL_PIXEL_PACK_BUFFER_BINDING, &pack); }
+    start = gloadStallDetector_start(!pack);
+    g_stalls.orig_glReadPixels(x, y, width, height, format, type, pixels);
+    if (start) { gloadStallDetector_record("glReadPixels", GLOAD_STALL_DETECTOR_CALLER, start); }
+}
+
+static void APIENTRY    gloadStallDetector_glFinish(void) {
+    GLuint64    start;
+
+    start = gloadStallDetector_start(1);
+    g_stalls.orig_glFinish();
+    if (start) { gloadStallDetector_record("glFinish", GLOAD_STALL_DETECTOR_CALLER, start); }
+}
+
+static void *APIENTRY   gloadStallDetector_glMapBuffer(GLenum target, GLenum access) {
+    GLuint64    start;
+    void        *mapping;
+
+    start = gloadStallDetector_start(1);
+    mapping = g_stalls.orig_glMapBuffer(target, access);
+    if (start) { gloadStallDetector_record("glMapBuffer", GLOAD_STALL_DETECTOR_CALLER, start); }
+    return (mapping);
+}
+
+static void *APIENTRY   gloadStallDetector_glMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access) {
+    GLuint64    start;
+    void        *mapping;
+
+    start = gloadStallDetector_start(!(access & GL_MAP_UNSYNCHRONIZED_BIT));
+    mapping = g_stalls.orig_glMapBufferRange(target, offset, length, access);
+    if (start) { gloadStallDetector_record("glMapBufferRange", GLOAD_STALL_DETECTOR_CALLER, start); }
+    return (mapping);
+}
+
+static void *APIENTRY   gloadStallDetector_glMapNamedBuffer(GLuint buffer, GLenum access) {
+    GLuint64    start;
+    void        *mapping;
+
+    start = gloadStallDetector_start(1);
+    mapping = g_stalls.orig_glMapNamedBuffer(buffer, access);
+    if (start) { gloadStallDetector_record("glMapNamedBuffer", GLOAD_STALL_DETECTOR_CALLER, start); }
+    return (mapping);
+}
+
+static void *APIENTRY   gloadStallDetector_glMapNamedBufferRange(GLuint buffer, GLintptr offset, GLsizeiptr length, GLbitfield access) {
+    GLuint64    start;
+    void        *mapping;
+
+    start = gloadStallDetector_start(!(access & GL_MAP_UNSYNCHRONIZED_BIT));
+    mapping = g_stalls.orig_glMapNamedBufferRange(buffer, offset, length, access);
+    if (start) { gloadStallDetector_record("glMapNamedBufferRange", GLOAD_STALL_DETECTOR_CALLER, start); }
+    return (mapping);
+}
+
+/* `gloadStallDetector_query`:
+ *
+ * Track the availability checks of query objects.
+ *
+ * - return: `true` if reading `pname` of `id` may block, `false` otherwise.
+ * */
+static int  gloadStallDetector_query(GLuint id, GLenum pname) {
+    if (pname != GL_QUERY_RESULT) { return (0); }
+    if (g_stalls.available[id % GLOAD_STALL_DETECTOR_QUERIES] == id) {
+        g_stalls.available[id % GLOAD_STALL_DETECTOR_QUERIES] = 0;
+        return (0);
+    }
+    return (1);
+}
+
+/* `gloadStallDetector_bound`:
+ *
+ * The binding is only queried within frames, so that the hooks don't add a `glGetIntegerv` to every call outside them.
+ *
+ * - return: `true` if a buffer is bound to `GL_QUERY_BUFFER`: results are written to it and `params` is an offset.
+ * */
+static int  gloadStallDetector_bound(void) {
+    GLint   buffer;
+
+    if (!g_stalls.armed || !g_stalls.query_buffer) { return (0); }
+    buffer = 0;
+    g_stalls.orig_glGetIntegerv(GL_QUERY_BUFFER_BINDING, &buffer);
+    return (buffer != 0);
+}
+
+/* `gloadStallDetector_available`:
+ *
+ * Remember the queries whose result was checked available.
+ * */
+static void gloadStallDetector_available(GLuint id, GLenum pname, GLuint64 available) {
+    if (pname == GL_QUERY_RESULT_AVAILABLE && available) { g_stalls.available[id % GLOAD_STALL_DETECTOR_QUERIES] = id; }
+}
+
+static void APIENTRY    gloadStallDetector_glGetQueryObjectiv(GLuint id, GLenum pname, GLint *params) {
+    GLuint64    start;
+
+    if (!g_stalls.armed || gloadStallDetector_bound()) {
+        g_stalls.orig_glGetQueryObjectiv(id, pname, params);
+        return;
+    }
+    start = gloadStallDetector_start(gloadStallDetector_query(id, pname));
+    g_stalls.orig_glGetQueryObjectiv(id, pname, params);
+    if (start) { gloadStallDetector_record("glGetQueryObjectiv", GLOAD_STALL_DETECTOR_CALLER, start); }
+    gloadStallDetector_available(id, pname, (GLuint64) *params);
+}
+
+static void APIENTRY    gloadStallDetector_glGetQueryObjectuiv(GLuint id, GLenum pname, GLuint *params) {
+    GLuint64    start;
+
+    if (!g_stalls.armed || gloadStallDetector_bound()) {
+        g_stalls.orig_glGetQueryObjectuiv(id, pname, params);
+        return;
+    }
+    start = gloadStallDetector_start(gloadStallDetector_query(id, pname));
+    g_stalls.orig_glGetQueryObjectuiv(id, pname, params);
+    if (start) { gloadStallDetector_record("glGetQueryObjectuiv", GLOAD_STALL_DETECTOR_CALLER, start); }
+    gloadStallDetector_available(id, pname, (GLuint64) *params);
+}
+
+static void APIENTRY    gloadStallDetector_glGetQueryObjecti64v(GLuint id, GLenum pname, GLint64 *params) {
+    GLuint64    start;
+
+    if (!g_stalls.armed || gloadStallDetector_bound()) {
+        g_stalls.orig_glGetQueryObjecti64v(id, pname, params);
+        return;
+    }
+    start = gloadStallDetector_start(gloadStallDetector_query(id, pname));
+    g_stalls.orig_glGetQueryObjecti64v(id, pname, params);
+    if (start) { gloadStallDetector_record("glGetQueryObjecti64v", GLOAD_STALL_DETECTOR_CALLER, start); }
+    gloadStallDetector_available(id, pname, (GLuint64) *params);
+}
+
+static void APIENTRY    gloadStallDetector_glGetQueryObjectui64v(GLuint id, GLenum pname, GLuint64 *params) {
+    GLuint64    start;
+
+    if (!g_stalls.armed || gloadStallDetector_bound()) {
+        g_stalls.orig_glGetQueryObjectui64v(id, pname, params);
+        return;
+    }
+    start = gloadStallDetector_start(gloadStallDetector_query(id, pname));
+    g_stalls.orig_glGetQueryObjectui64v(id, pname, params);
+    if (start) { gloadStallDetector_record("glGetQueryObjectui64v", GLOAD_STALL_DETECTOR_CALLER, start); }
+    gloadStallDetector_available(id, pname, *params);
+}
+
+static GLenum APIENTRY  gloadStallDetector_glClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+    GLuint64    start;
+    GLenum      result;
+
+    start = gloadStallDetector_start(timeout != 0);
+    result = g_stalls.orig_glClientWaitSync(sync, flags, timeout);
+    if (start) { gloadStallDetector_record("glClientWaitSync", GLOAD_STALL_DETECTOR_CALLER, start); }
+    return (result);
+}
+
+/* Swap a loaded procedure with its hook, and back only if no other hook was installed on top of it since... */
+#   define GLOAD_STALL_DETECTOR_HOOK(name) \
+    if (gload_##name && !g_stalls.orig_##name) { g_stalls.orig_##name = gload_##name, gload_##name = gloadStallDetector_##name; }
+#   define GLOAD_STALL_DETECTOR_UNHOOK(name) \
+    if (gload_##name == gloadStallDetector_##name) { gload_##name = g_stalls.orig_##name, g_stalls.orig_##name = 0; }
+
+/* `gloadStallDetectorInit`:
+ *
+ * Start hooking the synchronizing procedures. Calls are only timed within frames.
+ * NOTE:
+ *  This function requires loaded OpenGL functions.
+ *
+ * - return: `true` on success, `false` on failure.
+ * */
+GLAPI int   gloadStallDetectorInit(void) {
+    if (g_stalls.init) { return (1); }
+    if (!glGetIntegerv || !glFinish) { return (0); }
+
+    memset(&g_stalls, 0, offsetof(struct s_gloadStallDetector, orig_glGetBooleanv));
+    gloadInternal_mutexInit(&g_stalls.mutex);
+    g_stalls.query_buffer = gloadIsVersionSupported(4, 4) || gloadIsExtensionSupported("GL_ARB_query_buffer_object") ||
+                            gloadIsExtensionSupported("GL_AMD_query_buffer_object");
+    GLOAD_STALL_DETECTOR_HOOK(glGetBooleanv);
+    GLOAD_STALL_DETECTOR_HOOK(glGetIntegerv);
+    GLOAD_STALL_DETECTOR_HOOK(glGetInteger64v);
+    GLOAD_STALL_DETECTOR_HOOK(glGetFloatv);
+    GLOAD_STALL_DETECTOR_HOOK(glGetDoublev);
+    GLOAD_STALL_DETECTOR_HOOK(glGetError);
+    GLOAD_STALL_DETECTOR_HOOK(glGetBufferSubData);
+    GLOAD_STALL_DETECTOR_HOOK(glGetTexImage);
+    GLOAD_STALL_DETECTOR_HOOK(glReadPixels);
+    GLOAD_STALL_DETECTOR_HOOK(glFinish);
+    GLOAD_STALL_DETECTOR_HOOK(glMapBuffer);
+    GLOAD_STALL_DETECTOR_HOOK(glMapBufferRange);
+    GLOAD_STALL_DETECTOR_HOOK(glMapNamedBuffer);
+    GLOAD_STALL_DETECTOR_HOOK(glMapNamedBufferRange);
+    GLOAD_STALL_DETECTOR_HOOK(glGetQueryObjectiv);
+    GLOAD_STALL_DETECTOR_HOOK(glGetQueryObjectuiv);
+    GLOAD_STALL_DETECTOR_HOOK(glGetQueryObjecti64v);
+    GLOAD_STALL_DETECTOR_HOOK(glGetQueryObjectui64v);
+    GLOAD_STALL_DETECTOR_HOOK(glClientWaitSync);
+    g_stalls.init = 1;
+    return (1);
+}
+
+/* `gloadStallDetectorTerminate`:
+ *
+ * Restore the original procedures and discard the recorded call sites.
+ * Hooks another one was installed on top of stay in place, and forward every call untimed.
+ * */
+GLAPI void  gloadStallDetectorTerminate(void) {
+    if (!g_stalls.init) { return; }
+
+    GLOAD_STALL_DETECTOR_UNHOOK(glGetBooleanv);
+    GLOAD_STALL_DETECTOR_UNHOOK(glGetIntegerv);
+    GLOAD_STALL_DETECTOR_UNHOOK(glGetInteger64v);
+    GLOAD_STALL_DETECTOR_UNHOOK(glGetFloatv);
+    GLOAD_STALL_DETECTOR_UNHOOK(glGetDoublev);
+    GLOAD_STALL_DETECTOR_UNHOOK(glGetError);
+    GLOAD_STALL_DETECTOR_UNHOOK(glGetBufferSubData);
+    GLOAD_STALL_DETECTOR_UNHOOK(glGetTexImage);
+    GLOAD_STALL_DETECTOR_UNHOOK(glReadPixels);
+    GLOAD_STALL_DETECTOR_UNHOOK(glFinish);
+    GLOAD_STALL_DETECTOR_UNHOOK(glMapBuffer);
+    GLOAD_STALL_DETECTOR_UNHOOK(glMapBufferRange);
+    GLOAD_STALL_DETECTOR_UNHOOK(glMapNamedBuffer);
+    GLOAD_STALL_DETECTOR_UNHOOK(glMapNamedBufferRange);
+    GLOAD_STALL_DETECTOR_UNHOOK(glGetQueryObjectiv);
+    GLOAD_STALL_DETECTOR_UNHOOK(glGetQueryObjectuiv);
+    GLOAD_STALL_DETECTOR_UNHOOK(glGetQueryObjecti64v);
+    GLOAD_STALL_DETECTOR_UNHOOK(glGetQueryObjectui64v);
+    GLOAD_STALL_DETECTOR_UNHOOK(glClientWaitSync);
+    gloadInternal_mutexDestroy(&g_stalls.mutex);
+    memset(&g_stalls, 0, offsetof(struct s_gloadStallDetector, orig_glGetBooleanv));
+}
+
+/* `gloadStallDetectorBeginFrame`:
+ *
+ * Start timing the synchronizing calls, i.e. once the previous frame was submitted.
+ * */
+GLAPI void  gloadStallDetectorBeginFrame(void) {
+    if (!g_stalls.init) { return; }
+    g_stalls.armed = 1;
+}
+
+/* `gloadStallDetectorEndFrame`:
+ *
+ * Stop timing the synchronizing calls, i.e. right before swapping buffers.
+ * */
+GLAPI void  gloadStallDetectorEndFrame(void) {
+    if (!g_stalls.init || !g_stalls.armed) { return; }
+
+    gloadInternal_mutexLock(&g_stalls.mutex);
+    g_stalls.armed = 0;
+    g_stalls.stats.frames++;
+    gloadInternal_mutexUnlock(&g_stalls.mutex);
+}
+
+/* `gloadStallDetectorGetSites`:
+ *
+ * Copy the recorded call sites that blocked the longest, in decreasing order of total time.
+ *
+ * - param: `t_gloadStallSite *sites` - array receiving the call sites
+ * - param: `GLuint count` - size of `sites`
+ * - return: number of call sites copied.
+ * */
+GLAPI GLuint    gloadStallDetectorGetSites(t_gloadStallSite *sites, GLuint count) {
+    GLuint  copied;
+
+    if (!g_stalls.init || !sites || !count) { return (0); }
+
+    /* Insertion into the sorted output, which only ever holds the longest `count` sites... */
+    copied = 0;
+    gloadInternal_mutexLock(&g_stalls.mutex);
+    for (GLuint i = 0; i < GLOAD_STALL_DETECTOR_MAX_SITES; i++) {
+        const t_gloadStallSite  *site;
+        GLuint                  j;
+
+        site = &g_stalls.sites[i].site;
+        if (!site->calls) { continue; }
+        if (copied == count && site->total_ns <= sites[count - 1].total_ns) { continue; }
+
+        j = copied < count ? copied++ : count - 1;
+        for (; j > 0 && sites[j - 1].total_ns < site->total_ns; j--) { sites[j] = sites[j - 1]; }
+        sites[j] = *site;
+    }
+    gloadInternal_mutexUnlock(&g_stalls.mutex);
+    return (copied);
+}
+
+/* `gloadStallDetectorGetStats`:
+ *
+ * - param: `t_gloadStallDetectorStats *stats` - statistics of the stall detector
+ * */
+GLAPI void  gloadStallDetectorGetStats(t_gloadStallDetectorStats *stats) {
+    if (!stats) { return; }
+    if (!g_stalls.init) {
+        memset(stats, 0, sizeof(t_gloadStallDetectorStats));
+        return;
+    }
+
+    gloadInternal_mutexLock(&g_stalls.mutex);
+    *stats = g_stalls.stats;
+    gloadInternal_mutexUnlock(&g_stalls.mutex);
+}
+
+/* `gloadStallDetectorReset`:
+ *
+ * Discard the recorded call sites and statistics.
+ * */
+GLAPI void  gloadStallDetectorReset(void) {
+    if (!g_stalls.init) { return; }
+
+    gloadInternal_mutexLock(&g_stalls.mutex);
+    memset(g_stalls.sites, 0, sizeof(g_stalls.sites));
+    memset(g_stalls.available, 0, sizeof(g_stalls.available));
+    memset(&g_stalls.stats, 0, sizeof(g_stalls.stats));
+    gloadInternal_mutexUnlock(&g_stalls.mutex);
+}
+
+#   undef GLOAD_STALL_DETECTOR_UNHOOK
+#   undef GLOAD_STALL_DETECTOR_HOOK
+#   undef GLOAD_STALL_DETECTOR_QUERIES
+#   undef GLOAD_STALL_DETECTOR_CALLER
+#  endif /* GLOAD_STALL_DETECTOR */
+#
+#  if defined (GLOAD_MEMORY_STATS)
+
+/* SECTION:
+ *  gload memory statistics API
+ * * * * * * * * * * * * * * * * */
+
+/* Number of mipmap levels tracked per texture... */
+#   define GLOAD_MEMORY_STATS_LEVELS 16
+
+/* `struct s_gloadMemFormat` - block size of an internal format, in texels, and its size in bytes.
+ * */
+struct s_gloadMemFormat {
+    GLenum  format;
+    GLubyte block_width;
+    GLubyte block_height;
+    GLubyte block_bytes;
+};
+
+/* `static const struct s_gloadMemFormat g_memory_formats[]` - internal formats, sorted by value.
+ * */
+static const struct s_gloadMemFormat    g_memory_formats[] = {
+/* <<gload-formats>> */
+};
+
+/* `static const GLenum g_memory_buffer_bindings[][2]` - buffer targets and their binding.
+ * */
+static const GLenum g_memory_buffer_bindings[][2] = {
+    { GL_ARRAY_BUFFER,              GL_ARRAY_BUFFER_BINDING },
+    { GL_ELEMENT_ARRAY_BUFFER,      GL_ELEMENT_ARRAY_BUFFER_BINDING },
+    { GL_UNIFORM_BUFFER,            GL_UNIFORM_BUFFER_BINDING },
+    { GL_SHADER_STORAGE_BUFFER,     GL_SHADER_STORAGE_BUFFER_BINDING },
+    { GL_COPY_READ_BUFFER,          GL_COPY_READ_BUFFER_BINDING },
+    { GL_COPY_WRITE_BUFFER,         GL_COPY_WRITE_BUFFER_BINDING },
+    { GL_PIXEL_PACK_BUFFER,         GL_PIXEL_PACK_BUFFER_BINDING },
+    { GL_PIXEL_UNPACK_BUFFER,       GL_PIXEL_UNPACK_BUFFER_BINDING },
+    { GL_DRAW_INDIRECT_BUFFER,      GL_DRAW_INDIRECT_BUFFER_BINDING },
+    { GL_DISPATCH_INDIRECT_BUFFER,  GL_DISPATCH_INDIRECT_BUFFER_BINDING },
+    { GL_TEXTURE_BUFFER,            GL_TEXTURE_BUFFER_BINDING },
+    { GL_TRANSFORM_FEEDBACK_BUFFER, GL_TRANSFORM_FEEDBACK_BUFFER_BINDING },
+    { GL_ATOMIC_COUNTER_BUFFER,     GL_ATOMIC_COUNTER_BUFFER_BINDING },
+    { GL_QUERY_BUFFER,              GL_QUERY_BUFFER_BINDING },
+};
+
+/* `static const GLenum g_memory_texture_bindings[][2]` - texture targets and their binding.
+ * */
+static const GLenum g_memory_texture_bindings[][2] = {
+    { GL_TEXTURE_1D,                    GL_TEXTURE_BINDING_1D },
+    { GL_TEXTURE_2D,                    GL_TEXTURE_BINDING_2D },
+    { GL_TEXTURE_3D,                    GL_TEXTURE_BINDING_3D },
+    { GL_TEXTURE_1D_ARRAY,              GL_TEXTURE_BINDING_1D_ARRAY },
+    { GL_TEXTURE_2D_ARRAY,              GL_TEXTURE_BINDING_2D_ARRAY },
+    { GL_TEXTURE_RECTANGLE,             GL_TEXTURE_BINDING_RECTANGLE },
+    { GL_TEXTURE_CUBE_MAP,              GL_TEXTURE_BINDING_CUBE_MAP },
+    { GL_TEXTURE_CUBE_MAP_ARRAY,        GL_TEXTURE_BINDING_CUBE_MAP_ARRAY },
+    { GL_TEXTURE_2D_MULTISAMPLE,        GL_TEXTURE_BINDING_2D_MULTISAMPLE },
+    { GL_TEXTURE_2D_MULTISAMPLE_ARRAY,  GL_TEXTURE_BINDING_2D_MULTISAMPLE_ARRAY },
+};
+
+/* Number of texture units whose bindings are followed; the bindings of the other units are queried... */
+#   define GLOAD_MEMORY_STATS_UNITS 32
+
+/* `struct s_gloadMemBindings` - objects bound on the calling thread, followed through the hooked `glBind*` procedures.
+ * Units and names are stored plus one: 0 stands for a binding not known yet, queried once on its first use.
+ * */
+struct s_gloadMemBindings {
+    GLuint  epoch;
+    GLuint  unit;
+    GLuint  renderbuffer;
+    GLuint  buffers[sizeof(g_memory_buffer_bindings) / sizeof(g_memory_buffer_bindings[0])];
+    GLuint  textures[GLOAD_MEMORY_STATS_UNITS][sizeof(g_memory_texture_bindings) / sizeof(g_memory_texture_bindings[0])];
+};
+
+/* `g_memory_bindings`, `g_memory_epoch` - bindings of the calling thread, and the `gloadMemStatsInit` they were followed since.
+ * */
+static GLOAD_INTERNAL_TLS struct s_gloadMemBindings g_memory_bindings;
+static GLuint                                       g_memory_epoch;
+
+/* `struct s_gloadMemTexture` - tracked texture: bytes of a single face of each level, and the faces specified.
+ * */
+struct s_gloadMemTexture {
+    GLuint64    levels[GLOAD_MEMORY_STATS_LEVELS];
+    GLubyte     faces[GLOAD_MEMORY_STATS_LEVELS];
+};
+
+/* `struct s_gloadMemObjects` - bytes of the tracked objects of a type, indexed by name.
+ * */
+struct s_gloadMemObjects {
+    GLuint64    *bytes;
+    GLuint      size;
+    GLuint64    total;
+    GLuint      count;
+};
+
+/* `static struct s_gloadMemory g_memory` - state of the memory statistics.
+ * */
+static struct s_gloadMemory {
+    int                         init;
+    int                         nvx;
+    int                         ati;
+    t_gloadInternalMutex        mutex;
+    struct s_gloadMemObjects    buffers;
+    struct s_gloadMemObjects    textures;
+    struct s_gloadMemObjects    renderbuffers;
+    struct s_gloadMemTexture    *levels;
+    GLuint64                    peak;
+    GLuint                      untracked;
+
+    /* original procedures, kept by `gloadMemStatsTerminate` for the hooks still called by another one */
+    PFNGLBUFFERDATAPROC                         orig_glBufferData;
+    PFNGLBUFFERSTORAGEPROC                      orig_glBufferStorage;
+    PFNGLNAMEDBUFFERDATAPROC                    orig_glNamedBufferData;
+    PFNGLNAMEDBUFFERSTORAGEPROC                 orig_glNamedBufferStorage;
+    PFNGLDELETEBUFFERSPROC                      orig_glDeleteBuffers;
+    PFNGLTEXIMAGE1DPROC                         orig_glTexImage1D;
+    PFNGLTEXIMAGE2DPROC                         orig_glTexImage2D;
+    PFNGLTEXIMAGE3DPROC                         orig_glTexImage3D;
+    PFNGLTEXIMAGE2DMULTISAMPLEPROC              orig_glTexImage2DMultisample;
+    PFNGLTEXIMAGE3DMULTISAMPLEPROC              orig_glTexImage3DMultisample;
+    PFNGLCOMPRESSEDTEXIMAGE1DPROC               orig_glCompressedTexImage1D;
+    PFNGLCOMPRESSEDTEXIMAGE2DPROC               orig_glCompressedTexImage2D;
+    PFNGLCOMPRESSEDTEXIMAGE3DPROC               orig_glCompressedTexImage3D;
+    PFNGLTEXSTORAGE1DPROC                       orig_glTexStorage1D;
+    PFNGLTEXSTORAGE2DPROC                       orig_glTexStorage2D;
+    PFNGLTEXSTORAGE3DPROC                       orig_glTexStorage3D;
+    PFNGLTEXSTORAGE2DMULTISAMPLEPROC            orig_glTexStorage2DMultisample;
+    PFNGLTEXSTORAGE3DMULTISAMPLEPROC            orig_glTexStorage3DMultisample;
+    PFNGLTEXTURESTORAGE1DPROC                   orig_glTextureStorage1D;
+    PFNGLTEXTURESTORAGE2DPROC                   orig_glTextureStorage2D;
+    PFNGLTEXTURESTORAGE3DPROC                   orig_glTextureStorage3D;
+    PFNGLTEXTURESTORAGE2DMULTISAMPLEPROC        orig_glTextureStorage2DMultisample;
+    PFNGLTEXTURESTORAGE3DMULTISAMPLEPROC        orig_glTextureStorage3DMultisample;
+    PFNGLDELETETEXTURESPROC                     orig_glDeleteTextures;
+    PFNGLRENDERBUFFERSTORAGEPROC                orig_glRenderbufferStorage;
+    PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC     orig_glRenderbufferStorageMultisample;
+    PFNGLNAMEDRENDERBUFFERSTORAGEPROC           orig_glNamedRenderbufferStorage;
+    PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC orig_glNamedRenderbufferStorageMultisample;
+    PFNGLDELETERENDERBUFFERSPROC                orig_glDeleteRenderbuffers;
+    PFNGLBINDBUFFERPROC                         orig_glBindBuffer;
+    PFNGLBINDBUFFERBASEPROC                     orig_glBindBufferBase;
+    PFNGLBINDBUFFERRANGEPROC                    orig_glBindBufferRange;
+    PFNGLACTIVETEXTUREPROC                      orig_glActiveTexture;
+    PFNGLBINDTEXTUREPROC                        orig_glBindTexture;
+    PFNGLBINDTEXTUREUNITPROC                    orig_glBindTextureUnit;
+    PFNGLBINDTEXTURESPROC                       orig_glBindTextures;
+    PFNGLBINDRENDERBUFFERPROC                   orig_glBindRenderbuffer;
+    PFNGLBINDVERTEXARRAYPROC                    orig_glBindVertexArray;
+    PFNGLDELETEVERTEXARRAYSPROC                 orig_glDeleteVertexArrays;
+    PFNGLPOPATTRIBPROC                          orig_glPopAttrib;
+    PFNGLPOPCLIENTATTRIBPROC                    orig_glPopClientAttrib;
+}   g_memory;
+
+/* `gloadMemStats_grow`:
+ *
+ * Grow the tracked objects of a type to hold `name`, and the texture levels with them.
+ *
+ * - return: `true` on success, `false` if `name` can't be tracked.
+ * */
+static int  gloadMemStats_grow(struct s_gloadMemObjects *objects, GLuint name) {
+    GLuint64    *bytes;
+    GLuint      size;
+
+    if (name < objects->size) { return (1); }
+    if (name >= GLOAD_MEMORY_STATS_MAX_NAMES) { return (0); }
+
+    size = objects->size ? objects->size : 256;
+    while (size <= name) { size *= 2; }
+    if (size > GLOAD_MEMORY_STATS_MAX_NAMES) { size = GLOAD_MEMORY_STATS_MAX_NAMES; }
+    bytes = (GLuint64 *) realloc(objects->bytes, size * sizeof(GLuint64));
+    if (!bytes) { return (0); }
+    memset(bytes + objects->size, 0, (size - objects->size) * sizeof(GLuint64));
+    objects->bytes = bytes;
+    if (objects == &g_memory.textures) {
+        struct s_gloadMemTexture    *levels;
+
+        levels = (struct s_gloadMemTexture *) realloc(g_memory.levels, size * sizeof(struct s_gloadMemTexture));
+        if (!levels) { return (0); }
+        memset(levels + objects->size, 0, (size - objects->size) * sizeof(struct s_gloadMemTexture));
+        g_memory.levels = levels;
+    }
+    objects->size = size;
+    return (1);
+}
+
+/* `gloadMemStats_set`:
+ *
+ * Set the bytes of an object, with the lock held. Null bytes release the object.
+ * */
+static void gloadMemStats_set(struct s_gloadMemObjects *objects, GLuint name, GLuint64 bytes) {
+    GLuint64    total;
+    GLuint64    old;
+
+    if (!name || !gloadMemStats_grow(objects, name)) {
+        if (bytes) { g_memory.untracked++; }
+        return;
+    }
+
+    old = objects->bytes[name];
+    objects->bytes[name] = bytes;
+    objects->total = objects->total - old + bytes;
+    objects->count = objects->count - (old != 0) + (bytes != 0);
+
+    total = g_memory.buffers.total + g_memory.textures.total + g_memory.renderbuffers.total;
+    if (total > g_memory.peak) { g_memory.peak = total; }
+}
+
+/* `gloadMemStats_release`:
+ *
+ * Release the deleted objects of a type.
+ * */
+static void gloadMemStats_release(struct s_gloadMemObjects *objects, GLsizei n, const GLuint *names) {
+    if (!g_memory.init || n <= 0 || !names) { return; }
+
+    gloadInternal_mutexLock(&g_memory.mutex);
+    for (GLsizei i = 0; i < n; i++) {
+        if (names[i] >= objects->size) { continue; }
+        gloadMemStats_set(objects, names[i], 0);
+        if (objects == &g_memory.textures) { memset(&g_memory.levels[names[i]], 0, sizeof(struct s_gloadMemTexture)); }
+    }
+    gloadInternal_mutexUnlock(&g_memory.mutex);
+}
+
+/* `gloadMemStats_format`:
+ *
+ * - return: size of the blocks of the internal format `format`, null for unknown formats.
+ * */
+static const struct s_gloadMemFormat    *gloadMemStats_format(GLenum format) {
+    GLuint  low;
+    GLuint  high;
+
+    low = 0;
+    high = sizeof(g_memory_formats) / sizeof(g_memory_formats[0]);
+    while (low < high) {
+        GLuint  mid;
+
+        mid = (low + high) / 2;
+        if (g_memory_formats[mid].format == format) { return (&g_memory_formats[mid]); }
+        if (g_memory_formats[mid].format < format) { low = mid + 1; }
+        else { high = mid; }
+    }
+    return (0);
+}
+
+/* `gloadMemStats_unknown`:
+ *
+ * Count an allocation of an unknown internal format (0 for compressed images, whose size is given), with the lock held.
+ * */
+static void gloadMemStats_unknown(GLenum format, GLuint64 bytes) {
+    if (format && bytes && !gloadMemStats_format(format)) { g_memory.untracked++; }
+}
+
+/* `gloadMemStats_imageSize`:
+ *
+ * - return: bytes of an image of the internal format `format`, 4 bytes per texel for unknown formats.
+ * */
+static GLuint64 gloadMemStats_imageSize(GLenum format, GLsizei width, GLsizei height, GLsizei depth) {
+    const struct s_gloadMemFormat   *entry;
+
+    if (width <= 0 || height <= 0 || depth <= 0) { return (0); }
+
+    entry = gloadMemStats_format(format);
+    if (!entry) { return ((GLuint64) width * (GLuint64) height * (GLuint64) depth * 4); }
+    return ((GLuint64) ((width + entry->block_width - 1) / entry->block_width)
+        * (GLuint64) ((height + entry->block_height - 1) / entry->block_height)
+        * (GLuint64) depth * entry->block_bytes);
+}
+
+/* `gloadMemStats_storageSize`:
+ *
+ * - return: bytes of all the levels of an immutable texture storage.
+ * */
+static GLuint64 gloadMemStats_storageSize(GLenum target, GLsizei levels, GLenum format, GLsizei width, GLsizei height, GLsizei depth) {
+    GLuint64    bytes;
+
+    bytes = 0;
+    for (GLsizei i = 0; i < levels; i++) {
+        bytes += gloadMemStats_imageSize(format, width, height, depth);
+        width = width > 1 ? width / 2 : 1;
+        if (target != GL_TEXTURE_1D_ARRAY) { height = height > 1 ? height / 2 : 1; }
+        if (target == GL_TEXTURE_3D) { depth = depth > 1 ? depth / 2 : 1; }
+    }
+    return (target == GL_TEXTURE_CUBE_MAP ? bytes * 6 : bytes);
+}
+
+/* `gloadMemStats_bindings`:
+ *
+ * - return: bindings of the calling thread, forgotten if they were followed before the last `gloadMemStatsInit`.
+ * */
+static struct s_gloadMemBindings    *gloadMemStats_bindings(void) {
+    if (g_memory_bindings.epoch != g_memory_epoch) {
+        memset(&g_memory_bindings, 0, sizeof(struct s_gloadMemBindings));
+        g_memory_bindings.epoch = g_memory_epoch;
+    }
+    return (&g_memory_bindings);
+}
+
+/* `gloadMemStats_bound`:
+ *
+ * Look a binding up, and query it if it isn't known yet.
+ *
+ * - param: `GLuint *binding` - followed binding, stored plus one
+ * - param: `GLenum pname` - state to query it with
+ * - return: bound object.
+ * */
+static GLuint   gloadMemStats_bound(GLuint *binding, GLenum pname) {
+    GLint   name;
+
+    if (!*binding) {
+        name = 0;
+        glGetIntegerv(pname, &name);
+        *binding = (GLuint) name + 1;
+    }
+    return (*binding - 1);
+}
+
+/* `gloadMemStats_forget`:
+ *
+ * Reset the followed bindings of deleted objects to 0, as deleting a bound object does.
+ * */
+static void gloadMemStats_forget(GLuint *bindings, GLuint count, GLsizei n, const GLuint *names) {
+    if (n <= 0 || !names) { return; }
+
+    for (GLsizei i = 0; i < n; i++) {
+        for (GLuint j = 0; names[i] && j < count; j++) {
+            if (bindings[j] == names[i] + 1) { bindings[j] = 1; }
+        }
+    }
+}
+
+/* `gloadMemStats_bufferIndex`:
+ *
+ * - return: index of `target` in `g_memory_buffer_bindings`, -1 for unknown targets.
+ * */
+static int  gloadMemStats_bufferIndex(GLenum target) {
+    for (GLuint i = 0; i < sizeof(g_memory_buffer_bindings) / sizeof(g_memory_buffer_bindings[0]); i++) {
+        if (g_memory_buffer_bindings[i][0] == target) { return ((int) i); }
+    }
+    return (-1);
+}
+
+/* `gloadMemStats_textureIndex`:
+ *
+ * - return: index of `target` in `g_memory_texture_bindings`, -1 for unknown and proxy targets.
+ * */
+static int  gloadMemStats_textureIndex(GLenum target) {
+    for (GLuint i = 0; i < sizeof(g_memory_texture_bindings) / sizeof(g_memory_texture_bindings[0]); i++) {
+        if (g_memory_texture_bindings[i][0] == target) { return ((int) i); }
+    }
+    return (-1);
+}
+
+/* `gloadMemStats_unit`:
+ *
+ * - return: active texture unit of the calling thread, from 0.
+ * */
+static GLuint   gloadMemStats_unit(struct s_gloadMemBindings *bindings) {
+    GLint   unit;
+
+    if (!bindings->unit) {
+        unit = GL_TEXTURE0;
+        glGetIntegerv(GL_ACTIVE_TEXTURE, &unit);
+        bindings->unit = (GLuint) unit - GL_TEXTURE0 + 1;
+    }
+    return (bindings->unit - 1);
+}
+
+/* `gloadMemStats_buffer`:
+ *
+ * - return: buffer bound to `target`, 0 for unknown targets.
+ * */
+static GLuint   gloadMemStats_buffer(GLenum target) {
+    int index;
+
+    index = gloadMemStats_bufferIndex(target);
+    if (index < 0) { return (0); }
+    return (gloadMemStats_bound(&gloadMemStats_bindings()->buffers[index], g_memory_buffer_bindings[index][1]));
+}
+
+/* `gloadMemStats_texture`:
+ *
+ * - param: `GLuint *face` - receives the cube map face of `target`, 0 for other targets
+ * - return: texture bound to `target`, 0 for unknown and proxy targets.
+ * */
+static GLuint   gloadMemStats_texture(GLenum target, GLuint *face) {
+    struct s_gloadMemBindings   *bindings;
+    GLuint                      unit;
+    GLuint                      name;
+    int                         index;
+
+    *face = 0;
+    if (target >= GL_TEXTURE_CUBE_MAP_POSITIVE_X && target <= GL_TEXTURE_CUBE_MAP_NEGATIVE_Z) {
+        *face = target - GL_TEXTURE_CUBE_MAP_POSITIVE_X;
+        target = GL_TEXTURE_CUBE_MAP;
+    }
+    index = gloadMemStats_textureIndex(target);
+    if (index < 0) { return (0); }
+
+    bindings = gloadMemStats_bindings();
+    unit = gloadMemStats_unit(bindings);
+    if (unit < GLOAD_MEMORY_STATS_UNITS) { return (gloadMemStats_bound(&bindings->textures[unit][index], g_memory_texture_bindings[index][1])); }
+    name = 0;
+    return (gloadMemStats_bound(&name, g_memory_texture_bindings[index][1]));
+}
+
+/* `gloadMemStats_image`:
+ *
+ * Record a mutable texture image of the internal format `format` specified on `target`.
+ * */
+static void gloadMemStats_image(GLenum target, GLint level, GLenum format, GLuint64 bytes) {
+    struct s_gloadMemTexture    *texture;
+    GLuint64                    total;
+    GLuint                      name;
+    GLuint                      face;
+
+    if (!g_memory.init) { return; }
+    name = gloadMemStats_texture(target, &face);
+    if (!name) { return; }
+
+    gloadInternal_mutexLock(&g_memory.mutex);
+    gloadMemStats_unknown(format, bytes);
+    if (level < 0 || level >= GLOAD_MEMORY_STATS_LEVELS || !gloadMemStats_grow(&g_memory.textures, name)) {
+        if (bytes) { g_memory.untracked++; }
+        gloadInternal_mutexUnlock(&g_memory.mutex);
+        return;
+    }
+
+    /* faces of a level share their size, as a complete cube map requires... */
+    texture = &g_memory.levels[name];
+    texture->levels[level] = bytes;
+    if (bytes) { texture->faces[level] |= (GLubyte) (1 << face); }
+    else { texture->faces[level] &= (GLubyte) ~(1 << face); }
+
+    total = 0;
+    for (GLuint i = 0; i < GLOAD_MEMORY_STATS_LEVELS; i++) {
+        for (GLubyte faces = texture->faces[i]; faces; faces &= (GLubyte) (faces - 1)) { total += texture->levels[i]; }
+    }
+    gloadMemStats_set(&g_memory.textures, name, total);
+    gloadInternal_mutexUnlock(&g_memory.mutex);
+}
+
+/* `gloadMemStats_storage`:
+ *
+ * Record the immutable storage of a texture of the internal format `format`.
+ * */
+static void gloadMemStats_storage(GLuint name, GLenum format, GLuint64 bytes) {
+    if (!g_memory.init) { return; }
+
+    gloadInternal_mutexLock(&g_memory.mutex);
+    gloadMemStats_unknown(format, bytes);
+    gloadMemStats_set(&g_memory.textures, name, bytes);
+    if (name && name < g_memory.textures.size) {
+        memset(&g_memory.levels[name], 0, sizeof(struct s_gloadMemTexture));
+        g_memory.levels[name].levels[0] = bytes;
+        g_memory.levels[name].faces[0] = 1;
+    }
+    gloadInternal_mutexUnlock(&g_memory.mutex);
+}
+
+/* `gloadMemStats_target`:
+ *
+ * - return: target of a texture created with `glCreateTextures`, `GL_TEXTURE_2D` when it can't be queried.
+ * */
+static GLenum   gloadMemStats_target(GLuint texture) {
+    GLint   target;
+
+    target = GL_TEXTURE_2D;
+    if (glGetTextureParameteriv) { glGetTextureParameteriv(texture, GL_TEXTURE_TARGET, &target); }
+    return ((GLenum) target);
+}
+
+/* `gloadMemStats_record`:
+ *
+ * Record the bytes of a buffer or a renderbuffer.
+ * */
+static void gloadMemStats_record(struct s_gloadMemObjects *objects, GLuint name, GLuint64 bytes) {
+    if (!g_memory.init) { return; }
+
+    gloadInternal_mutexLock(&g_memory.mutex);
+    gloadMemStats_set(objects, name, bytes);
+    gloadInternal_mutexUnlock(&g_memory.mutex);
+}
+
+static void APIENTRY    gloadMemStats_glBufferData(GLenum target, GLsizeiptr size, const void *data, GLenum usage) {
+    g_memory.orig_glBufferData(target, size, data, usage);
+    if (g_memory.init) { gloadMemStats_record(&g_memory.buffers, gloadMemStats_buffer(target), (GLuint64) size); }
+}
+
+static void APIENTRY    gloadMemStats_glBufferStorage(GLenum target, GLsizeiptr size, const void *data, GLbitfield flags) {
+    g_memory.orig_glBufferStorage(target, size, data, flags);
+    if (g_memory.init) { gloadMemStats_record(&g_memory.buffers, gloadMemStats_buffer(target), (GLuint64) size); }
+}
+
+static void APIENTRY    gloadMemStats_glNamedBufferData(GLuint buffer, GLsizeiptr size, const void *data, GLenum usage) {
+    g_memory.orig_glNamedBufferData(buffer, size, data, usage);
+    gloadMemStats_record(&g_memory.buffers, buffer, (GLuint64) size);
+}
+
+static void APIENTRY    gloadMemStats_glNamedBufferStorage(GLuint buffer, GLsizeiptr size, const void *data, GLbitfield flags) {
+    g_memory.orig_glNamedBufferStorage(buffer, size, data, flags);
+    gloadMemStats_record(&g_memory.buffers, buffer, (GLuint64) size);
+}
+
+static void APIENTRY    gloadMemStats_glDeleteBuffers(GLsizei n, const GLuint *buffers) {
+    struct s_gloadMemBindings   *bindings;
+
+    gloadMemStats_release(&g_memory.buffers, n, buffers);
+    g_memory.orig_glDeleteBuffers(n, buffers);
+    bindings = gloadMemStats_bindings();
+    gloadMemStats_forget(bindings->buffers, sizeof(bindings->buffers) / sizeof(GLuint), n, buffers);
+}
+
+static void APIENTRY    gloadMemStats_glTexImage1D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void *pixels) {
+    g_memory.orig_glTexImage1D(target, level, internalformat, width, border, format, type, pixels);
+    gloadMemStats_image(target, level, (GLenum) internalformat, gloadMemStats_imageSize((GLenum) internalformat, width, 1, 1));
+}
+
+static void APIENTRY    gloadMemStats_glTexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels) {
+    g_memory.orig_glTexImage2D(target, level, internalformat, width, height, border, format, type, pixels);
+    gloadMemStats_image(target, level, (GLenum) internalformat, gloadMemStats_imageSize((GLenum) internalformat, width, height, 1));
+}
+
+static void APIENTRY    gloadMemStats_glTexImage3D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels) {
+    g_memory.orig_glTexImage3D(target, level, internalformat, width, height, depth, border, format, type, pixels);
+    gloadMemStats_image(target, level, (GLenum) internalformat, gloadMemStats_imageSize((GLenum) internalformat, width, height, depth));
+}
+
+static void APIENTRY    gloadMemStats_glTexImage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) {
+    g_memory.orig_glTexImage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
+    gloadMemStats_image(target, 0, internalformat, gloadMemStats_imageSize(internalformat, width, height, 1) * (GLuint64) (samples > 1 ? samples : 1));
+}
+
+static void APIENTRY    gloadMemStats_glTexImage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) {
+    g_memory.orig_glTexImage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+    gloadMemStats_image(target, 0, internalformat, gloadMemStats_imageSize(internalformat, width, height, depth) * (GLuint64) (samples > 1 ? samples : 1));
+}
+
+static void APIENTRY    gloadMemStats_glCompressedTexImage1D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *data) {
+    g_memory.orig_glCompressedTexImage1D(target, level, internalformat, width, border, imageSize, data);
+    gloadMemStats_image(target, level, 0, (GLuint64) (imageSize > 0 ? imageSize : 0));
+}
+
+static void APIENTRY    gloadMemStats_glCompressedTexImage2D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data) {
+    g_memory.orig_glCompressedTexImage2D(target, level, internalformat, width, height, border, imageSize, data);
+    gloadMemStats_image(target, level, 0, (GLuint64) (imageSize > 0 ? imageSize : 0));
+}
+
+static void APIENTRY    gloadMemStats_glCompressedTexImage3D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *data) {
+    g_memory.orig_glCompressedTexImage3D(target, level, internalformat, width, height, depth, border, imageSize, data);
+    gloadMemStats_image(target, level, 0, (GLuint64) (imageSize > 0 ? imageSize : 0));
+}
+
+static void APIENTRY    gloadMemStats_glTexStorage1D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width) {
+    GLuint  face;
+
+    g_memory.orig_glTexStorage1D(target, levels, internalformat, width);
+    if (g_memory.init) { gloadMemStats_storage(gloadMemStats_texture(target, &face), internalformat, gloadMemStats_storageSize(target, levels, internalformat, width, 1, 1)); }
+}
+
+static void APIENTRY    gloadMemStats_glTexStorage2D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height) {
+    GLuint  face;
+
+    g_memory.orig_glTexStorage2D(target, levels, internalformat, width, height);
+    if (g_memory.init) { gloadMemStats_storage(gloadMemStats_texture(target, &face), internalformat, gloadMemStats_storageSize(target, levels, internalformat, width, height, 1)); }
+}
+
+static void APIENTRY    gloadMemStats_glTexStorage3D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth) {
+    GLuint  face;
+
+    g_memory.orig_glTexStorage3D(target, levels, internalformat, width, height, depth);
+    if (g_memory.init) { gloadMemStats_storage(gloadMemStats_texture(target, &face), internalformat, gloadMemStats_storageSize(target, levels, internalformat, width, height, depth)); }
+}
+
+static void APIENTRY    gloadMemStats_glTexStorage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) {
+    GLuint  face;
+
+    g_memory.orig_glTexStorage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
+    if (g_memory.init) { gloadMemStats_storage(gloadMemStats_texture(target, &face), internalformat, gloadMemStats_imageSize(internalformat, width, height, 1) * (GLuint64) (samples > 1 ? samples : 1)); }
+}
+
+static void APIENTRY    gloadMemStats_glTexStorage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) {
+    GLuint  face;
+
+    g_memory.orig_glTexStorage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+    if (g_memory.init) { gloadMemStats_storage(gloadMemStats_texture(target, &face), internalformat, gloadMemStats_imageSize(internalformat, width, height, depth) * (GLuint64) (samples > 1 ? samples : 1)); }
+}
+
+static void APIENTRY    gloadMemStats_glTextureStorage1D(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width) {
+    g_memory.orig_glTextureStorage1D(texture, levels, internalformat, width);
+    gloadMemStats_storage(texture, internalformat, gloadMemStats_storageSize(GL_TEXTURE_1D, levels, internalformat, width, 1, 1));
+}
+
+static void APIENTRY    gloadMemStats_glTextureStorage2D(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height) {
+    g_memory.orig_glTextureStorage2D(texture, levels, internalformat, width, height);
+    gloadMemStats_storage(texture, internalformat, gloadMemStats_storageSize(gloadMemStats_target(texture), levels, internalformat, width, height, 1));
+}
+
+static void APIENTRY    gloadMemStats_glTextureStorage3D(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth) {
+    g_memory.orig_glTextureStorage3D(texture, levels, internalformat, width, height, depth);
+    gloadMemStats_storage(texture, internalformat, gloadMemStats_storageSize(gloadMemStats_target(texture), levels, internalformat, width, height, depth));
+}
+
+static void APIENTRY    gloadMemStats_glTextureStorage2DMultisample(GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) {
+    g_memory.orig_glTextureStorage2DMultisample(texture, samples, internalformat, width, height, fixedsamplelocations);
+    gloadMemStats_storage(texture, internalformat, gloadMemStats_imageSize(internalformat, width, height, 1) * (GLuint64) (samples > 1 ? samples : 1));
+}
+
+static void APIENTRY    gloadMemStats_glTextureStorage3DMultisample(GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) {
+    g_memory.orig_glTextureStorage3DMultisample(texture, samples, internalformat, width, height, depth, fixedsamplelocations);
+    gloadMemStats_storage(texture, internalformat, gloadMemStats_imageSize(internalformat, width, height, depth) * (GLuint64) (samples > 1 ? samples : 1));
+}
+
+static void APIENTRY    gloadMemStats_glDeleteTextures(GLsizei n, const GLuint *textures) {
+    struct s_gloadMemBindings   *bindings;
+
+    gloadMemStats_release(&g_memory.textures, n, textures);
+    g_memory.orig_glDeleteTextures(n, textures);
+    bindings = gloadMemStats_bindings();
+    gloadMemStats_forget(&bindings->textures[0][0], sizeof(bindings->textures) / sizeof(GLuint), n, textures);
+}
+
+/* `gloadMemStats_renderbuffer`:
+ *
+ * Record the storage of a renderbuffer, 0 for the bound one.
+ * */
+static void gloadMemStats_renderbuffer(GLuint name, GLsizei samples, GLenum format, GLsizei width, GLsizei height) {
+    GLuint64    bytes;
+
+    if (!g_memory.init) { return; }
+    if (!name) { name = gloadMemStats_bound(&gloadMemStats_bindings()->renderbuffer, GL_RENDERBUFFER_BINDING); }
+    bytes = gloadMemStats_imageSize(format, width, height, 1) * (GLuint64) (samples > 1 ? samples : 1);
+    gloadInternal_mutexLock(&g_memory.mutex);
+    gloadMemStats_unknown(format, bytes);
+    gloadMemStats_set(&g_memory.renderbuffers, name, bytes);
+    gloadInternal_mutexUnlock(&g_memory.mutex);
+}
+
+static void APIENTRY    gloadMemStats_glRenderbufferStorage(GLenum target, GLenum internalformat, GLsizei width, GLsizei height) {
+    g_memory.orig_glRenderbufferStorage(target, internalformat, width, height);
+    gloadMemStats_renderbuffer(0, 1, internalformat, width, height);
+}
+
+static void APIENTRY    gloadMemStats_glRenderbufferStorageMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height) {
+    g_memory.orig_glRenderbufferStorageMultisample(target, samples, internalformat, width, height);
+    gloadMemStats_renderbuffer(0, samples, internalformat, width, height);
+}
+
+static void APIENTRY    gloadMemStats_glNamedRenderbufferStorage(GLuint renderbuffer, GLenum internalformat, GLsizei width, GLsizei height) {
+    g_memory.orig_glNamedRenderbufferStorage(renderbuffer, internalformat, width, height);
+    if (renderbuffer) { gloadMemStats_renderbuffer(renderbuffer, 1, internalformat, width, height); }
+}
+
+static void APIENTRY    gloadMemStats_glNamedRenderbufferStorageMultisample(GLuint renderbuffer, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height) {
+    g_memory.orig_glNamedRenderbufferStorageMultisample(renderbuffer, samples, internalformat, width, height);
+    if (renderbuffer) { gloadMemStats_renderbuffer(renderbuffer, samples, internalformat, width, height); }
+}
+
+static void APIENTRY    gloadMemStats_glDeleteRenderbuffers(GLsizei n, const GLuint *renderbuffers) {
+    gloadMemStats_release(&g_memory.renderbuffers, n, renderbuffers);
+    g_memory.orig_glDeleteRenderbuffers(n, renderbuffers);
+    gloadMemStats_forget(&gloadMemStats_bindings()->renderbuffer, 1, n, renderbuffers);
+}
+
+/* `gloadMemStats_bindBuffer`:
+ *
+ * Follow the generic binding of `target`, which indexed bindings set as well.
+ * */
+static void gloadMemStats_bindBuffer(GLenum target, GLuint buffer) {
+    int index;
+
+    index = gloadMemStats_bufferIndex(target);
+    if (index >= 0) { gloadMemStats_bindings()->buffers[index] = buffer + 1; }
+}
+
+static void APIENTRY    gloadMemStats_glBindBuffer(GLenum target, GLuint buffer) {
+    g_memory.orig_glBindBuffer(target, buffer);
+    gloadMemStats_bindBuffer(target, buffer);
+}
+
+static void APIENTRY    gloadMemStats_glBindBufferBase(GLenum target, GLuint index, GLuint buffer) {
+    g_memory.orig_glBindBufferBase(target, index, buffer);
+    gloadMemStats_bindBuffer(target, buffer);
+}
+
+static void APIENTRY    gloadMemStats_glBindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+    g_memory.orig_glBindBufferRange(target, index, buffer, offset, size);
+    gloadMemStats_bindBuffer(target, buffer);
+}
+
+static void APIENTRY    gloadMemStats_glActiveTexture(GLenum texture) {
+    g_memory.orig_glActiveTexture(texture);
+    gloadMemStats_bindings()->unit = texture - GL_TEXTURE0 + 1;
+}
+
+static void APIENTRY    gloadMemStats_glBindTexture(GLenum target, GLuint texture) {
+    struct s_gloadMemBindings   *bindings;
+    GLuint                      unit;
+    int                         index;
+
+    g_memory.orig_glBindTexture(target, texture);
+    index = gloadMemStats_textureIndex(target);
+    if (index < 0) { return; }
+
+    bindings = gloadMemStats_bindings();
+    unit = gloadMemStats_unit(bindings);
+    if (unit < GLOAD_MEMORY_STATS_UNITS) { bindings->textures[unit][index] = texture + 1; }
+}
+
+/* `gloadMemStats_unbound`:
+ *
+ * Forget the bindings of the units `first` to `first + count`, whose targets are unknown.
+ * */
+static void gloadMemStats_unbound(GLuint first, GLsizei count) {
+    struct s_gloadMemBindings   *bindings;
+
+    bindings = gloadMemStats_bindings();
+    for (GLuint unit = first; count > 0 && unit < GLOAD_MEMORY_STATS_UNITS; unit++, count--) {
+        memset(bindings->textures[unit], 0, sizeof(bindings->textures[unit]));
+    }
+}
+
+static void APIENTRY    gloadMemStats_glBindTextureUnit(GLuint unit, GLuint texture) {
+    g_memory.orig_glBindTextureUnit(unit, texture);
+    gloadMemStats_unbound(unit, 1);
+}
+
+static void APIENTRY    gloadMemStats_glBindTextures(GLuint first, GLsizei count, const GLuint *textures) {
+    g_memory.orig_glBindTextures(first, count, textures);
+    gloadMemStats_unbound(first, count);
+}
+
+static void APIENTRY    gloadMemStats_glBindRenderbuffer(GLenum target, GLuint renderbuffer) {
+    g_memory.orig_glBindRenderbuffer(target, renderbuffer);
+    gloadMemStats_bindings()->renderbuffer = renderbuffer + 1;
+}
+
+/* The element array buffer binding belongs to the vertex array... */
+static void APIENTRY    gloadMemStats_glBindVertexArray(GLuint array) {
+    g_memory.orig_glBindVertexArray(array);
+    gloadMemStats_bindings()->buffers[gloadMemStats_bufferIndex(GL_ELEMENT_ARRAY_BUFFER)] = 0;
+}
+
+static void APIENTRY    gloadMemStats_glDeleteVertexArrays(GLsizei n, const GLuint *arrays) {
+    g_memory.orig_glDeleteVertexArrays(n, arrays);
+    gloadMemStats_bindings()->buffers[gloadMemStats_bufferIndex(GL_ELEMENT_ARRAY_BUFFER)] = 0;
+}
+
+/* Restored attribute groups hold the texture bindings and the active unit, or the buffer bindings... */
+static void APIENTRY    gloadMemStats_glPopAttrib(void) {
+    g_memory.orig_glPopAttrib();
+    gloadMemStats_unbound(0, GLOAD_MEMORY_STATS_UNITS);
+    gloadMemStats_bindings()->unit = 0;
+}
+
+static void APIENTRY    gloadMemStats_glPopClientAttrib(void) {
+    struct s_gloadMemBindings   *bindings;
+
+    g_memory.orig_glPopClientAttrib();
+    bindings = gloadMemStats_bindings();
+    memset(bindings->buffers, 0, sizeof(bindings->buffers));
+}
+
+/* Swap a loaded procedure with its hook, and back only if no other hook was installed on top of it since... */
+#   define GLOAD_MEMORY_STATS_HOOK(name) \
+    if (gload_##name && !g_memory.orig_##name) { g_memory.orig_##name = gload_##name, gload_##name = gloadMemStats_##name; }
+#   define GLOAD_MEMORY_STATS_UNHOOK(name) \
+    if (gload_##name == gloadMemStats_##name) { gload_##name = g_memory.orig_##name, g_memory.orig_##name = 0; }
+
+/* `gloadMemStatsInit`:
+ *
+ * Start hooking the allocation procedures. Objects allocated before are not accounted.
+ * NOTE:
+ *  This function requires loaded OpenGL functions.
+ *
+ * - return: `true` on success, `false` on failure.
+ * */
+GLAPI int   gloadMemStatsInit(void) {
+    if (g_memory.init) { return (1); }
+    if (!glGetIntegerv || !glBufferData || !glTexImage2D) { return (0); }
+
+    memset(&g_memory, 0, offsetof(struct s_gloadMemory, orig_glBufferData));
+    gloadInternal_mutexInit(&g_memory.mutex);
+    g_memory_epoch++;
+    g_memory.nvx = gloadIsExtensionSupported("GL_NVX_gpu_memory_info");
+    g_memory.ati = gloadIsExtensionSupported("GL_ATI_meminfo");
+    GLOAD_MEMORY_STATS_HOOK(glBufferData);
+    GLOAD_MEMORY_STATS_HOOK(glBufferStorage);
+    GLOAD_MEMORY_STATS_HOOK(glNamedBufferData);
+    GLOAD_MEMORY_STATS_HOOK(glNamedBufferStorage);
+    GLOAD_MEMORY_STATS_HOOK(glDeleteBuffers);
+    GLOAD_MEMORY_STATS_HOOK(glTexImage1D);
+    GLOAD_MEMORY_STATS_HOOK(glTexImage2D);
+    GLOAD_MEMORY_STATS_HOOK(glTexImage3D);
+    GLOAD_MEMORY_STATS_HOOK(glTexImage2DMultisample);
+    GLOAD_MEMORY_STATS_HOOK(glTexImage3DMultisample);
+    GLOAD_MEMORY_STATS_HOOK(glCompressedTexImage1D);
+    GLOAD_MEMORY_STATS_HOOK(glCompressedTexImage2D);
+    GLOAD_MEMORY_STATS_HOOK(glCompressedTexImage3D);
+    GLOAD_MEMORY_STATS_HOOK(glTexStorage1D);
+    GLOAD_MEMORY_STATS_HOOK(glTexStorage2D);
+    GLOAD_MEMORY_STATS_HOOK(glTexStorage3D);
+    GLOAD_MEMORY_STATS_HOOK(glTexStorage2DMultisample);
+    GLOAD_MEMORY_STATS_HOOK(glTexStorage3DMultisample);
+    GLOAD_MEMORY_STATS_HOOK(glTextureStorage1D);
+    GLOAD_MEMORY_STATS_HOOK(glTextureStorage2D);
+    GLOAD_MEMORY_STATS_HOOK(glTextureStorage3D);
+    GLOAD_MEMORY_STATS_HOOK(glTextureStorage2DMultisample);
+    GLOAD_MEMORY_STATS_HOOK(glTextureStorage3DMultisample);
+    GLOAD_MEMORY_STATS_HOOK(glDeleteTextures);
+    GLOAD_MEMORY_STATS_HOOK(glRenderbufferStorage);
+    GLOAD_MEMORY_STATS_HOOK(glRenderbufferStorageMultisample);
+    GLOAD_MEMORY_STATS_HOOK(glNamedRenderbufferStorage);
+    GLOAD_MEMORY_STATS_HOOK(glNamedRenderbufferStorageMultisample);
+    GLOAD_MEMORY_STATS_HOOK(glDeleteRenderbuffers);
+    GLOAD_MEMORY_STATS_HOOK(glBindBuffer);
+    GLOAD_MEMORY_STATS_HOOK(glBindBufferBase);
+    GLOAD_MEMORY_STATS_HOOK(glBindBufferRange);
+    GLOAD_MEMORY_STATS_HOOK(glActiveTexture);
+    GLOAD_MEMORY_STATS_HOOK(glBindTexture);
+    GLOAD_MEMORY_STATS_HOOK(glBindTextureUnit);
+    GLOAD_MEMORY_STATS_HOOK(glBindTextures);
+    GLOAD_MEMORY_STATS_HOOK(glBindRenderbuffer);
+    GLOAD_MEMORY_STATS_HOOK(glBindVertexArray);
+    GLOAD_MEMORY_STATS_HOOK(glDeleteVertexArrays);
+    GLOAD_MEMORY_STATS_HOOK(glPopAttrib);
+    GLOAD_MEMORY_STATS_HOOK(glPopClientAttrib);
+    g_memory.init = 1;
+    return (1);
+}
+
+/* `gloadMemStatsTerminate`:
+ *
+ * Restore the original procedures and discard the tracked objects.
+ * Hooks another one was installed on top of stay in place, and forward every call untracked.
+ * */
+GLAPI void  gloadMemStatsTerminate(void) {
+    if (!g_memory.init) { return; }
+
+    GLOAD_MEMORY_STATS_UNHOOK(glBufferData);
+    GLOAD_MEMORY_STATS_UNHOOK(glBufferStorage);
+    GLOAD_MEMORY_STATS_UNHOOK(glNamedBufferData);
+    GLOAD_MEMORY_STATS_UNHOOK(glNamedBufferStorage);
+    GLOAD_MEMORY_STATS_UNHOOK(glDeleteBuffers);
+    GLOAD_MEMORY_STATS_UNHOOK(glTexImage1D);
+    GLOAD_MEMORY_STATS_UNHOOK(glTexImage2D);
+    GLOAD_MEMORY_STATS_UNHOOK(glTexImage3D);
+    GLOAD_MEMORY_STATS_UNHOOK(glTexImage2DMultisample);
+    GLOAD_MEMORY_STATS_UNHOOK(glTexImage3DMultisample);
+    GLOAD_MEMORY_STATS_UNHOOK(glCompressedTexImage1D);
+    GLOAD_MEMORY_STATS_UNHOOK(glCompressedTexImage2D);
+    GLOAD_MEMORY_STATS_UNHOOK(glCompressedTexImage3D);
+    GLOAD_MEMORY_STATS_UNHOOK(glTexStorage1D);
+    GLOAD_MEMORY_STATS_UNHOOK(glTexStorage2D);
+    GLOAD_MEMORY_STATS_UNHOOK(glTexStorage3D);
+    GLOAD_MEMORY_STATS_UNHOOK(glTexStorage2DMultisample);
+    GLOAD_MEMORY_STATS_UNHOOK(glTexStorage3DMultisample);
+    GLOAD_MEMORY_STATS_UNHOOK(glTextureStorage1D);
+    GLOAD_MEMORY_STATS_UNHOOK(glTextureStorage2D);
+    GLOAD_MEMORY_STATS_UNHOOK(glTextureStorage3D);
+    GLOAD_MEMORY_STATS_UNHOOK(glTextureStorage2DMultisample);
+    GLOAD_MEMORY_STATS_UNHOOK(glTextureStorage3DMultisample);
+    GLOAD_MEMORY_STATS_UNHOOK(glDeleteTextures);
+    GLOAD_MEMORY_STATS_UNHOOK(glRenderbufferStorage);
+    GLOAD_MEMORY_STATS_UNHOOK(glRenderbufferStorageMultisample);
+    GLOAD_MEMORY_STATS_UNHOOK(glNamedRenderbufferStorage);
+    GLOAD_MEMORY_STATS_UNHOOK(glNamedRenderbufferStorageMultisample);
+    GLOAD_MEMORY_STATS_UNHOOK(glDeleteRenderbuffers);
+    GLOAD_MEMORY_STATS_UNHOOK(glBindBuffer);
+    GLOAD_MEMORY_STATS_UNHOOK(glBindBufferBase);
+    GLOAD_MEMORY_STATS_UNHOOK(glBindBufferRange);
+    GLOAD_MEMORY_STATS_UNHOOK(glActiveTexture);
+    GLOAD_MEMORY_STATS_UNHOOK(glBindTexture);
+    GLOAD_MEMORY_STATS_UNHOOK(glBindTextureUnit);
+    GLOAD_MEMORY_STATS_UNHOOK(glBindTextures);
+    GLOAD_MEMORY_STATS_UNHOOK(glBindRenderbuffer);
+    GLOAD_MEMORY_STATS_UNHOOK(glBindVertexArray);
+    GLOAD_MEMORY_STATS_UNHOOK(glDeleteVertexArrays);
+    GLOAD_MEMORY_STATS_UNHOOK(glPopAttrib);
+    GLOAD_MEMORY_STATS_UNHOOK(glPopClientAttrib);
+    free(g_memory.buffers.bytes);
+    free(g_memory.textures.bytes);
+    free(g_memory.renderbuffers.bytes);
+    free(g_memory.levels);
+    gloadInternal_mutexDestroy(&g_memory.mutex);
+    memset(&g_memory, 0, offsetof(struct s_gloadMemory, orig_glBufferData));
+}
+
+/* `gloadMemStats`:
+ *
+ * NOTE:
+ *  The driver counters are queried on the current context.
+ *
+ * - param: `t_gloadMemStats *stats` - memory statistics
+ * - return: `true` on success, `false` if the statistics were not initialized.
+ * */
+GLAPI int   gloadMemStats(t_gloadMemStats *stats) {
+    if (!stats) { return (0); }
+    memset(stats, 0, sizeof(t_gloadMemStats));
+    stats->total_kb = -1;
+    stats->available_kb = -1;
+    stats->evicted_kb = -1;
+    stats->evictions = -1;
+    if (!g_memory.init) { return (0); }
+
+    gloadInternal_mutexLock(&g_memory.mutex);
+    stats->buffer_bytes = g_memory.buffers.total;
+    stats->texture_bytes = g_memory.textures.total;
+    stats->renderbuffer_bytes = g_memory.renderbuffers.total;
+    stats->peak_bytes = g_memory.peak;
+    stats->buffers = g_memory.buffers.count;
+    stats->textures = g_memory.textures.count;
+    stats->renderbuffers = g_memory.renderbuffers.count;
+    stats->untracked = g_memory.untracked;
+    gloadInternal_mutexUnlock(&g_memory.mutex);
+
+    if (g_memory.nvx) {
+        glGetIntegerv(GL_GPU_MEMORY_INFO_DEDICATED_VIDMEM_NVX, &stats->total_kb);
+        glGetIntegerv(GL_GPU_MEMORY_INFO_CURRENT_AVAILABLE_VIDMEM_NVX, &stats->available_kb);
+        glGetIntegerv(GL_GPU_MEMORY_INFO_EVICTED_MEMORY_NVX, &stats->evicted_kb);
+        glGetIntegerv(GL_GPU_MEMORY_INFO_EVICTION_COUNT_NVX, &stats->evictions);
+    }
+    else if (g_memory.ati) {
+        GLint   memory[4];
+
+        /* total free memory, largest free block, total and largest free auxiliary memory... */
+        glGetIntegerv(GL_TEXTURE_FREE_MEMORY_ATI, memory);
+        stats->available_kb = memory[0];
+    }
+    return (1);
+}
+
+#   undef GLOAD_MEMORY_STATS_UNHOOK
+#   undef GLOAD_MEMORY_STATS_HOOK
+#   undef GLOAD_MEMORY_STATS_UNITS
+#   undef GLOAD_MEMORY_STATS_LEVELS
+#  endif /* GLOAD_MEMORY_STATS */
+#
+#  if defined (GLOAD_TRACE)
+
+/* SECTION:
+ *  gload trace API
+ * * * * * * * * * * */
+
+/* Maximum nesting of GPU spans, and number of frames between two clock calibrations... */
+#   define GLOAD_TRACE_GPU_DEPTH 16
+#   define GLOAD_TRACE_CALIBRATION 64
+
+/* `struct s_gloadTraceEvent` - recorded event, timed on the CPU clock.
+ *
+ * `phase` is the trace-event phase: 'B'/'E' for CPU spans, 'X' for GPU spans (lasting `value`),
+ * 'i' for frame markers (frame `value`), 'M' for thread names.
+ * */
+struct s_gloadTraceEvent {
+    const char  *name;
+    GLuint64    ts;
+    GLuint64    value;
+    GLuint      track;
+    char        phase;
+};
+
+/* `struct s_gloadTraceBuffer` - events of a single thread.
+ *
+ * Single-producer single-consumer ring: the thread advances `head`, the writer thread advances `tail`.
+ * */
+struct s_gloadTraceBuffer {
+    struct s_gloadTraceBuffer   *next;
+    GLuint                      track;
+    volatile GLuint             head;
+    volatile GLuint             tail;
+    volatile GLuint             dropped;
+    struct s_gloadTraceEvent    events[GLOAD_TRACE_BUFFER_EVENTS];
+};
+
+/* `g_trace_buffer`, `g_trace_generation` - buffer of the calling thread, and the trace it was registered to.
+ * */
+static GLOAD_INTERNAL_TLS struct s_gloadTraceBuffer *g_trace_buffer;
+static GLOAD_INTERNAL_TLS GLuint                    g_trace_generation;
+
+/* `static struct s_gloadTrace g_trace` - state of the trace.
+ * */
+static struct s_gloadTrace {
+    volatile GLuint             open;
+    GLuint                      generation;
+    FILE                        *file;
+    GLuint64                    start;
+    GLuint64                    written;
+    t_gloadInternalMutex        mutex;
+    t_gloadInternalCond         cond;
+    t_gloadInternalThread       thread;
+    int                         flush;
+    int                         quit;
+    struct s_gloadTraceBuffer   *buffers;
+    t_gloadTraceStats           stats;
+
+    /* GPU spans, recorded from the context thread */
+    int                         gpu;
+    GLint64                     offset;
+    GLuint                      queries[GLOAD_TRACE_GPU_QUERIES * 2];
+    const char                  *names[GLOAD_TRACE_GPU_QUERIES];
+    GLubyte                     ended[GLOAD_TRACE_GPU_QUERIES];
+    GLuint                      head;
+    GLuint                      tail;
+    GLuint                      stack[GLOAD_TRACE_GPU_DEPTH];
+    GLuint                      depth;
+    GLuint                      skipped;
+    GLuint                      dropped;
+}   g_trace;
+
+/* `gloadTrace_buffer`:
+ *
+ * - return: buffer of the calling thread, registered on its first event; null on failure.
+ * */
+static struct s_gloadTraceBuffer    *gloadTrace_buffer(void) {
+    struct s_gloadTraceBuffer   *buffer;
+
+    if (g_trace_generation == g_trace.generation) { return (g_trace_buffer); }
+
+    buffer = (struct s_gloadTraceBuffer *) calloc(1, sizeof(struct s_gloadTraceBuffer));
+    gloadInternal_mutexLock(&g_trace.mutex);
+    if (buffer) {
+        buffer->track = ++g_trace.stats.threads;
+        buffer->next = g_trace.buffers;
+        g_trace.buffers = buffer;
+    }
+    gloadInternal_mutexUnlock(&g_trace.mutex);
+    g_trace_buffer = buffer;
+    g_trace_generation = g_trace.generation;
+    return (buffer);
+}
+
+/* `gloadTrace_push`:
+ *
+ * Record an event on the buffer of the calling thread, without locking. Full buffers drop the event.
+ * */
+static void gloadTrace_push(char phase, const char *name, GLuint64 ts, GLuint64 value, int gpu) {
+    struct s_gloadTraceBuffer   *buffer;
+    struct s_gloadTraceEvent    *event;
+    GLuint                      head;
+
+    if (!gloadInternal_atomicLoad(&g_trace.open)) { return; }
+    buffer = gloadTrace_buffer();
+    if (!buffer) { return; }
+
+    head = buffer->head;
+    if (head - gloadInternal_atomicLoad(&buffer->tail) >= GLOAD_TRACE_BUFFER_EVENTS) {
+        gloadInternal_atomicStore(&buffer->dropped, buffer->dropped + 1);
+        return;
+    }
+    event = &buffer->events[head & (GLOAD_TRACE_BUFFER_EVENTS - 1)];
+    event->name = name;
+    event->ts = ts;
+    event->value = value;
+    event->track = gpu ? 0 : buffer->track;
+    event->phase = phase;
+    gloadInternal_atomicStore(&buffer->head, head + 1);
+}
+
+/* `gloadTrace_string`:
+ *
+ * Write `string` as a JSON string.
+ * */
+static void gloadTrace_string(FILE *file, const char *string) {
+    fputc('"', file);
+    for (; string && *string; string++) {
+        if (*string == '"' || *string == '\\') { fputc('\\', file), fputc(*string, file); }
+        else if ((unsigned char) *string < 0x20) { fprintf(file, "\\u%04x", (unsigned int) *string); }
+        else { fputc(*string, file); }
+    }
+    fputc('"', file);
+}
+
+/* `gloadTrace_write`:
+ *
+ * Write an event, timestamped in microseconds since the trace was opened.
+ * */
+static void gloadTrace_write(const struct s_gloadTraceEvent *event) {
+    FILE        *file;
+    GLuint64    ts;
+
+    file = g_trace.file;
+    ts = event->ts > g_trace.start ? event->ts - g_trace.start : 0;
+    fputs(g_trace.written++ ? ",\n" : "\n", file);
+    if (event->phase == 'M') {
+        fprintf(file, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":", event->track);
+        if (event->name) { gloadTrace_string(file, event->name); }
+        else { fprintf(file, "\"Thread %u\"", event->track); }
+        fputs("}}", file);
+        return;
+    }
+
+    fprintf(file, "{\"ph\":\"%c\",\"pid\":1,\"tid\":%u,\"ts\":%llu.%03llu", event->phase, event->track,
+        (unsigned long long) (ts / 1000), (unsigned long long) (ts % 1000));
+    if (event->name) { fputs(",\"name\":", file), gloadTrace_string(file, event->name); }
+    if (event->phase == 'X') {
+        fprintf(file, ",\"dur\":%llu.%03llu", (unsigned long long) (event->value / 1000), (unsigned long long) (event->value % 1000));
+    }
+    if (event->phase == 'i') { fprintf(file, ",\"s\":\"g\",\"args\":{\"frame\":%llu}", (unsigned long long) event->value); }
+    fputc('}', file);
+}
+
+/* `gloadTrace_flush`:
+ *
+ * Write the events recorded by every thread, from the writer thread.
+ * */
+static void gloadTrace_flush(void) {
+    struct s_gloadTraceBuffer   *buffer;
+    GLuint64                    events;
+    GLuint64                    dropped;
+
+    /* buffers are only prepended, so the list can be walked unlocked... */
+    gloadInternal_mutexLock(&g_trace.mutex);
+    buffer = g_trace.buffers;
+    gloadInternal_mutexUnlock(&g_trace.mutex);
+
+    events = 0;
+    dropped = 0;
+    for (; buffer; buffer = buffer->next) {
+        GLuint  head;
+        GLuint  tail;
+
+        head = gloadInternal_atomicLoad(&buffer->head);
+        for (tail = buffer->tail; tail != head; tail++, events++) {
+            gloadTrace_write(&buffer->events[tail & (GLOAD_TRACE_BUFFER_EVENTS - 1)]);
+        }
+        gloadInternal_atomicStore(&buffer->tail, tail);
+        dropped += gloadInternal_atomicLoad(&buffer->dropped);
+    }
+    fflush(g_trace.file);
+
+    gloadInternal_mutexLock(&g_trace.mutex);
+    g_trace.stats.events += events;
+    g_trace.stats.dropped = dropped;
+    gloadInternal_mutexUnlock(&g_trace.mutex);
+}
+
+/* `gloadTrace_writer`:
+ *
+ * Writer thread: flush the buffers whenever a frame ends, and once more when the trace is closed.
+ * */
+GLOAD_INTERNAL_THREADPROC(gloadTrace_writer, arg) {
+    (void) arg;
+
+    gloadInternal_mutexLock(&g_trace.mutex);
+    while (!g_trace.quit) {
+        while (!g_trace.flush && !g_trace.quit) { gloadInternal_condWait(&g_trace.cond, &g_trace.mutex); }
+        g_trace.flush = 0;
+        gloadInternal_mutexUnlock(&g_trace.mutex);
+        gloadTrace_flush();
+        gloadInternal_mutexLock(&g_trace.mutex);
+    }
+    gloadInternal_mutexUnlock(&g_trace.mutex);
+    gloadTrace_flush();
+    GLOAD_INTERNAL_THREADEXIT;
+}
+
+/* `gloadTrace_calibrate`:
+ *
+ * Measure the offset from the GPU clock to the CPU clock, around a `GL_TIMESTAMP` query.
+ * */
+static void gloadTrace_calibrate(void) {
+    GLuint64    before;
+    GLuint64    after;
+    GLint64     gpu;
+
+    gpu = 0;
+    before = gloadInternal_clock();
+    glGetInteger64v(GL_TIMESTAMP, &gpu);
+    after = gloadInternal_clock();
+    g_trace.offset = (GLint64) (before + (after - before) / 2) - gpu;
+}
+
+/* `gloadTrace_resolve`:
+ *
+ * Record the GPU spans whose timestamps are available, in submission order.
+ *
+ * - return: number of spans recorded.
+ * */
+static GLuint   gloadTrace_resolve(void) {
+    GLuint  count;
+
+    for (count = 0; g_trace.tail != g_trace.head; count++) {
+        GLuint64    begin;
+        GLuint64    end;
+        GLuint      available;
+        GLuint      slot;
+
+        slot = g_trace.tail % GLOAD_TRACE_GPU_QUERIES;
+        if (!g_trace.ended[slot]) { break; }
+        available = 0;
+        glGetQueryObjectuiv(g_trace.queries[slot * 2 + 1], GL_QUERY_RESULT_AVAILABLE, &available);
+        if (!available) { break; }
+
+        glGetQueryObjectui64v(g_trace.queries[slot * 2], GL_QUERY_RESULT, &begin);
+        glGetQueryObjectui64v(g_trace.queries[slot * 2 + 1], GL_QUERY_RESULT, &end);
+        gloadTrace_push('X', g_trace.names[slot], (GLuint64) ((GLint64) begin + g_trace.offset), end > begin ? end - begin : 0, 1);
+        g_trace.ended[slot] = 0;
+        g_trace.tail++;
+    }
+    return (count);
+}
+
+/* `gloadTraceOpen`:
+ *
+ * Start writing a trace to `path`. GPU spans are recorded when the current context supports timer queries.
+ * NOTE:
+ *  Event names aren't copied: they must stay valid until the trace is closed (i.e. string literals).
+ *
+ * - param: `const char *path` - path of the JSON file to write
+ * - return: `true` on success, `false` on failure.
+ * */
+GLAPI int   gloadTraceOpen(const char *path) {
+    GLuint  generation;
+
+    if (g_trace.open || !path) { return (0); }
+
+    generation = g_trace.generation;
+    memset(&g_trace, 0, sizeof(g_trace));
+    g_trace.generation = generation + 1;
+    g_trace.file = fopen(path, "w");
+    if (!g_trace.file) { return (0); }
+    fputs("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[", g_trace.file);
+
+    gloadInternal_mutexInit(&g_trace.mutex);
+    gloadInternal_condInit(&g_trace.cond);
+    if (!gloadInternal_threadCreate(&g_trace.thread, gloadTrace_writer, 0)) {
+        gloadInternal_condDestroy(&g_trace.cond);
+        gloadInternal_mutexDestroy(&g_trace.mutex);
+        fclose(g_trace.file);
+        g_trace.file = 0;
+        return (0);
+    }
+
+    g_trace.gpu = glGenQueries && glDeleteQueries && glQueryCounter && glGetQueryObjectuiv && glGetQueryObjectui64v && glGetInteger64v &&
+        (gloadIsVersionSupported(3, 3) || gloadIsExtensionSupported("GL_ARB_timer_query"));
+    if (g_trace.gpu) {
+        glGenQueries(GLOAD_TRACE_GPU_QUERIES * 2, g_trace.queries);
+        gloadTrace_calibrate();
+    }
+    g_trace.start = gloadInternal_clock();
+    gloadInternal_atomicStore(&g_trace.open, 1);
+    if (g_trace.gpu) { gloadTrace_push('M', "GPU", 0, 0, 1); }
+    return (1);
+}
+
+/* `gloadTraceClose`:
+ *
+ * Write the remaining events and close the trace, once the traced threads stopped recording.
+ * The GPU spans still in flight are lost.
+ * */
+GLAPI void  gloadTraceClose(void) {
+    struct s_gloadTraceBuffer   *buffer;
+    GLuint                      spans;
+
+    if (!g_trace.open) { return; }
+
+    spans = 0;
+    if (g_trace.gpu) {
+        spans = gloadTrace_resolve();
+        glDeleteQueries(GLOAD_TRACE_GPU_QUERIES * 2, g_trace.queries);
+    }
+    gloadInternal_atomicStore(&g_trace.open, 0);
+    gloadInternal_mutexLock(&g_trace.mutex);
+    g_trace.stats.gpu_spans += spans;
+    g_trace.quit = 1;
+    gloadInternal_condBroadcast(&g_trace.cond);
+    gloadInternal_mutexUnlock(&g_trace.mutex);
+    gloadInternal_threadJoin(&g_trace.thread);
+
+    fputs("\n]}\n", g_trace.file);
+    fclose(g_trace.file);
+    g_trace.file = 0;
+    while (g_trace.buffers) {
+        buffer = g_trace.buffers;
+        g_trace.buffers = buffer->next;
+        free(buffer);
+    }
+    gloadInternal_condDestroy(&g_trace.cond);
+    gloadInternal_mutexDestroy(&g_trace.mutex);
+}
+
+/* `gloadTraceThreadName`:
+ *
+ * Name the track of the calling thread.
+ * */
+GLAPI void  gloadTraceThreadName(const char *name) {
+    gloadTrace_push('M', name, 0, 0, 0);
+}
+
+/* `gloadTraceBegin`:
+ *
+ * Open a CPU span on the track of the calling thread. Spans nest and are closed with `gloadTraceEnd`.
+ * */
+GLAPI void  gloadTraceBegin(const char *name) {
+    gloadTrace_push('B', name, gloadInternal_clock(), 0, 0);
+}
+
+/* `gloadTraceEnd`:
+ *
+ * Close the last CPU span opened by the calling thread.
+ * */
+GLAPI void  gloadTraceEnd(void) {
+    gloadTrace_push('E', 0, gloadInternal_clock(), 0, 0);
+}
+
+/* `gloadTraceGpuBegin`:
+ *
+ * Open a GPU span on the GPU track. Spans nest and are closed with `gloadTraceGpuEnd`.
+ * NOTE:
+ *  GPU spans must be recorded from the thread owning the context the trace was opened on.
+ * */
+GLAPI void  gloadTraceGpuBegin(const char *name) {
+    GLuint  slot;
 
-extern "C" {
+    if (!g_trace.open || !g_trace.gpu) { return; }
+    if (g_trace.depth == GLOAD_TRACE_GPU_DEPTH) {
+        g_trace.skipped++;
+        return;
+    }
 
-#  endif /* __cplusplus */
-    
-/* SECTION:
- *  Global objects
- * * * * * * * * * * */
+    /* spans that don't fit are still pushed, so their end is matched... */
+    if (g_trace.head - g_trace.tail == GLOAD_TRACE_GPU_QUERIES) {
+        g_trace.dropped++;
+        g_trace.stack[g_trace.depth++] = GLOAD_TRACE_GPU_QUERIES;
+        return;
+    }
+    slot = g_trace.head++ % GLOAD_TRACE_GPU_QUERIES;
+    glQueryCounter(g_trace.queries[slot * 2], GL_TIMESTAMP);
+    g_trace.names[slot] = name;
+    g_trace.stack[g_trace.depth++] = slot;
+}
 
-/* `struct s_nameaddr` - key-value-pair structure of proc. names and addresses.
+/* `gloadTraceGpuEnd`:
+ *
+ * Close the last GPU span opened.
  * */
+GLAPI void  gloadTraceGpuEnd(void) {
+    GLuint  slot;
 
-struct s_nameaddr {
+    if (!g_trace.open || !g_trace.gpu) { return; }
+    if (g_trace.skipped) {
+        g_trace.skipped--;
+        return;
+    }
+    if (!g_trace.depth) { return; }
 
-#  if !defined (__cplusplus)
-    const char          *name;
-#  else
-    const std::string   &name;
-#  endif /* __cplusplus */
+    slot = g_trace.stack[--g_trace.depth];
+    if (slot == GLOAD_TRACE_GPU_QUERIES) { return; }
+    glQueryCounter(g_trace.queries[slot * 2 + 1], GL_TIMESTAMP);
+    g_trace.ended[slot] = 1;
+}
 
-    void        **addr;
-};
+/* `gloadTraceFrame`:
+ *
+ * Mark the end of a frame: collect the finished GPU spans and wake up the writer thread.
+ * NOTE:
+ *  This function must be called from the thread owning the context the trace was opened on.
+ * */
+GLAPI void  gloadTraceFrame(void) {
+    GLuint  spans;
 
-/* `static struct s_nameaddr g_nameaddr` - array of s_nameaddr structures, null-terminated.
+    if (!g_trace.open) { return; }
+
+    gloadTrace_push('i', "Frame", gloadInternal_clock(), g_trace.stats.frames, 0);
+    spans = 0;
+    if (g_trace.gpu) {
+        spans = gloadTrace_resolve();
+        if (!(g_trace.stats.frames % GLOAD_TRACE_CALIBRATION)) { gloadTrace_calibrate(); }
+    }
+
+    gloadInternal_mutexLock(&g_trace.mutex);
+    g_trace.stats.frames++;
+    g_trace.stats.gpu_spans += spans;
+    g_trace.flush = 1;
+    gloadInternal_condBroadcast(&g_trace.cond);
+    gloadInternal_mutexUnlock(&g_trace.mutex);
+}
+
+/* `gloadTraceGetStats`:
+ *
+ * - param: `t_gloadTraceStats *stats` - statistics of the trace
  * */
+GLAPI void  gloadTraceGetStats(t_gloadTraceStats *stats) {
+    if (!stats) { return; }
+    if (!g_trace.open) {
+        *stats = g_trace.stats;
+        stats->dropped += g_trace.dropped;
+        return;
+    }
 
-static struct s_nameaddr    g_nameaddr[] = {
-    
-/* <<gload-nameaddr>> */
+    gloadInternal_mutexLock(&g_trace.mutex);
+    *stats = g_trace.stats;
+    gloadInternal_mutexUnlock(&g_trace.mutex);
+    stats->dropped += g_trace.dropped;
+}
 
-    /* null-terminator */
-    { "", 0 }
+#   undef GLOAD_TRACE_CALIBRATION
+#   undef GLOAD_TRACE_GPU_DEPTH
+#  endif /* GLOAD_TRACE */
+#
+#  if defined (GLOAD_DEBUG_OUTPUT)
+
+/* SECTION:
+ *  gload debug output API
+ * * * * * * * * * * * * * */
+
+/* Period of the drain thread, in milliseconds... */
+#   define GLOAD_DEBUG_OUTPUT_DRAIN 50
+
+/* `struct s_gloadDebugEntry` - message ID, updated without locks by the callback.
+ *
+ * `state` is 0 for free entries, 1 while the callback claiming the entry writes `source`, `type` and `id`,
+ * and 2 once they can be compared. `window` is the last interval a message was queued in (plus one),
+ * `count` the number of messages received. The remaining fields are only touched by the draining thread.
+ * */
+struct s_gloadDebugEntry {
+    volatile GLuint state;
+    volatile GLuint window;
+    volatile GLuint count;
+    GLenum          source;
+    GLenum          type;
+    GLuint          id;
+    GLuint          forwarded;
+    int             performance;
+    GLenum          severity;
+    GLchar          message[GLOAD_DEBUG_OUTPUT_MESSAGE_LENGTH];
 };
 
-/* `static void *g_handle` - handle to shared/dynamic library.
+/* `struct s_gloadDebugSlot` - queued message.
+ *
+ * Multiple-producer single-consumer ring: `sequence` tells whether the slot is free or written.
  * */
-static void *g_handle = 0;
+struct s_gloadDebugSlot {
+    volatile GLuint             sequence;
+    struct s_gloadDebugEntry    *entry;
+    GLenum                      source;
+    GLenum                      type;
+    GLuint                      id;
+    GLenum                      severity;
+    GLchar                      message[GLOAD_DEBUG_OUTPUT_MESSAGE_LENGTH];
+};
 
-/* SECTION:
- *  gload API
- * * * * * * * * * * */
+/* `static struct s_gloadDebugOutput g_debug` - state of the debug output.
+ * */
+static struct s_gloadDebugOutput {
+    int                         init;
+    GLboolean                   enabled;
+    GLboolean                   synchronous;
+    t_gloadDebugCallback        callback;
+    void                        *user;
+    GLDEBUGPROC                 previous;
+    void                        *previous_user;
+    t_gloadInternalMutex        mutex;
+    t_gloadInternalCond         cond;
+    t_gloadInternalThread       thread;
+    int                         quit;
+    volatile GLuint             head;
+    GLuint                      tail;
+    volatile GLuint             messages;
+    volatile GLuint             dropped;
+    GLuint                      forwarded;
+    struct s_gloadDebugSlot     slots[GLOAD_DEBUG_OUTPUT_MESSAGES];
+    struct s_gloadDebugEntry    entries[GLOAD_DEBUG_OUTPUT_MAX_IDS];
+}   *g_debug;
 
-/* `gloadLoadGL`:
+/* `gloadDebugOutput_entry`:
  *
- * Perform a simple OpenGL (v.1.0 - v.4.6) and OpenGLES (v.1.0 - v.3.2) loading process.
- * 
- * `gloadLoadGL` auto-detects which backend should be used:
- * `GLX`, `EGL`, `WGL` or `built-in` (using either `dlopen` or `LoadLibraryA`, depending on the platform).
+ * Find or insert the entry of a message ID, without locking.
  *
- * - return: `true` on success, `false` on failure.
+ * - return: entry of the message ID, null when the table is full.
  * */
-GLAPI int   gloadLoadGL(void) {
+static struct s_gloadDebugEntry *gloadDebugOutput_entry(GLenum source, GLenum type, GLuint id) {
+    GLuint  slot;
 
-#  if defined (GLOAD_GLX)
-    return (gloadLoadGLLoader((t_gloadLoader) glXGetProcAddress));
-#  endif /* GLOAD_GLX */
-#  if defined (GLOAD_EGL)
-    return (gloadLoadGLLoader((t_gloadLoader) eglGetProcAddress));
-#  endif /* GLOAD_EGL */
-#  if defined (GLOAD_WGL)
-    return (gloadLoadGLLoader((t_gloadLoader) wglGetProcAddress));
-#  endif /* GLOAD_WGL */
-#  if defined (GLOAD_DLSYM)
-    return (gloadLoadGLLoader((t_gloadLoader) gloadGetProcAddress));
-#  endif /* GLOAD_DLSYM */
+    slot = (GLuint) (id * 0x9e3779b1u) ^ (GLuint) ((source & 0xf) << 4 | (type & 0xf));
+    for (GLuint i = 0; i < GLOAD_DEBUG_OUTPUT_MAX_IDS; i++, slot++) {
+        struct s_gloadDebugEntry    *entry;
+        GLuint                      state;
 
+        entry = &g_debug->entries[slot & (GLOAD_DEBUG_OUTPUT_MAX_IDS - 1)];
+        state = gloadInternal_atomicLoad(&entry->state);
+        if (!state && gloadInternal_atomicCompareExchange(&entry->state, 0, 1)) {
+            entry->source = source;
+            entry->type = type;
+            entry->id = id;
+            gloadInternal_atomicStore(&entry->state, 2);
+            return (entry);
+        }
+
+        /* another callback is writing the entry: it only has three fields left to store... */
+        while (gloadInternal_atomicLoad(&entry->state) == 1) { }
+        if (entry->id == id && entry->source == source && entry->type == type) { return (entry); }
+    }
+    return (0);
 }
 
-/* `gloadLoadGL`:
+/* `gloadDebugOutput_callback`:
  *
- * Unload OpenGL functions and dispose dynamic/shared object handle.
- * This function will execute anything if `gloadGetProcAddress` was used at least once;
- * for other backends (i.e. `GLX`, `EGL`, `WGL` and more) this function will simply return.
+ * Count the message, and queue the first one of its ID in the current interval.
+ * */
+static void APIENTRY    gloadDebugOutput_callback(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar *message, const void *user) {
+    struct s_gloadDebugOutput   *debug;
+    struct s_gloadDebugEntry    *entry;
+    struct s_gloadDebugSlot     *slot;
+    GLuint                      window;
+    GLuint                      last;
+    GLuint                      head;
+
+    debug = (struct s_gloadDebugOutput *) user;
+    gloadInternal_atomicAdd(&debug->messages, 1);
+    entry = gloadDebugOutput_entry(source, type, id);
+    if (!entry) {
+        gloadInternal_atomicAdd(&debug->dropped, 1);
+        return;
+    }
+    gloadInternal_atomicAdd(&entry->count, 1);
+
+    window = (GLuint) (gloadInternal_clock() / (GLOAD_DEBUG_OUTPUT_INTERVAL * 1000000ull)) + 1;
+    last = gloadInternal_atomicLoad(&entry->window);
+    if (last == window || !gloadInternal_atomicCompareExchange(&entry->window, last, window)) { return; }
+
+    /* claim a free slot... */
+    head = gloadInternal_atomicLoad(&debug->head);
+    for (;;) {
+        GLint   diff;
+
+        slot = &debug->slots[head & (GLOAD_DEBUG_OUTPUT_MESSAGES - 1)];
+        diff = (GLint) (gloadInternal_atomicLoad(&slot->sequence) - head);
+        if (diff < 0) {
+            gloadInternal_atomicAdd(&debug->dropped, 1);
+            return;
+        }
+        if (!diff && gloadInternal_atomicCompareExchange(&debug->head, head, head + 1)) { break; }
+        head = gloadInternal_atomicLoad(&debug->head);
+    }
+
+    if (length < 0) { length = message ? (GLsizei) strlen(message) : 0; }
+    if (length >= GLOAD_DEBUG_OUTPUT_MESSAGE_LENGTH) { length = GLOAD_DEBUG_OUTPUT_MESSAGE_LENGTH - 1; }
+    slot->entry = entry;
+    slot->source = source;
+    slot->type = type;
+    slot->id = id;
+    slot->severity = severity;
+    if (length) { memcpy(slot->message, message, (size_t) length); }
+    slot->message[length] = 0;
+    gloadInternal_atomicStore(&slot->sequence, head + 1);
+}
+
+/* `gloadDebugOutput_print`:
  *
- * - returns: `true` on success, `false` on failure.
+ * Default callback: print the message on `stderr`.
  * */
-GLAPI int   gloadUnloadGL(void) {
-    if (g_handle) {
+static void gloadDebugOutput_print(const t_gloadDebugMessage *message, void *user) {
+    const char  *type;
 
-#  if defined (GLOAD_LINUX) || defined (GLOAD_APPLE)
-        dlclose(g_handle), g_handle = 0;
-#  endif /* GLOAD_LINUX, GLOAD_APPLE */
-#  if defined (GLOAD_WIN32)
-        FreeLibrary(g_handle), g_handle = 0;
-#  endif /* GLOAD_WIN32 */
+    (void) user;
+    switch (message->type) {
+        case (GL_DEBUG_TYPE_ERROR): type = "error"; break;
+        case (GL_DEBUG_TYPE_DEPRECATED_BEHAVIOR): type = "deprecated"; break;
+        case (GL_DEBUG_TYPE_UNDEFINED_BEHAVIOR): type = "undefined behavior"; break;
+        case (GL_DEBUG_TYPE_PORTABILITY): type = "portability"; break;
+        case (GL_DEBUG_TYPE_PERFORMANCE): type = "performance"; break;
+        default: type = "other"; break;
+    }
+    if (message->count > 1) { fprintf(stderr, "gload.h: OpenGL %s 0x%x (x%u): %s\n", type, message->id, message->count, message->message); }
+    else { fprintf(stderr, "gload.h: OpenGL %s 0x%x: %s\n", type, message->id, message->message); }
+}
+
+/* `gloadDebugOutput_drain`:
+ *
+ * Forward the queued messages, with the lock held.
+ * */
+static void gloadDebugOutput_drain(void) {
+    for (;;) {
+        struct s_gloadDebugSlot     *slot;
+        struct s_gloadDebugEntry    *entry;
+        t_gloadDebugMessage         message;
+        GLuint                      count;
 
+        slot = &g_debug->slots[g_debug->tail & (GLOAD_DEBUG_OUTPUT_MESSAGES - 1)];
+        if (gloadInternal_atomicLoad(&slot->sequence) != g_debug->tail + 1) { break; }
+
+        entry = slot->entry;
+        count = gloadInternal_atomicLoad(&entry->count);
+        entry->severity = slot->severity;
+        if (slot->type == GL_DEBUG_TYPE_PERFORMANCE) {
+            entry->performance = 1;
+            memcpy(entry->message, slot->message, sizeof(entry->message));
+        }
+
+        message.source = slot->source;
+        message.type = slot->type;
+        message.id = slot->id;
+        message.severity = slot->severity;
+        message.count = count - entry->forwarded;
+        message.message = slot->message;
+        entry->forwarded = count;
+        g_debug->callback(&message, g_debug->user);
+        g_debug->forwarded++;
+
+        gloadInternal_atomicStore(&slot->sequence, g_debug->tail + GLOAD_DEBUG_OUTPUT_MESSAGES);
+        g_debug->tail++;
     }
+}
 
-    return (1);
+/* `gloadDebugOutput_drainer`:
+ *
+ * Drain thread: forward the queued messages periodically, and once more when terminated.
+ * */
+GLOAD_INTERNAL_THREADPROC(gloadDebugOutput_drainer, arg) {
+    (void) arg;
+
+    gloadInternal_mutexLock(&g_debug->mutex);
+    while (!g_debug->quit) {
+        gloadInternal_condTimedWait(&g_debug->cond, &g_debug->mutex, GLOAD_DEBUG_OUTPUT_DRAIN);
+        gloadDebugOutput_drain();
+    }
+    gloadInternal_mutexUnlock(&g_debug->mutex);
+    GLOAD_INTERNAL_THREADEXIT;
 }
 
-/* `gloadLoadGLLoader`:
+/* `gloadDebugOutputInit`:
  *
- * Perform a simple OpenGL (v.1.0 - v.4.6) and OpenGLES (v.1.0 - v.3.2) loading process.
- * 
- * gloadLoadGLLoader expects a pointer to a `*GetProcAddress` function.
- * Most, if not all opengl-oriented libraries support the propper version of `*GetProcAddress`
- * and gload.h provides a built-in solution: `gloadGetProcAddress`.
+ * Enable the debug output of the current context, asynchronously, and start the drain thread.
+ * NOTE:
+ *  This function requires loaded OpenGL functions. Contexts created without the debug flag may report few messages.
  *
- * - param: `t_gloadLoader load` - pointer to a loader function
+ * - param: `t_gloadDebugCallback callback` - receives the messages, null to print them on `stderr`
+ * - param: `void *user` - passed to `callback`
  * - return: `true` on success, `false` on failure.
  * */
-GLAPI int   gloadLoadGLLoader(t_gloadLoader load) {
-    if (!load) { return (0); }
-    for (size_t i = 0; g_nameaddr[i].addr; i++) {
-        /* If the function is already loaded, skip it... */
-        if (*g_nameaddr[i].addr) { continue; }
-
-#  if !defined (__cplusplus)
-        *g_nameaddr[i].addr = load(g_nameaddr[i].name);
-#  else
-        *g_nameaddr[i].addr = load(g_nameaddr[i].name.c_str());
-#  endif /* __cplusplus */
+GLAPI int   gloadDebugOutputInit(t_gloadDebugCallback callback, void *user) {
+    if (g_debug) { return (1); }
+    if (!glDebugMessageCallback || !glIsEnabled || !glEnable || !glDisable) { return (0); }
+    if (!gloadIsVersionSupported(4, 3) && !gloadIsExtensionSupported("GL_KHR_debug")) { return (0); }
 
-        if (!*g_nameaddr[i].addr) { return (0); }
+    g_debug = (struct s_gloadDebugOutput *) calloc(1, sizeof(struct s_gloadDebugOutput));
+    if (!g_debug) { return (0); }
+    for (GLuint i = 0; i < GLOAD_DEBUG_OUTPUT_MESSAGES; i++) { g_debug->slots[i].sequence = i; }
+    g_debug->callback = callback ? callback : gloadDebugOutput_print;
+    g_debug->user = user;
+    gloadInternal_mutexInit(&g_debug->mutex);
+    gloadInternal_condInit(&g_debug->cond);
+    if (!gloadInternal_threadCreate(&g_debug->thread, gloadDebugOutput_drainer, 0)) {
+        gloadInternal_condDestroy(&g_debug->cond);
+        gloadInternal_mutexDestroy(&g_debug->mutex);
+        free(g_debug);
+        g_debug = 0;
+        return (0);
     }
 
+    g_debug->enabled = glIsEnabled(GL_DEBUG_OUTPUT);
+    g_debug->synchronous = glIsEnabled(GL_DEBUG_OUTPUT_SYNCHRONOUS);
+    if (glGetPointerv) {
+        void    *pointer;
+
+        pointer = 0;
+        glGetPointerv(GL_DEBUG_CALLBACK_FUNCTION, &pointer);
+        g_debug->previous = (GLDEBUGPROC) pointer;
+        glGetPointerv(GL_DEBUG_CALLBACK_USER_PARAM, &g_debug->previous_user);
+    }
+    glDebugMessageCallback(gloadDebugOutput_callback, g_debug);
+    glDisable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
+    glEnable(GL_DEBUG_OUTPUT);
     return (1);
 }
 
-/* `gloadGetProcAddress`:
+/* `gloadDebugOutputTerminate`:
  *
- * Retrieve the address of the OpenGL symbol from dynamic/shared object.
- * Uses `dlopen` and `dlsym` for GNU/Linux and MacOS platform.
- * Uses `LoadLibraryA` and `GetProcAddress` for Win32 platform.
+ * Forward the remaining messages, stop the drain thread and restore the debug output of the current context,
+ * along with the callback it had before `gloadDebugOutputInit`.
+ * */
+GLAPI void  gloadDebugOutputTerminate(void) {
+    if (!g_debug) { return; }
+
+    glDebugMessageCallback(g_debug->previous, g_debug->previous_user);
+    if (!g_debug->enabled) { glDisable(GL_DEBUG_OUTPUT); }
+    if (g_debug->synchronous) { glEnable(GL_DEBUG_OUTPUT_SYNCHRONOUS); }
+
+    gloadInternal_mutexLock(&g_debug->mutex);
+    g_debug->quit = 1;
+    gloadInternal_condBroadcast(&g_debug->cond);
+    gloadInternal_mutexUnlock(&g_debug->mutex);
+    gloadInternal_threadJoin(&g_debug->thread);
+    gloadDebugOutput_drain();
+
+    gloadInternal_condDestroy(&g_debug->cond);
+    gloadInternal_mutexDestroy(&g_debug->mutex);
+    free(g_debug);
+    g_debug = 0;
+}
+
+/* `gloadDebugOutputDrain`:
  *
- * - param: `const char *name` - name of the symbol
- * - return: address of the symbol on success, null on failure
+ * Forward the queued messages now, from the calling thread. It must not be called from the callback.
  * */
-GLAPI void  *gloadGetProcAddress(const char *name) {
-    void        *proc;
-    const char  *names[] = {
+GLAPI void  gloadDebugOutputDrain(void) {
+    if (!g_debug) { return; }
 
-#  if defined (GLOAD_LINUX)
-        "libGL.so",
-        "libGL.so.1",
-        "libGL.so.1.7.0",
-        0
-#  endif /* GLOAD_LINUX */
-#  if defined (GLOAD_APPLE)
-        "../Frameworks/OpenGL.framework/OpenGL",
-        "/Library/Frameworks/OpenGL.framework/OpenGL",
-        "/System/Library/Frameworks/OpenGL.framework/OpenGL",
-        "/System/Library/Frameworks/OpenGL.framework/Versions/Current/OpenGL"
-        0
-#  endif /* GLOAD_APPLE */
-#  if defined (GLOAD_WIN32)
-        "opengl32.dll",
-        0
-#  endif /* GLOAD_WIN32 */
+    gloadInternal_mutexLock(&g_debug->mutex);
+    gloadDebugOutput_drain();
+    gloadInternal_mutexUnlock(&g_debug->mutex);
+}
 
-    };
-    
-    if (!g_handle) {
-        for (size_t i = 0; !g_handle && names[i]; i++) {
+/* `gloadDebugOutputGetPerformance`:
+ *
+ * Copy the performance messages reported the most often, in decreasing order of count.
+ *
+ * - param: `t_gloadDebugPerformance *items` - array receiving the messages
+ * - param: `GLuint count` - size of `items`
+ * - return: number of messages copied.
+ * */
+GLAPI GLuint    gloadDebugOutputGetPerformance(t_gloadDebugPerformance *items, GLuint count) {
+    GLuint  copied;
 
-#  if defined (GLOAD_LINUX) || defined (GLOAD_APPLE)
-            g_handle = dlopen(names[i], RTLD_NOW | RTLD_GLOBAL);
-#  endif /* GLOAD_LINUX, GLOAD_APPLE */
-#  if defined (GLOAD_WIN32)
-            g_handle = LoadLibraryA(names[i]);
-#  endif /* GLOAD_WIN32 */
+    if (!g_debug || !items || !count) { return (0); }
 
-        }
+    /* insertion into the sorted output, which only ever holds the most frequent `count` messages... */
+    copied = 0;
+    gloadInternal_mutexLock(&g_debug->mutex);
+    gloadDebugOutput_drain();
+    for (GLuint i = 0; i < GLOAD_DEBUG_OUTPUT_MAX_IDS; i++) {
+        const struct s_gloadDebugEntry  *entry;
+        GLuint                          calls;
+        GLuint                          j;
 
-        if (!g_handle) {
+        entry = &g_debug->entries[i];
+        if (!entry->performance) { continue; }
+        calls = gloadInternal_atomicLoad(&g_debug->entries[i].count);
+        if (copied == count && calls <= items[count - 1].count) { continue; }
 
-#  if defined (GLOAD_VERBOSE_ERROR)
-            fprintf(stderr, "gload.h: could not load an OpenGL handle.\n");
-#  endif /* GLOAD_VERBOSE_ERROR */
+        j = copied < count ? copied++ : count - 1;
+        for (; j > 0 && items[j - 1].count < calls; j--) { items[j] = items[j - 1]; }
+        items[j].source = entry->source;
+        items[j].id = entry->id;
+        items[j].severity = entry->severity;
+        items[j].count = calls;
+        memcpy(items[j].message, entry->message, sizeof(items[j].message));
+    }
+    gloadInternal_mutexUnlock(&g_debug->mutex);
+    return (copied);
+}
 
-            return (0);
+/* `gloadDebugOutputGetStats`:
+ *
+ * - param: `t_gloadDebugOutputStats *stats` - statistics of the debug output
+ * */
+GLAPI void  gloadDebugOutputGetStats(t_gloadDebugOutputStats *stats) {
+    if (!stats) { return; }
+    memset(stats, 0, sizeof(t_gloadDebugOutputStats));
+    if (!g_debug) { return; }
+
+    gloadInternal_mutexLock(&g_debug->mutex);
+    stats->messages = gloadInternal_atomicLoad(&g_debug->messages);
+    stats->forwarded = g_debug->forwarded;
+    stats->dropped = gloadInternal_atomicLoad(&g_debug->dropped);
+    for (GLuint i = 0; i < GLOAD_DEBUG_OUTPUT_MAX_IDS; i++) { stats->ids += gloadInternal_atomicLoad(&g_debug->entries[i].state) != 0; }
+    gloadInternal_mutexUnlock(&g_debug->mutex);
+}
 
+#   undef GLOAD_DEBUG_OUTPUT_DRAIN
+#  endif /* GLOAD_DEBUG_OUTPUT */
+#
+#  if defined (GLOAD_ENUM_NAMES)
+
+/* SECTION:
+ *  gload enum names API
+ * * * * * * * * * * * * */
+
+/* `struct s_gloadEnumEntry` - enum of a group, and the offset of its name in `g_enum_names`.
+ * */
+struct s_gloadEnumEntry {
+    GLenum      value;
+    GLushort    group;
+    GLushort    name;
+};
+
+/* `static const char g_enum_names[]` - null-terminated names, sorted.
+ * */
+static const char   g_enum_names[] =
+/* <<gload-enum-names-0>> */;
+
+/* `static const char *const g_enum_groups[]` - registry groups, sorted; the first one holds the enums without group.
+ * */
+static const char   *const g_enum_groups[] = {
+/* <<gload-enum-names-1>> */
+};
+
+/* `static const struct s_gloadEnumEntry g_enum_entries[]` - enums sorted by value, the shortest name of a value first.
+ * */
+static const struct s_gloadEnumEntry    g_enum_entries[] = {
+/* <<gload-enum-names-2>> */
+};
+
+/* `static const GLushort g_enum_index[]` - an entry of every name, in the order of the names.
+ * */
+static const GLushort   g_enum_index[] = {
+/* <<gload-enum-names-3>> */
+};
+
+/* `static const char *const g_enum_vendors[]` - vendor suffixes of the registry extensions, sorted.
+ * */
+static const char   *const g_enum_vendors[] = {
+/* <<gload-enum-names-4>> */
+};
+
+/* `static const GLuint g_enum_aliases[]` - suffixed names declared with the value of their core name,
+ * as the entry of the core name shifted by 8 bits and the index of the vendor, sorted.
+ * */
+static const GLuint g_enum_aliases[] = {
+/* <<gload-enum-names-5>> */
+};
+
+/* `gloadEnumName`:
+ *
+ * Name an enum of the core OpenGL, OpenGL ES and OpenGL SC versions. Values shared by several enums (i.e. `GL_ONE`,
+ * `GL_TRUE`, `GL_LINES`) are told apart by the group of the registry (i.e. "BlendingFactor", "Boolean", "PrimitiveType");
+ * aliases of a value within a group (i.e. extension suffixes) are folded into the shortest name.
+ *
+ * - param: `GLenum value` - enum value
+ * - param: `const char *group` - group of the enum, null for any
+ * - return: name of the enum in `group`, or the shortest name of `value` if none; null if `value` is unknown.
+ * */
+GLAPI const char    *gloadEnumName(GLenum value, const char *group) {
+    GLuint  low;
+    GLuint  high;
+    GLuint  first;
+
+    /* first entry of the value... */
+    low = 0;
+    high = sizeof(g_enum_entries) / sizeof(g_enum_entries[0]);
+    while (low < high) {
+        GLuint  mid;
+
+        mid = (low + high) / 2;
+        if (g_enum_entries[mid].value < value) { low = mid + 1; }
+        else { high = mid; }
+    }
+    if (low == sizeof(g_enum_entries) / sizeof(g_enum_entries[0]) || g_enum_entries[low].value != value) { return (0); }
+    first = low;
+
+    /* ...then its entry in the group, if any */
+    if (group) {
+        high = sizeof(g_enum_groups) / sizeof(g_enum_groups[0]);
+        low = 0;
+        while (low < high) {
+            GLuint  mid;
+            int     cmp;
+
+            mid = (low + high) / 2;
+            cmp = strcmp(g_enum_groups[mid], group);
+            if (!cmp) {
+                for (GLuint i = first; i < sizeof(g_enum_entries) / sizeof(g_enum_entries[0]) && g_enum_entries[i].value == value; i++) {
+                    if (g_enum_entries[i].group == mid) { return (g_enum_names + g_enum_entries[i].name); }
+                }
+                break;
+            }
+            if (cmp < 0) { low = mid + 1; }
+            else { high = mid; }
         }
     }
+    return (g_enum_names + g_enum_entries[first].name);
+}
 
-#  if defined (GLOAD_LINUX) || defined (GLOAD_APPLE)
-    proc = dlsym(g_handle, name);
-#  endif /* GLOAD_LINUX, GLOAD_APPLE */
-#  if defined (GLOAD_WIN32)
-    proc = GetProcAddress(g_handle, name);
-#  endif /* GLOAD_WIN32 */
+/* `gloadEnum_find`:
+ *
+ * - return: entry of the enum named `length` characters of `name`, null if unknown.
+ * */
+static const struct s_gloadEnumEntry    *gloadEnum_find(const char *name, size_t length) {
+    GLuint  low;
+    GLuint  high;
 
-    if (!proc) {
+    low = 0;
+    high = sizeof(g_enum_index) / sizeof(g_enum_index[0]);
+    while (low < high) {
+        const char  *entry;
+        GLuint      mid;
+        int         cmp;
 
-#  if defined (GLOAD_VERBOSE_ERROR)
-            fprintf(stderr, "gload.h: could not load a procedure: %s\n", name);
-#  endif /* GLOAD_VERBOSE_ERROR */
-    
-            return (0);
+        mid = (low + high) / 2;
+        entry = g_enum_names + g_enum_entries[g_enum_index[mid]].name;
+        cmp = strncmp(entry, name, length);
+        if (!cmp) { cmp = entry[length] ? 1 : 0; }
+        if (!cmp) { return (&g_enum_entries[g_enum_index[mid]]); }
+        if (cmp < 0) { low = mid + 1; }
+        else { high = mid; }
     }
-    return (proc);
+    return (0);
 }
 
-/* SECTION:
- *  OpenGL API
- * * * * * * */
+/* `gloadEnumValue`:
+ *
+ * Look up an enum of the core OpenGL, OpenGL ES and OpenGL SC versions by name.
+ * Names with a vendor suffix (i.e. `GL_RGBA8_OES`) resolve to the core name when the registry declares them with the
+ * same value; other suffixed names (i.e. `GL_REPLACE_EXT`) are not found.
+ *
+ * - param: `const char *name` - name of the enum (i.e. "GL_RGBA8")
+ * - param: `GLenum *value` - receives the enum value
+ * - return: `true` if `name` was found, `false` otherwise.
+ * */
+GLAPI int   gloadEnumValue(const char *name, GLenum *value) {
+    const struct s_gloadEnumEntry   *entry;
+    const char                      *suffix;
+    GLuint                          vendor;
+    GLuint                          alias;
+    GLuint                          low;
+    GLuint                          high;
 
-/* <<gload-declr-0>> */
+    if (!name || !value) { return (0); }
+
+    entry = gloadEnum_find(name, strlen(name));
+    if (!entry) {
+        suffix = strrchr(name, '_');
+        if (!suffix || suffix == name) { return (0); }
+        entry = gloadEnum_find(name, (size_t) (suffix - name));
+        if (!entry) { return (0); }
+
+        /* the suffix must be a vendor of the registry... */
+        for (vendor = 0; vendor < sizeof(g_enum_vendors) / sizeof(g_enum_vendors[0]) && strcmp(g_enum_vendors[vendor], suffix + 1); vendor++) { }
+        if (vendor == sizeof(g_enum_vendors) / sizeof(g_enum_vendors[0])) { return (0); }
+
+        /* ...and the suffixed name an alias of the same value */
+        alias = (GLuint) (entry - g_enum_entries) << 8 | vendor;
+        low = 0;
+        high = sizeof(g_enum_aliases) / sizeof(g_enum_aliases[0]);
+        while (low < high) {
+            GLuint  mid;
+
+            mid = (low + high) / 2;
+            if (g_enum_aliases[mid] < alias) { low = mid + 1; }
+            else { high = mid; }
+        }
+        if (low == sizeof(g_enum_aliases) / sizeof(g_enum_aliases[0]) || g_enum_aliases[low] != alias) { return (0); }
+    }
+    *value = entry->value;
+    return (1);
+}
+
+#  endif /* GLOAD_ENUM_NAMES */
 #
 #  if defined (__cplusplus)
 
@@ -0,0 +1,110 @@
+#define GLOAD_BUFFER_ALLOCATOR
+#define GLOAD_IMPLEMENTATION
+#include "./../../gload.h"
+
+#include <GLFW/glfw3.h>
+#include <stdio.h>
+
+/* Buffer allocator benchmark:
+ *  - `buffers` creates a buffer object per allocation (`glGenBuffers` + `glBufferData`) and deletes it,
+ *  - `allocator` allocates and releases the same sizes from a `t_gloadBufferAllocator` over a 64 MiB buffer.
+ * Then 200000 random allocations and releases churn the allocator, and the fragmentation is reported
+ * before and after `gloadBufferAllocatorDefragment`.
+ * */
+
+#define POOL        (64 << 20)
+#define PAIRS       5000
+#define LIVE        16384
+#define OPERATIONS  200000
+
+
+
+static unsigned g_random = 1;
+
+static unsigned random_next(void) {
+    g_random = g_random * 1103515245u + 12345u;
+    return (g_random >> 8);
+}
+
+static void stats_print(const char *name, const t_gloadBufferAllocator *allocator) {
+    t_gloadBufferAllocatorStats stats;
+
+    gloadBufferAllocatorGetStats(allocator, &stats);
+    printf("%-17s: %u allocations, %.1f MiB used, %u free blocks, largest %.1f MiB, fragmentation %.3f\n", name,
+           stats.allocations, (double) stats.used / (1 << 20), stats.free_blocks, (double) stats.largest_free / (1 << 20), stats.fragmentation);
+}
+
+
+
+int main(void) {
+    if (!glfwInit()) { return (1); }
+
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+
+    GLFWwindow *window = glfwCreateWindow(640, 480, "gload.h - buffer allocator benchmark", 0, 0);
+    if (!window) { return (1); }
+
+    glfwMakeContextCurrent(window);
+
+    if (!gloadLoadGLLoader((t_gloadLoader) glfwGetProcAddress)) { return (1); }
+
+    t_gloadBufferAllocator allocator;
+    if (!gloadBufferAllocatorCreate(&allocator, GL_ARRAY_BUFFER, POOL, GL_DYNAMIC_STORAGE_BIT, LIVE)) { return (1); }
+
+
+    glFinish();
+    double start = glfwGetTime();
+    for (int i = 0; i < PAIRS; i++) {
+        GLuint buffer;
+        glGenBuffers(1, &buffer);
+        glBindBuffer(GL_ARRAY_BUFFER, buffer);
+        glBufferData(GL_ARRAY_BUFFER, 256 + (i % 64) * 256, 0, GL_DYNAMIC_DRAW);
+        glDeleteBuffers(1, &buffer);
+    }
+    glFinish();
+    double buffers = glfwGetTime() - start;
+
+    start = glfwGetTime();
+    for (int i = 0; i < PAIRS; i++) {
+        t_gloadBufferAllocation allocation;
+        if (gloadBufferAllocatorAllocate(&allocator, 256 + (i % 64) * 256, &allocation)) {
+            gloadBufferAllocatorFree(&allocator, &allocation);
+        }
+    }
+    double allocations = glfwGetTime() - start;
+
+    printf("buffers  : %.0f ns per create + delete\n", buffers * 1e9 / PAIRS);
+    printf("allocator: %.0f ns per allocate + free\n", allocations * 1e9 / PAIRS);
+
+
+    static t_gloadBufferAllocation live[LIVE];
+    static int used[LIVE];
+    int failures = 0;
+    start = glfwGetTime();
+    for (int i = 0; i < OPERATIONS; i++) {
+        unsigned slot = random_next() % LIVE;
+        if (used[slot]) {
+            gloadBufferAllocatorFree(&allocator, &live[slot]);
+            used[slot] = 0;
+        }
+        else if (gloadBufferAllocatorAllocate(&allocator, 16 + random_next() % 8192, &live[slot])) { used[slot] = 1; }
+        else { failures++; }
+    }
+    double churn = glfwGetTime() - start;
+
+    printf("%d random operations: %.0f ns each, %d failed\n", OPERATIONS, churn * 1e9 / OPERATIONS, failures);
+    stats_print("before defragment", &allocator);
+    if (gloadBufferAllocatorDefragment(&allocator)) { stats_print("after defragment", &allocator); }
+    glFinish();
+
+
+    gloadBufferAllocatorDestroy(&allocator);
+
+    glfwDestroyWindow(window);
+    glfwTerminate();
+
+    return (0);
+}
@@ -0,0 +1,132 @@
+#define GLOAD_CONTEXT_POOL
+#define GLOAD_IMPLEMENTATION
+#include "./../../gload.h"
+
+#include <GLFW/glfw3.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/* Context pool benchmark:
+ *  - `inline` runs the jobs on the rendering thread, as a pool without workers does,
+ *  - `workers` runs them on 3 worker threads, each with a hidden GLFW window sharing the rendering context.
+ * Each of the 64 jobs uploads a 1 MiB buffer and a 256x256 texture. The time spent on the rendering thread
+ * to submit the jobs is reported with the total, and every upload is checked from the rendering context.
+ * */
+
+#define JOBS        64
+#define WORKERS     3
+#define BYTES       (1 << 20)
+#define SIZE        256
+
+
+
+typedef struct s_upload {
+    GLuint  buffer;
+    GLuint  texture;
+    int     valid;
+}   t_upload;
+
+static t_upload g_uploads[JOBS];
+static GLubyte  *g_pixels;
+
+static void upload_run(void *user) {
+    t_upload *upload = (t_upload *) user;
+
+    glGenBuffers(1, &upload->buffer);
+    glBindBuffer(GL_ARRAY_BUFFER, upload->buffer);
+    glBufferData(GL_ARRAY_BUFFER, BYTES, g_pixels, GL_STATIC_DRAW);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    glGenTextures(1, &upload->texture);
+    glBindTexture(GL_TEXTURE_2D, upload->texture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, SIZE, SIZE, 0, GL_RGBA, GL_UNSIGNED_BYTE, g_pixels);
+    glBindTexture(GL_TEXTURE_2D, 0);
+}
+
+static void upload_done(void *user) {
+    t_upload *upload = (t_upload *) user;
+    GLubyte last[16];
+
+    glBindBuffer(GL_ARRAY_BUFFER, upload->buffer);
+    glGetBufferSubData(GL_ARRAY_BUFFER, BYTES - 16, 16, last);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    upload->valid = glIsTexture(upload->texture) && last[0] == g_pixels[BYTES - 16] && last[15] == g_pixels[BYTES - 1];
+}
+
+/* Hidden windows are created and destroyed on the main thread, as GLFW requires... */
+static void *context_create(void *user) {
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+    return (glfwCreateWindow(1, 1, "gload.h - worker", 0, (GLFWwindow *) user));
+}
+
+static int context_make_current(void *context, void *user) {
+    (void) user;
+    glfwMakeContextCurrent((GLFWwindow *) context);
+    return (1);
+}
+
+static void context_destroy(void *context, void *user) {
+    (void) user;
+    glfwDestroyWindow((GLFWwindow *) context);
+}
+
+
+
+int main(void) {
+    if (!glfwInit()) { return (1); }
+
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+
+    GLFWwindow *window = glfwCreateWindow(640, 480, "gload.h - context pool benchmark", 0, 0);
+    if (!window) { return (1); }
+
+    glfwMakeContextCurrent(window);
+
+    if (!gloadLoadGLLoader((t_gloadLoader) glfwGetProcAddress)) { return (1); }
+
+    g_pixels = (GLubyte *) malloc(BYTES);
+    if (!g_pixels) { return (1); }
+    for (int i = 0; i < BYTES; i++) {
+        g_pixels[i] = (GLubyte) (i * 7);
+    }
+
+
+    const t_gloadContextBackend backend = { context_create, context_make_current, context_destroy, window };
+    for (int mode = 0; mode < 2; mode++) {
+        t_gloadContextPool pool;
+        if (!gloadContextPoolCreate(&pool, mode ? WORKERS : 0, &backend)) { return (1); }
+
+        glFinish();
+        double start = glfwGetTime();
+        for (int i = 0; i < JOBS; i++) {
+            gloadContextPoolSubmit(&pool, upload_run, upload_done, &g_uploads[i]);
+        }
+        double submitted = glfwGetTime() - start;
+        gloadContextPoolFinish(&pool);
+        glFinish();
+        double elapsed = glfwGetTime() - start;
+
+        int valid = 0;
+        for (int i = 0; i < JOBS; i++) {
+            valid += g_uploads[i].valid;
+            glDeleteBuffers(1, &g_uploads[i].buffer);
+            glDeleteTextures(1, &g_uploads[i].texture);
+            g_uploads[i].valid = 0;
+        }
+        printf("%-7s: %.2f ms to submit, %.2f ms in total, %u jobs inlined, %d/%d uploads valid\n",
+               mode ? "workers" : "inline", submitted * 1000.0, elapsed * 1000.0, pool.inlined, valid, JOBS);
+
+        gloadContextPoolDestroy(&pool);
+    }
+
+
+    free(g_pixels);
+
+    glfwDestroyWindow(window);
+    glfwTerminate();
+
+    return (0);
+}
@@ -0,0 +1,132 @@
+#define GLOAD_DELETION_QUEUE
+#define GLOAD_IMPLEMENTATION
+#include "./../../gload.h"
+
+#include <GLFW/glfw3.h>
+#include <stdio.h>
+
+/* Deletion queue benchmark:
+ *  - `direct` creates 8 buffers of 64 or 128 KiB every frame, writes to them and deletes them at the end of the frame,
+ *  - `recycled` acquires the same buffers from a `t_gloadDeletionQueue` and retires them at the end of the frame,
+ *    so buffers come back from the pool once the GPU is done with them.
+ * Both run 200 frames. Before that, 50 textures and 50 buffers are deleted through the queue to count
+ * the `glDelete*` calls they end up in.
+ * */
+
+#define BUFFERS     8
+#define FRAMES      200
+#define OBJECTS     50
+
+
+
+static PFNGLDELETEBUFFERSPROC g_delete_buffers;
+static PFNGLDELETETEXTURESPROC g_delete_textures;
+static int g_delete_calls;
+
+static void APIENTRY delete_buffers(GLsizei n, const GLuint *buffers) {
+    g_delete_calls++;
+    g_delete_buffers(n, buffers);
+}
+
+static void APIENTRY delete_textures(GLsizei n, const GLuint *textures) {
+    g_delete_calls++;
+    g_delete_textures(n, textures);
+}
+
+static GLuint buffer_create(GLsizeiptr size, int storage) {
+    GLuint buffer;
+
+    glGenBuffers(1, &buffer);
+    glBindBuffer(GL_ARRAY_BUFFER, buffer);
+    if (storage) { glBufferStorage(GL_ARRAY_BUFFER, size, 0, GL_DYNAMIC_STORAGE_BIT); }
+    else { glBufferData(GL_ARRAY_BUFFER, size, 0, GL_DYNAMIC_DRAW); }
+    return (buffer);
+}
+
+
+
+int main(void) {
+    if (!glfwInit()) { return (1); }
+
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 4);
+    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+
+    GLFWwindow *window = glfwCreateWindow(640, 480, "gload.h - deletion queue benchmark", 0, 0);
+    if (!window) { return (1); }
+
+    glfwMakeContextCurrent(window);
+
+    if (!gloadLoadGLLoader((t_gloadLoader) glfwGetProcAddress)) { return (1); }
+
+    t_gloadDeletionQueue queue;
+    if (!gloadDeletionQueueCreate(&queue)) { return (1); }
+
+
+    /* Count the calls that reach the driver... */
+    g_delete_buffers = glDeleteBuffers, glDeleteBuffers = delete_buffers;
+    g_delete_textures = glDeleteTextures, glDeleteTextures = delete_textures;
+
+    GLuint textures[OBJECTS], buffers[OBJECTS];
+    glGenTextures(OBJECTS, textures);
+    glGenBuffers(OBJECTS, buffers);
+    for (int i = 0; i < OBJECTS; i++) {
+        glBindTexture(GL_TEXTURE_2D, textures[i]);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, 16, 16, 0, GL_RGBA, GL_UNSIGNED_BYTE, 0);
+        glBindBuffer(GL_ARRAY_BUFFER, buffers[i]);
+        glBufferData(GL_ARRAY_BUFFER, 256, 0, GL_STATIC_DRAW);
+    }
+    glBindTexture(GL_TEXTURE_2D, 0);
+    for (int i = 0; i < OBJECTS; i++) {
+        gloadDeletionQueueDelete(&queue, GL_TEXTURE, 1, &textures[i]);
+        gloadDeletionQueueDelete(&queue, GL_BUFFER, 1, &buffers[i]);
+    }
+    gloadDeletionQueueEndFrame(&queue);
+    glFinish();
+    gloadDeletionQueueProcess(&queue);
+    printf("%d deletions: %d glDelete* calls\n", OBJECTS * 2, g_delete_calls);
+
+    glDeleteBuffers = g_delete_buffers;
+    glDeleteTextures = g_delete_textures;
+
+
+    glFinish();
+    double start = glfwGetTime();
+    for (int frame = 0; frame < FRAMES; frame++) {
+        GLuint frame_buffers[BUFFERS];
+        for (int i = 0; i < BUFFERS; i++) {
+            frame_buffers[i] = buffer_create(65536 * (i % 2 + 1), queue.storage);
+            glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(frame), &frame);
+        }
+        glDeleteBuffers(BUFFERS, frame_buffers);
+    }
+    glFinish();
+    printf("direct  : %.2f ms, %d buffers allocated\n", (glfwGetTime() - start) * 1000.0, FRAMES * BUFFERS);
+
+    start = glfwGetTime();
+    for (int frame = 0; frame < FRAMES; frame++) {
+        GLuint frame_buffers[BUFFERS];
+        for (int i = 0; i < BUFFERS; i++) {
+            frame_buffers[i] = gloadDeletionQueueAcquireBuffer(&queue, 65536 * (i % 2 + 1), GL_DYNAMIC_STORAGE_BIT);
+            glBindBuffer(GL_ARRAY_BUFFER, frame_buffers[i]);
+            glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(frame), &frame);
+        }
+        for (int i = 0; i < BUFFERS; i++) {
+            gloadDeletionQueueRetireBuffer(&queue, frame_buffers[i], 65536 * (i % 2 + 1), GL_DYNAMIC_STORAGE_BIT);
+        }
+        gloadDeletionQueueEndFrame(&queue);
+    }
+    glFinish();
+    printf("recycled: %.2f ms, %llu buffers allocated, %llu recycled, %llu stalls\n", (glfwGetTime() - start) * 1000.0,
+           (unsigned long long) queue.allocated, (unsigned long long) queue.recycled, (unsigned long long) queue.stalls);
+
+
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    gloadDeletionQueueDestroy(&queue);
+
+    glfwDestroyWindow(window);
+    glfwTerminate();
+
+    return (0);
+}
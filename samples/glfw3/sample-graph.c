@@ -0,0 +1,136 @@
+#define GLOAD_RENDER_GRAPH
+#define GLOAD_IMPLEMENTATION
+#include "./../../gload.h"
+
+#include <GLFW/glfw3.h>
+#include <stdio.h>
+#include <string.h>
+
+/* Render graph benchmark:
+ *  - `full barriers` runs the passes of a frame with a `glMemoryBarrier(GL_ALL_BARRIER_BITS)` after each one,
+ *  - `render graph` records the same passes with their buffer accesses into a `t_gloadRenderGraph`,
+ *    which only issues the barriers the dependencies need.
+ * A frame is made of 6 compute passes over shader storage buffers: a chain of 3 dependent passes (0 -> 1 -> 2 -> 3)
+ * and 3 independent ones. Both run 50 frames; the contents of the chain are compared afterwards.
+ * */
+
+#define BUFFERS     9
+#define LENGTH      (1 << 16)
+#define PASSES      6
+#define FRAMES      50
+
+
+
+static const GLchar *g_compute_glsl =
+"#version 430 core\n"
+"\n"
+"layout (local_size_x=64) in;\n"
+"\n"
+"layout (std430, binding=0) readonly buffer Source { uint src[]; };\n"
+"layout (std430, binding=1) buffer Destination { uint dst[]; };\n"
+"\n"
+"void main() {\n"
+"   uint i = gl_GlobalInvocationID.x;\n"
+"   dst[i] = src[i] + 1u;\n"
+"}\n";
+
+static GLuint g_buffers[BUFFERS];
+static int g_full_barriers;
+static GLuint g_barriers;
+
+typedef struct s_pass {
+    int src;
+    int dst;
+}   t_pass;
+
+static void pass_run(void *user) {
+    const t_pass *pass = (const t_pass *) user;
+
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 0, g_buffers[pass->src]);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 1, g_buffers[pass->dst]);
+    glDispatchCompute(LENGTH / 64, 1, 1);
+    if (g_full_barriers) {
+        glMemoryBarrier(GL_ALL_BARRIER_BITS);
+        g_barriers++;
+    }
+}
+
+
+
+int main(void) {
+    if (!glfwInit()) { return (1); }
+
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 5);
+    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+
+    GLFWwindow *window = glfwCreateWindow(640, 480, "gload.h - render graph benchmark", 0, 0);
+    if (!window) { return (1); }
+
+    glfwMakeContextCurrent(window);
+
+    if (!gloadLoadGLLoader((t_gloadLoader) glfwGetProcAddress)) { return (1); }
+
+
+    GLuint sh_c = glCreateShader(GL_COMPUTE_SHADER);
+    glShaderSource(sh_c, 1, &g_compute_glsl, 0);
+    glCompileShader(sh_c);
+
+    GLuint shader = glCreateProgram();
+    glAttachShader(shader, sh_c);
+    glLinkProgram(shader);
+    glDeleteShader(sh_c), sh_c = 0;
+    glUseProgram(shader);
+
+    glCreateBuffers(BUFFERS, g_buffers);
+    for (int i = 0; i < BUFFERS; i++) { glNamedBufferStorage(g_buffers[i], LENGTH * sizeof(GLuint), 0, GL_DYNAMIC_STORAGE_BIT); }
+
+    t_gloadRenderGraph graph;
+    if (!gloadRenderGraphCreate(&graph, 1)) { return (1); }
+
+
+    const t_pass passes[PASSES] = { { 0, 1 }, { 4, 5 }, { 1, 2 }, { 6, 7 }, { 2, 3 }, { 4, 8 } };
+    GLuint results[2][4];
+    for (int mode = 0; mode < 2; mode++) {
+        const GLuint zero = 0;
+        for (int i = 0; i < BUFFERS; i++) { glClearNamedBufferData(g_buffers[i], GL_R32UI, GL_RED_INTEGER, GL_UNSIGNED_INT, &zero); }
+        g_full_barriers = !mode;
+        g_barriers = 0;
+
+        glFinish();
+        double start = glfwGetTime();
+        for (int frame = 0; frame < FRAMES; frame++) {
+            for (int i = 0; i < PASSES; i++) {
+                if (g_full_barriers) {
+                    pass_run((void *) &passes[i]);
+                    continue;
+                }
+
+                const t_gloadRenderGraphAccess accesses[2] = {
+                    { GL_BUFFER, g_buffers[passes[i].src], GL_SHADER_STORAGE_BARRIER_BIT, 0 },
+                    { GL_BUFFER, g_buffers[passes[i].dst], 0, GL_SHADER_STORAGE_BARRIER_BIT },
+                };
+                gloadRenderGraphAddPass(&graph, pass_run, (void *) &passes[i], accesses, 2, 0);
+            }
+            if (!g_full_barriers) { g_barriers += gloadRenderGraphExecute(&graph); }
+        }
+        glFinish();
+        double elapsed = glfwGetTime() - start;
+
+        for (int i = 0; i < 4; i++) { glGetNamedBufferSubData(g_buffers[i], 0, sizeof(GLuint), &results[mode][i]); }
+        printf("%-13s: %.2f barriers per frame, %.2f ms per frame\n", mode ? "render graph" : "full barriers",
+               (double) g_barriers / FRAMES, elapsed * 1000.0 / FRAMES);
+    }
+    printf("results are %s\n", memcmp(results[0], results[1], sizeof(results[0])) ? "different" : "identical");
+
+
+    gloadRenderGraphDestroy(&graph);
+    glDeleteBuffers(BUFFERS, g_buffers);
+    glDeleteProgram(shader);
+
+    glfwDestroyWindow(window);
+    glfwTerminate();
+
+    return (0);
+}
@@ -0,0 +1,164 @@
+#define GLOAD_RENDER_GRAPH
+#define GLOAD_IMPLEMENTATION
+#include "./../../gload.h"
+
+#include <GLFW/glfw3.h>
+#include <stdio.h>
+#include <string.h>
+
+/* Render graph invalidation benchmark:
+ *  - `stored` flags every attachment with `GLOAD_RENDER_GRAPH_KEEP`, so all of them are stored at the end of their pass,
+ *  - `invalidated` only keeps the output: the depth buffers and the MSAA color buffer are transient.
+ * A frame is made of 3 passes: a scene with color + depth, a MSAA scene resolved by a blit inside the pass,
+ * and a composite of both into the output. Both run 100 frames; the outputs are compared afterwards.
+ * */
+
+#define SIZE        512
+#define SAMPLES     4
+#define FRAMES      100
+
+
+
+static GLuint g_framebuffers[3];
+static GLuint g_resolve;
+
+static void scene_run(void *user) {
+    (void) user;
+    glClearColor(1.0f, 0.0f, 0.0f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+}
+
+static void msaa_run(void *user) {
+    (void) user;
+    glClearColor(0.0f, 1.0f, 0.0f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+    glBlitNamedFramebuffer(g_framebuffers[1], g_resolve, 0, 0, SIZE, SIZE, 0, 0, SIZE, SIZE, GL_COLOR_BUFFER_BIT, GL_NEAREST);
+}
+
+static void composite_run(void *user) {
+    (void) user;
+    glBlitNamedFramebuffer(g_framebuffers[0], g_framebuffers[2], 0, 0, SIZE / 2, SIZE, 0, 0, SIZE / 2, SIZE, GL_COLOR_BUFFER_BIT, GL_NEAREST);
+    glBlitNamedFramebuffer(g_resolve, g_framebuffers[2], SIZE / 2, 0, SIZE, SIZE, SIZE / 2, 0, SIZE, SIZE, GL_COLOR_BUFFER_BIT, GL_NEAREST);
+}
+
+static GLuint texture_create(GLenum format) {
+    GLuint texture;
+
+    glCreateTextures(GL_TEXTURE_2D, 1, &texture);
+    glTextureStorage2D(texture, 1, format, SIZE, SIZE);
+    return (texture);
+}
+
+static GLuint renderbuffer_create(GLsizei samples, GLenum format) {
+    GLuint renderbuffer;
+
+    glCreateRenderbuffers(1, &renderbuffer);
+    glNamedRenderbufferStorageMultisample(renderbuffer, samples, format, SIZE, SIZE);
+    return (renderbuffer);
+}
+
+
+
+int main(void) {
+    if (!glfwInit()) { return (1); }
+
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 5);
+    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+
+    GLFWwindow *window = glfwCreateWindow(640, 480, "gload.h - render graph invalidation benchmark", 0, 0);
+    if (!window) { return (1); }
+
+    glfwMakeContextCurrent(window);
+
+    if (!gloadLoadGLLoader((t_gloadLoader) glfwGetProcAddress)) { return (1); }
+
+
+    GLuint color = texture_create(GL_RGBA8);
+    GLuint resolved = texture_create(GL_RGBA8);
+    GLuint output = texture_create(GL_RGBA8);
+    GLuint depth = renderbuffer_create(0, GL_DEPTH_COMPONENT24);
+    GLuint msaa_color = renderbuffer_create(SAMPLES, GL_RGBA8);
+    GLuint msaa_depth = renderbuffer_create(SAMPLES, GL_DEPTH_COMPONENT24);
+
+    glCreateFramebuffers(3, g_framebuffers);
+    glCreateFramebuffers(1, &g_resolve);
+    glNamedFramebufferTexture(g_framebuffers[0], GL_COLOR_ATTACHMENT0, color, 0);
+    glNamedFramebufferRenderbuffer(g_framebuffers[0], GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, depth);
+    glNamedFramebufferRenderbuffer(g_framebuffers[1], GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, msaa_color);
+    glNamedFramebufferRenderbuffer(g_framebuffers[1], GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, msaa_depth);
+    glNamedFramebufferTexture(g_framebuffers[2], GL_COLOR_ATTACHMENT0, output, 0);
+    glNamedFramebufferTexture(g_resolve, GL_COLOR_ATTACHMENT0, resolved, 0);
+
+    /* The graph measures the renderbuffers; the binding of the application must survive it... */
+    GLuint bound = renderbuffer_create(0, GL_RGBA8);
+    glBindRenderbuffer(GL_RENDERBUFFER, bound);
+
+    t_gloadRenderGraph graph;
+    if (!gloadRenderGraphCreate(&graph, 0)) { return (1); }
+
+
+    static GLubyte results[2][SIZE * SIZE * 4];
+    for (int mode = 0; mode < 2; mode++) {
+        const GLbitfield transient = mode ? 0 : GLOAD_RENDER_GRAPH_KEEP;
+        const t_gloadRenderGraphAttachment scene[2] = {
+            { GL_COLOR_ATTACHMENT0, GL_TEXTURE, color, GLOAD_RENDER_GRAPH_CLEAR },
+            { GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, depth, GLOAD_RENDER_GRAPH_CLEAR | transient },
+        };
+        const t_gloadRenderGraphAttachment msaa[2] = {
+            { GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, msaa_color, GLOAD_RENDER_GRAPH_CLEAR | transient },
+            { GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, msaa_depth, GLOAD_RENDER_GRAPH_CLEAR | transient },
+        };
+        const t_gloadRenderGraphAttachment composite[1] = {
+            { GL_COLOR_ATTACHMENT0, GL_TEXTURE, output, GLOAD_RENDER_GRAPH_KEEP },
+        };
+        const t_gloadRenderGraphAccess msaa_writes[1] = { { GL_TEXTURE, resolved, 0, 0 } };
+        const t_gloadRenderGraphAccess composite_reads[2] = {
+            { GL_TEXTURE, color, GL_TEXTURE_FETCH_BARRIER_BIT, 0 },
+            { GL_TEXTURE, resolved, GL_TEXTURE_FETCH_BARRIER_BIT, 0 },
+        };
+        const GLuint zero[4] = { 0, 0, 0, 0 };
+        glClearNamedFramebufferuiv(g_framebuffers[2], GL_COLOR, 0, zero);
+        graph.invalidations = graph.invalidated_bytes = 0;
+
+        glFinish();
+        double start = glfwGetTime();
+        for (int frame = 0; frame < FRAMES; frame++) {
+            gloadRenderGraphAddPass(&graph, scene_run, 0, 0, 0, 0);
+            gloadRenderGraphSetTarget(&graph, g_framebuffers[0], scene, 2);
+            gloadRenderGraphAddPass(&graph, msaa_run, 0, msaa_writes, 1, 0);
+            gloadRenderGraphSetTarget(&graph, g_framebuffers[1], msaa, 2);
+            gloadRenderGraphAddPass(&graph, composite_run, 0, composite_reads, 2, 0);
+            gloadRenderGraphSetTarget(&graph, g_framebuffers[2], composite, 1);
+            gloadRenderGraphExecute(&graph);
+        }
+        glFinish();
+        double elapsed = glfwGetTime() - start;
+
+        glGetTextureImage(output, 0, GL_RGBA, GL_UNSIGNED_BYTE, sizeof(results[mode]), results[mode]);
+        printf("%-11s: %.2f invalidations per frame, %.2f MiB not stored per frame, %.2f ms per frame\n",
+               mode ? "invalidated" : "stored", (double) graph.invalidations / FRAMES,
+               (double) graph.invalidated_bytes / FRAMES / (1 << 20), elapsed * 1000.0 / FRAMES);
+    }
+    printf("outputs are %s\n", memcmp(results[0], results[1], sizeof(results[0])) ? "different" : "identical");
+
+    GLint binding = 0;
+    glGetIntegerv(GL_RENDERBUFFER_BINDING, &binding);
+    printf("renderbuffer binding %s\n", (GLuint) binding == bound ? "preserved" : "lost");
+
+
+    gloadRenderGraphDestroy(&graph);
+    glBindRenderbuffer(GL_RENDERBUFFER, 0);
+    GLuint renderbuffers[4] = { depth, msaa_color, msaa_depth, bound };
+    glDeleteRenderbuffers(4, renderbuffers);
+    GLuint textures[3] = { color, resolved, output };
+    glDeleteTextures(3, textures);
+    glDeleteFramebuffers(3, g_framebuffers);
+    glDeleteFramebuffers(1, &g_resolve);
+
+    glfwDestroyWindow(window);
+    glfwTerminate();
+
+    return (0);
+}
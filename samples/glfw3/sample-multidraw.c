@@ -0,0 +1,201 @@
+#define GLOAD_DRAW_QUEUE
+#define GLOAD_IMPLEMENTATION
+#include "./../../gload.h"
+
+#include <GLFW/glfw3.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Multi-draw benchmark:
+ *  - `multi-draw` submits the draws through a `t_gloadDrawQueue`, which batches compatible draws
+ *    into `glMultiDrawElementsIndirect` calls,
+ *  - `individual` submits the same draws with `glMultiDrawElementsIndirect` unloaded, one call per draw.
+ * The scene is a grid of 4096 quads over 8 programs and 4 vertex arrays, rendered into a 256x256 framebuffer;
+ * both images are compared after the runs. The best submission time out of 5 runs is reported.
+ * */
+
+#define PROGRAMS    8
+#define VAOS        4
+#define GRID        64
+#define DRAWS       (GRID * GRID)
+#define RUNS        5
+
+
+
+static const GLchar *g_vertex_glsl =
+"#version 330 core\n"
+"\n"
+"layout (location=0)\n"
+"in vec2 a_pos;\n"
+"layout (location=1)\n"
+"in vec4 a_color;\n"
+"\n"
+"out vec4 v_color;\n"
+"\n"
+"void main() {\n"
+"   v_color = a_color;\n"
+"   gl_Position = vec4(a_pos, 0.0, 1.0);\n"
+"}\n";
+
+static GLuint g_programs[PROGRAMS];
+static GLuint g_vaos[VAOS];
+static t_gloadDrawCommand g_commands[DRAWS];
+
+static GLuint program_create(int index) {
+    GLchar fragment[160];
+    const GLchar *fragment_glsl = fragment;
+
+    snprintf(fragment, sizeof(fragment), "#version 330 core\nin vec4 v_color;\nout vec4 o_color;\nvoid main() { o_color = v_color * %d.0 / 8.0; }\n", index + 1);
+
+    GLuint sh_v = glCreateShader(GL_VERTEX_SHADER);
+    glShaderSource(sh_v, 1, &g_vertex_glsl, 0);
+    glCompileShader(sh_v);
+    GLuint sh_f = glCreateShader(GL_FRAGMENT_SHADER);
+    glShaderSource(sh_f, 1, &fragment_glsl, 0);
+    glCompileShader(sh_f);
+
+    GLuint program = glCreateProgram();
+    glAttachShader(program, sh_v);
+    glAttachShader(program, sh_f);
+    glLinkProgram(program);
+    glDeleteShader(sh_v);
+    glDeleteShader(sh_f);
+    return (program);
+}
+
+static void bench(const char *name, GLubyte *image) {
+    t_gloadDrawQueue queue;
+    double best = 1e9;
+
+    if (!gloadDrawQueueCreate(&queue, DRAWS)) { return; }
+
+    glClear(GL_COLOR_BUFFER_BIT);
+    for (int i = 0; i < RUNS; i++) {
+        glFinish();
+        double start = glfwGetTime();
+        for (int j = 0; j < DRAWS; j++) { gloadDrawQueuePush(&queue, &g_commands[j]); }
+        gloadDrawQueueSubmit(&queue);
+        double elapsed = glfwGetTime() - start;
+        glFinish();
+        if (elapsed < best) { best = elapsed; }
+    }
+    glReadPixels(0, 0, GRID * 4, GRID * 4, GL_RGBA, GL_UNSIGNED_BYTE, image);
+
+    printf("%-10s: %.2f ms submit, %llu multi-draw calls, %llu draws\n", name, best * 1000.0,
+           (unsigned long long) queue.multidraws / RUNS, (unsigned long long) queue.draws / RUNS);
+
+    gloadDrawQueueDestroy(&queue);
+}
+
+
+
+int main(void) {
+    if (!glfwInit()) { return (1); }
+
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+
+    GLFWwindow *window = glfwCreateWindow(640, 480, "gload.h - multi-draw benchmark", 0, 0);
+    if (!window) { return (1); }
+
+    glfwMakeContextCurrent(window);
+
+    if (!gloadLoadGLLoader((t_gloadLoader) glfwGetProcAddress)) { return (1); }
+
+
+    for (int i = 0; i < PROGRAMS; i++) { g_programs[i] = program_create(i); }
+
+    /* Quads on a grid, each addressed with its base vertex and colored from an instanced attribute... */
+    GLfloat *vertices = (GLfloat *) malloc(DRAWS * 8 * sizeof(GLfloat));
+    GLfloat *colors = (GLfloat *) malloc(DRAWS * 4 * sizeof(GLfloat));
+    if (!vertices || !colors) { return (1); }
+    for (int i = 0; i < DRAWS; i++) {
+        GLfloat x = (GLfloat) (i % GRID) / GRID * 2.0f - 1.0f;
+        GLfloat y = (GLfloat) (i / GRID) / GRID * 2.0f - 1.0f;
+        GLfloat s = 2.0f / GRID * 0.8f;
+        const GLfloat quad[8] = { x, y, x + s, y, x + s, y + s, x, y + s };
+        memcpy(vertices + i * 8, quad, sizeof(quad));
+    }
+    for (int i = 0; i < DRAWS * 4; i++) { colors[i] = (GLfloat) ((i * 37) % 255) / 255.0f; }
+    const GLushort indices[6] = { 0, 1, 2, 0, 2, 3 };
+
+    GLuint vbo, cbo, ibo;
+    glGenBuffers(1, &vbo);
+    glBindBuffer(GL_ARRAY_BUFFER, vbo);
+    glBufferData(GL_ARRAY_BUFFER, DRAWS * 8 * sizeof(GLfloat), vertices, GL_STATIC_DRAW);
+    glGenBuffers(1, &cbo);
+    glBindBuffer(GL_ARRAY_BUFFER, cbo);
+    glBufferData(GL_ARRAY_BUFFER, DRAWS * 4 * sizeof(GLfloat), colors, GL_STATIC_DRAW);
+    glGenBuffers(1, &ibo);
+    free(vertices);
+    free(colors);
+
+    glGenVertexArrays(VAOS, g_vaos);
+    for (int i = 0; i < VAOS; i++) {
+        glBindVertexArray(g_vaos[i]);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ibo);
+        if (!i) { glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(indices), indices, GL_STATIC_DRAW); }
+        glBindBuffer(GL_ARRAY_BUFFER, vbo);
+        glEnableVertexAttribArray(0);
+        glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, 0);
+        glBindBuffer(GL_ARRAY_BUFFER, cbo);
+        glEnableVertexAttribArray(1);
+        glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, 0, 0);
+        glVertexAttribDivisor(1, 1);
+    }
+
+    GLuint fbo, rbo;
+    glGenRenderbuffers(1, &rbo);
+    glBindRenderbuffer(GL_RENDERBUFFER, rbo);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, GRID * 4, GRID * 4);
+    glGenFramebuffers(1, &fbo);
+    glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, rbo);
+    glViewport(0, 0, GRID * 4, GRID * 4);
+
+    for (int i = 0; i < DRAWS; i++) {
+        t_gloadDrawCommand *command = &g_commands[i];
+        command->program = g_programs[(i * 7) % PROGRAMS];
+        command->vao = g_vaos[(i * 3) % VAOS];
+        command->texture_target = GL_TEXTURE_2D;
+        command->mode = GL_TRIANGLES;
+        command->count = 6;
+        command->type = GL_UNSIGNED_SHORT;
+        command->base_vertex = i * 4;
+        command->base_instance = (GLuint) i;
+        command->key = gloadDrawQueueKey(command->program, command->vao, command->textures, 0.0f);
+    }
+
+
+    GLubyte *batched = (GLubyte *) malloc(GRID * GRID * 64);
+    GLubyte *individual = (GLubyte *) malloc(GRID * GRID * 64);
+    if (!batched || !individual) { return (1); }
+
+    PFNGLMULTIDRAWELEMENTSINDIRECTPROC multidraw = glMultiDrawElementsIndirect;
+    bench("multi-draw", batched);
+    glMultiDrawElementsIndirect = 0;
+    bench("individual", individual);
+    glMultiDrawElementsIndirect = multidraw;
+
+    printf("images are %s\n", memcmp(batched, individual, GRID * GRID * 64) ? "different" : "identical");
+    free(batched);
+    free(individual);
+
+
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    glDeleteFramebuffers(1, &fbo);
+    glDeleteRenderbuffers(1, &rbo);
+    glDeleteVertexArrays(VAOS, g_vaos);
+    glDeleteBuffers(1, &ibo);
+    glDeleteBuffers(1, &cbo);
+    glDeleteBuffers(1, &vbo);
+    for (int i = 0; i < PROGRAMS; i++) { glDeleteProgram(g_programs[i]); }
+
+    glfwDestroyWindow(window);
+    glfwTerminate();
+
+    return (0);
+}
@@ -0,0 +1,151 @@
+#define GLOAD_OBJECT_CACHE
+#define GLOAD_IMPLEMENTATION
+#include "./../../gload.h"
+
+#include <GLFW/glfw3.h>
+#include <stdio.h>
+#include <string.h>
+
+/* Object cache benchmark:
+ *  - `create` builds a framebuffer (attach, check completeness) or a sampler (set every parameter)
+ *    for each use and deletes it afterwards,
+ *  - `cache` looks the same objects up with `gloadFramebufferCacheGet` and `gloadSamplerCacheGet`.
+ * Every iteration uses one of 8 color + depth attachment sets and one of 8 sampler descriptions.
+ * */
+
+#define TARGETS     8
+#define ITERATIONS  20000
+#define FRAME       64
+
+
+
+static GLuint framebuffer_create(const t_gloadFramebufferDesc *desc) {
+    GLuint fbo;
+
+    glGenFramebuffers(1, &fbo);
+    glBindFramebuffer(GL_DRAW_FRAMEBUFFER, fbo);
+    glFramebufferTexture(GL_DRAW_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, desc->colors[0], 0);
+    glFramebufferTexture(GL_DRAW_FRAMEBUFFER, desc->depth_attachment, desc->depth, 0);
+    if (glCheckFramebufferStatus(GL_DRAW_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+        glDeleteFramebuffers(1, &fbo);
+        fbo = 0;
+    }
+    glBindFramebuffer(GL_DRAW_FRAMEBUFFER, 0);
+    return (fbo);
+}
+
+static GLuint sampler_create(const t_gloadSamplerDesc *desc) {
+    GLuint sampler;
+
+    glGenSamplers(1, &sampler);
+    glSamplerParameteri(sampler, GL_TEXTURE_MIN_FILTER, (GLint) desc->min_filter);
+    glSamplerParameteri(sampler, GL_TEXTURE_MAG_FILTER, (GLint) desc->mag_filter);
+    glSamplerParameteri(sampler, GL_TEXTURE_WRAP_S, (GLint) desc->wrap_s);
+    glSamplerParameteri(sampler, GL_TEXTURE_WRAP_T, (GLint) desc->wrap_t);
+    glSamplerParameteri(sampler, GL_TEXTURE_WRAP_R, (GLint) desc->wrap_r);
+    glSamplerParameterf(sampler, GL_TEXTURE_MIN_LOD, desc->min_lod);
+    glSamplerParameterf(sampler, GL_TEXTURE_MAX_LOD, desc->max_lod);
+    glSamplerParameterf(sampler, GL_TEXTURE_LOD_BIAS, desc->lod_bias);
+    glSamplerParameteri(sampler, GL_TEXTURE_COMPARE_MODE, (GLint) desc->compare_mode);
+    glSamplerParameteri(sampler, GL_TEXTURE_COMPARE_FUNC, (GLint) desc->compare_func);
+    glSamplerParameterfv(sampler, GL_TEXTURE_BORDER_COLOR, desc->border_color);
+    return (sampler);
+}
+
+
+
+int main(void) {
+    if (!glfwInit()) { return (1); }
+
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+
+    GLFWwindow *window = glfwCreateWindow(640, 480, "gload.h - object cache benchmark", 0, 0);
+    if (!window) { return (1); }
+
+    glfwMakeContextCurrent(window);
+
+    if (!gloadLoadGLLoader((t_gloadLoader) glfwGetProcAddress)) { return (1); }
+    if (!gloadObjectCacheInit()) { return (1); }
+
+
+    GLuint colors[TARGETS], depths[TARGETS];
+    glGenTextures(TARGETS, colors);
+    glGenTextures(TARGETS, depths);
+    t_gloadFramebufferDesc framebuffers[TARGETS];
+    t_gloadSamplerDesc samplers[TARGETS];
+    for (int i = 0; i < TARGETS; i++) {
+        glBindTexture(GL_TEXTURE_2D, colors[i]);
+        glTexStorage2D(GL_TEXTURE_2D, 1, GL_RGBA8, 256, 256);
+        glBindTexture(GL_TEXTURE_2D, depths[i]);
+        glTexStorage2D(GL_TEXTURE_2D, 1, GL_DEPTH24_STENCIL8, 256, 256);
+
+        memset(&framebuffers[i], 0, sizeof(t_gloadFramebufferDesc));
+        framebuffers[i].colors[0] = colors[i];
+        framebuffers[i].color_layers[0] = -1;
+        framebuffers[i].depth = depths[i];
+        framebuffers[i].depth_layer = -1;
+        framebuffers[i].depth_attachment = GL_DEPTH_STENCIL_ATTACHMENT;
+
+        gloadSamplerDefaults(&samplers[i]);
+        samplers[i].min_filter = (i & 1) ? GL_LINEAR_MIPMAP_LINEAR : GL_NEAREST;
+        samplers[i].wrap_s = samplers[i].wrap_t = (i & 2) ? GL_CLAMP_TO_EDGE : GL_REPEAT;
+        samplers[i].lod_bias = (GLfloat) (i >> 2);
+    }
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+
+    glFinish();
+    double start = glfwGetTime();
+    for (int i = 0; i < ITERATIONS; i++) {
+        GLuint fbo = framebuffer_create(&framebuffers[i % TARGETS]);
+        glDeleteFramebuffers(1, &fbo);
+    }
+    glFinish();
+    double fbo_create = glfwGetTime() - start;
+
+    start = glfwGetTime();
+    for (int i = 0; i < ITERATIONS; i++) {
+        GLuint sampler = sampler_create(&samplers[i % TARGETS]);
+        glDeleteSamplers(1, &sampler);
+    }
+    glFinish();
+    double sampler_create_time = glfwGetTime() - start;
+
+    int failures = 0;
+    start = glfwGetTime();
+    for (int i = 0; i < ITERATIONS; i++) {
+        if (i % FRAME == 0) { gloadObjectCacheNextFrame(); }
+        failures += !gloadFramebufferCacheGet(&framebuffers[i % TARGETS]);
+    }
+    glFinish();
+    double fbo_cache = glfwGetTime() - start;
+
+    start = glfwGetTime();
+    for (int i = 0; i < ITERATIONS; i++) {
+        if (i % FRAME == 0) { gloadObjectCacheNextFrame(); }
+        failures += !gloadSamplerCacheGet(&samplers[i % TARGETS]);
+    }
+    glFinish();
+    double sampler_cache = glfwGetTime() - start;
+
+    t_gloadObjectCacheStats stats;
+    gloadObjectCacheGetStats(&stats);
+    printf("framebuffer: create %.2f us, cache %.2f us per use\n", fbo_create * 1e6 / ITERATIONS, fbo_cache * 1e6 / ITERATIONS);
+    printf("sampler    : create %.2f us, cache %.2f us per use\n", sampler_create_time * 1e6 / ITERATIONS, sampler_cache * 1e6 / ITERATIONS);
+    printf("%llu + %llu misses, %llu + %llu hits, %d failed lookups\n",
+           (unsigned long long) stats.framebuffer_misses, (unsigned long long) stats.sampler_misses,
+           (unsigned long long) stats.framebuffer_hits, (unsigned long long) stats.sampler_hits, failures);
+
+
+    gloadObjectCacheTerminate();
+    glDeleteTextures(TARGETS, colors);
+    glDeleteTextures(TARGETS, depths);
+
+    glfwDestroyWindow(window);
+    glfwTerminate();
+
+    return (0);
+}
@@ -0,0 +1,172 @@
+#define GLOAD_DRAW_QUEUE
+#define GLOAD_IMPLEMENTATION
+#include "./../../gload.h"
+
+#include <GLFW/glfw3.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/* Draw queue benchmark:
+ *  - `reset state` binds the program, vertex array and every texture unit before each draw, in recorded order,
+ *  - `draw queue` records the same draws into a `t_gloadDrawQueue`, which sorts them and skips redundant binds.
+ * The scene is made of 20000 draws over 16 programs, 64 vertex arrays and 32 textures, drawn with rasterizer discard.
+ * */
+
+#define PROGRAMS    16
+#define VAOS        64
+#define TEXTURES    32
+#define DRAWS       20000
+#define ROUNDS      3
+
+
+
+static const GLchar *g_vertex_glsl =
+"#version 330 core\n"
+"\n"
+"layout (location=0)\n"
+"in vec3 a_pos;\n"
+"\n"
+"void main() {\n"
+"   gl_Position = vec4(a_pos, 1.0);\n"
+"}\n";
+
+static unsigned g_random = 1;
+
+static unsigned random_next(void) {
+    g_random = g_random * 1103515245u + 12345u;
+    return (g_random >> 8);
+}
+
+static GLuint program_create(int index) {
+    GLchar fragment[128];
+    const GLchar *fragment_glsl = fragment;
+
+    snprintf(fragment, sizeof(fragment), "#version 330 core\nout vec4 o_color;\nvoid main() { o_color = vec4(%d.0); }\n", index);
+
+    GLuint sh_v = glCreateShader(GL_VERTEX_SHADER);
+    glShaderSource(sh_v, 1, &g_vertex_glsl, 0);
+    glCompileShader(sh_v);
+    GLuint sh_f = glCreateShader(GL_FRAGMENT_SHADER);
+    glShaderSource(sh_f, 1, &fragment_glsl, 0);
+    glCompileShader(sh_f);
+
+    GLuint program = glCreateProgram();
+    glAttachShader(program, sh_v);
+    glAttachShader(program, sh_f);
+    glLinkProgram(program);
+    glDeleteShader(sh_v);
+    glDeleteShader(sh_f);
+    return (program);
+}
+
+
+
+int main(void) {
+    if (!glfwInit()) { return (1); }
+
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+
+    GLFWwindow *window = glfwCreateWindow(640, 480, "gload.h - draw queue benchmark", 0, 0);
+    if (!window) { return (1); }
+
+    glfwMakeContextCurrent(window);
+
+    if (!gloadLoadGLLoader((t_gloadLoader) glfwGetProcAddress)) { return (1); }
+
+
+    GLuint programs[PROGRAMS];
+    for (int i = 0; i < PROGRAMS; i++) { programs[i] = program_create(i); }
+
+    const GLfloat vertices[9] = { 0.0f };
+    const GLushort indices[3] = { 0, 1, 2 };
+    GLuint vbo, ibo;
+    glGenBuffers(1, &vbo);
+    glBindBuffer(GL_ARRAY_BUFFER, vbo);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
+    glGenBuffers(1, &ibo);
+
+    GLuint vaos[VAOS];
+    glGenVertexArrays(VAOS, vaos);
+    for (int i = 0; i < VAOS; i++) {
+        glBindVertexArray(vaos[i]);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ibo);
+        if (!i) { glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(indices), indices, GL_STATIC_DRAW); }
+        glEnableVertexAttribArray(0);
+        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 0, 0);
+    }
+
+    GLuint textures[TEXTURES];
+    glGenTextures(TEXTURES, textures);
+    for (int i = 0; i < TEXTURES; i++) {
+        glBindTexture(GL_TEXTURE_2D, textures[i]);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, 4, 4, 0, GL_RGBA, GL_UNSIGNED_BYTE, 0);
+    }
+    glEnable(GL_RASTERIZER_DISCARD);
+
+    t_gloadDrawCommand *commands = (t_gloadDrawCommand *) calloc(DRAWS, sizeof(t_gloadDrawCommand));
+    if (!commands) { return (1); }
+    for (int i = 0; i < DRAWS; i++) {
+        t_gloadDrawCommand *command = &commands[i];
+        command->program = programs[random_next() % PROGRAMS];
+        command->vao = vaos[random_next() % VAOS];
+        command->texture_target = GL_TEXTURE_2D;
+        command->textures[0] = textures[random_next() % TEXTURES];
+        command->textures[1] = textures[random_next() % 4];
+        command->mode = GL_TRIANGLES;
+        command->count = 3;
+        command->type = GL_UNSIGNED_SHORT;
+        command->key = gloadDrawQueueKey(command->program, command->vao, command->textures, (GLfloat) (random_next() % 1000) / 1000.0f);
+    }
+
+
+    for (int round = 0; round < ROUNDS; round++) {
+        glFinish();
+        double start = glfwGetTime();
+        unsigned long binds = 0;
+        for (int i = 0; i < DRAWS; i++) {
+            const t_gloadDrawCommand *command = &commands[i];
+            glUseProgram(command->program);
+            glBindVertexArray(command->vao);
+            for (int unit = 0; unit < GLOAD_DRAW_QUEUE_MAX_TEXTURES; unit++) {
+                glActiveTexture(GL_TEXTURE0 + unit);
+                glBindTexture(GL_TEXTURE_2D, command->textures[unit]);
+            }
+            binds += 2 + GLOAD_DRAW_QUEUE_MAX_TEXTURES;
+            glDrawElements(GL_TRIANGLES, 3, GL_UNSIGNED_SHORT, 0);
+        }
+        glActiveTexture(GL_TEXTURE0);
+        glFinish();
+        printf("reset state: %lu binds, %.2f ms\n", binds, (glfwGetTime() - start) * 1000.0);
+    }
+
+    t_gloadDrawQueue queue;
+    if (!gloadDrawQueueCreate(&queue, DRAWS)) { return (1); }
+    for (int round = 0; round < ROUNDS; round++) {
+        glFinish();
+        double start = glfwGetTime();
+        for (int i = 0; i < DRAWS; i++) { gloadDrawQueuePush(&queue, &commands[i]); }
+        gloadDrawQueueSubmit(&queue);
+        glFinish();
+        printf("draw queue : %llu program + %llu vao + %llu texture binds, %llu multi-draws, %.2f ms (sort %.2f ms)\n",
+               (unsigned long long) queue.program_binds, (unsigned long long) queue.vao_binds, (unsigned long long) queue.texture_binds,
+               (unsigned long long) queue.multidraws, (glfwGetTime() - start) * 1000.0, (double) queue.sort_ns / 1e6);
+        queue.program_binds = queue.vao_binds = queue.texture_binds = queue.multidraws = queue.sort_ns = 0;
+    }
+    gloadDrawQueueDestroy(&queue);
+
+
+    free(commands);
+    glDeleteTextures(TEXTURES, textures);
+    glDeleteVertexArrays(VAOS, vaos);
+    glDeleteBuffers(1, &ibo);
+    glDeleteBuffers(1, &vbo);
+    for (int i = 0; i < PROGRAMS; i++) { glDeleteProgram(programs[i]); }
+
+    glfwDestroyWindow(window);
+    glfwTerminate();
+
+    return (0);
+}
@@ -0,0 +1,135 @@
+#define GLOAD_READBACK
+#define GLOAD_IMPLEMENTATION
+#include "./../../gload.h"
+
+#include <GLFW/glfw3.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/* Readback benchmark:
+ *  - `glReadPixels` reads every frame synchronously into client memory,
+ *  - `ring x2` and `ring x3` queue the reads in a `t_gloadReadback` of 2 and 3 buffers and
+ *    map each result `count - 1` frames later.
+ * Every frame clears a 1080p or 4K framebuffer and reads it back as RGBA8.
+ * The time spent in the read and map calls is reported per frame.
+ * */
+
+#define FRAMES      60
+
+
+
+static GLuint64 checksum(const GLubyte *data, GLsizeiptr size) {
+    GLuint64 sum = 0;
+
+    for (GLsizeiptr i = 0; i < size; i += 4096) {
+        sum += data[i];
+    }
+    return (sum);
+}
+
+static void bench(GLsizei width, GLsizei height, GLuint count) {
+    GLsizeiptr size = (GLsizeiptr) width * height * 4;
+    t_gloadReadback readback;
+    GLubyte *memory = 0;
+    GLuint64 sum = 0;
+    double stall = 0.0;
+
+    if (count) {
+        if (!gloadReadbackCreate(&readback, size, count)) { return; }
+    }
+    else {
+        memory = (GLubyte *) malloc((size_t) size);
+        if (!memory) { return; }
+    }
+
+    double start = glfwGetTime();
+
+    for (int i = 0; i < FRAMES; i++) {
+        glClearColor((GLfloat) (i % 8) / 8.0f, 0.5f, 0.25f, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT);
+
+        double call = glfwGetTime();
+        if (!count) {
+            glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, memory);
+            sum += checksum(memory, size);
+        }
+        else {
+            if (readback.pending == count) {
+                const GLubyte *data = (const GLubyte *) gloadReadbackMap(&readback, 1, 0);
+                if (data) {
+                    sum += checksum(data, size);
+                    gloadReadbackUnmap(&readback);
+                }
+            }
+            gloadReadbackRead(&readback, 0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE);
+        }
+        stall += glfwGetTime() - call;
+    }
+    if (count) {
+        while (readback.pending) {
+            const GLubyte *data = (const GLubyte *) gloadReadbackMap(&readback, 1, 0);
+            if (!data) { continue; }
+
+            sum += checksum(data, size);
+            gloadReadbackUnmap(&readback);
+        }
+    }
+
+    double elapsed = glfwGetTime() - start;
+    if (count) {
+        printf("%4dx%-4d ring x%u     : %.2f ms/frame, %.2f ms/frame in readback calls, %llu waits, %llu failures (checksum %llu)\n",
+               width, height, count, elapsed * 1000.0 / FRAMES, stall * 1000.0 / FRAMES,
+               (unsigned long long) readback.waits, (unsigned long long) readback.failures, (unsigned long long) sum);
+        gloadReadbackDestroy(&readback);
+    }
+    else {
+        printf("%4dx%-4d glReadPixels : %.2f ms/frame, %.2f ms/frame in readback calls (checksum %llu)\n",
+               width, height, elapsed * 1000.0 / FRAMES, stall * 1000.0 / FRAMES, (unsigned long long) sum);
+        free(memory);
+    }
+}
+
+
+
+int main(void) {
+    if (!glfwInit()) { return (1); }
+
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+
+    GLFWwindow *window = glfwCreateWindow(640, 480, "gload.h - readback benchmark", 0, 0);
+    if (!window) { return (1); }
+
+    glfwMakeContextCurrent(window);
+
+    if (!gloadLoadGLLoader((t_gloadLoader) glfwGetProcAddress)) { return (1); }
+
+
+    const GLsizei sizes[2][2] = { { 1920, 1080 }, { 3840, 2160 } };
+    for (int i = 0; i < 2; i++) {
+        GLuint rbo, fbo;
+        glGenRenderbuffers(1, &rbo);
+        glBindRenderbuffer(GL_RENDERBUFFER, rbo);
+        glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, sizes[i][0], sizes[i][1]);
+        glGenFramebuffers(1, &fbo);
+        glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+        glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, rbo);
+        glReadBuffer(GL_COLOR_ATTACHMENT0);
+
+        bench(sizes[i][0], sizes[i][1], 0);
+        bench(sizes[i][0], sizes[i][1], 2);
+        bench(sizes[i][0], sizes[i][1], 3);
+
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+        glDeleteFramebuffers(1, &fbo);
+        glDeleteRenderbuffers(1, &rbo);
+    }
+
+
+    glfwDestroyWindow(window);
+    glfwTerminate();
+
+    return (0);
+}
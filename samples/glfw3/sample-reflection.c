@@ -0,0 +1,118 @@
+#define GLOAD_PROGRAM_REFLECTION
+#define GLOAD_IMPLEMENTATION
+#include "./../../gload.h"
+
+#include <GLFW/glfw3.h>
+#include <stdio.h>
+
+/* Program reflection benchmark:
+ *  - `glGetUniformLocation` looks the uniforms up by name through the driver,
+ *  - `reflection` looks the same uniforms up in a `t_gloadProgramReflection` by precomputed handles.
+ * Both run 200000 lookups over 5 names; the locations are compared with the driver's beforehand.
+ * */
+
+#define LOOKUPS     200000
+#define NAMES       5
+
+
+
+static const GLchar *g_vertex_glsl =
+"#version 330 core\n"
+"\n"
+"layout (location=0)\n"
+"in vec3 a_pos;\n"
+"layout (location=1)\n"
+"in vec2 a_uv;\n"
+"\n"
+"uniform mat4 u_mvp;\n"
+"uniform vec4 u_lights[8];\n"
+"\n"
+"out vec2 v_uv;\n"
+"\n"
+"void main() {\n"
+"   v_uv = a_uv + u_lights[3].xy;\n"
+"   gl_Position = u_mvp * vec4(a_pos, 1.0);\n"
+"}\n";
+
+static const GLchar *g_fragment_glsl =
+"#version 330 core\n"
+"\n"
+"in vec2 v_uv;\n"
+"\n"
+"uniform sampler2D u_texture;\n"
+"uniform float u_gain;\n"
+"\n"
+"out vec4 o_color;\n"
+"\n"
+"void main() {\n"
+"   o_color = texture(u_texture, v_uv) * u_gain;\n"
+"}\n";
+
+
+
+int main(void) {
+    if (!glfwInit()) { return (1); }
+
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+
+    GLFWwindow *window = glfwCreateWindow(640, 480, "gload.h - program reflection benchmark", 0, 0);
+    if (!window) { return (1); }
+
+    glfwMakeContextCurrent(window);
+
+    if (!gloadLoadGLLoader((t_gloadLoader) glfwGetProcAddress)) { return (1); }
+
+
+    GLuint sh_v = glCreateShader(GL_VERTEX_SHADER);
+    glShaderSource(sh_v, 1, &g_vertex_glsl, 0);
+    glCompileShader(sh_v);
+    GLuint sh_f = glCreateShader(GL_FRAGMENT_SHADER);
+    glShaderSource(sh_f, 1, &g_fragment_glsl, 0);
+    glCompileShader(sh_f);
+
+    GLuint shader = glCreateProgram();
+    glAttachShader(shader, sh_v);
+    glAttachShader(shader, sh_f);
+    glLinkProgram(shader);
+    glDeleteShader(sh_v), sh_v = 0;
+    glDeleteShader(sh_f), sh_f = 0;
+    glUseProgram(shader);
+
+    t_gloadProgramReflection reflection;
+    if (!gloadProgramReflectionCreate(&reflection, shader)) { return (1); }
+
+
+    const char *names[NAMES] = { "u_mvp", "u_lights", "u_lights[0]", "u_gain", "u_texture" };
+    GLuint64 handles[NAMES];
+    int mismatches = 0;
+    for (int i = 0; i < NAMES; i++) {
+        handles[i] = gloadProgramReflectionHash(names[i]);
+        mismatches += gloadProgramReflectionLocation(&reflection, handles[i]) != glGetUniformLocation(shader, names[i]);
+    }
+
+    volatile GLint sink = 0;
+    double start = glfwGetTime();
+    for (int i = 0; i < LOOKUPS; i++) { sink += glGetUniformLocation(shader, names[i % NAMES]); }
+    double driver = glfwGetTime() - start;
+
+    start = glfwGetTime();
+    for (int i = 0; i < LOOKUPS; i++) { sink += gloadProgramReflectionLocation(&reflection, handles[i % NAMES]); }
+    double reflected = glfwGetTime() - start;
+    (void) sink;
+
+    printf("%u resources, %d locations differ from the driver\n", reflection.count, mismatches);
+    printf("glGetUniformLocation: %.1f ns per lookup\n", driver * 1e9 / LOOKUPS);
+    printf("reflection          : %.1f ns per lookup\n", reflected * 1e9 / LOOKUPS);
+
+
+    gloadProgramReflectionDestroy(&reflection);
+    glDeleteProgram(shader);
+
+    glfwDestroyWindow(window);
+    glfwTerminate();
+
+    return (0);
+}
@@ -0,0 +1,106 @@
+#define GLOAD_STALL_DETECTOR
+#define GLOAD_IMPLEMENTATION
+#include "./../../gload.h"
+
+#include <GLFW/glfw3.h>
+#include <stdio.h>
+
+/* Stall detector benchmark:
+ *  - `direct` runs frames with the original procedures,
+ *  - `hooked` runs them with the detector installed but outside `gloadStallDetectorBeginFrame`,
+ *  - `armed` runs them between `gloadStallDetectorBeginFrame` and `gloadStallDetectorEndFrame`.
+ * Each frame clears a 256x256 framebuffer, makes 1000 `glGetIntegerv` calls from the same call site,
+ * reads the pixels back with `glReadPixels`, and maps a buffer; the call sites recorded are printed afterwards.
+ * */
+
+#define FRAMES      100
+#define QUERIES     1000
+#define SIZE        256
+
+
+
+static GLubyte g_pixels[SIZE * SIZE * 4];
+
+static void frame_run(GLuint buffer) {
+    GLint viewport[4];
+
+    glClear(GL_COLOR_BUFFER_BIT);
+    for (int i = 0; i < QUERIES; i++) { glGetIntegerv(GL_VIEWPORT, viewport); }
+    glReadPixels(0, 0, SIZE, SIZE, GL_RGBA, GL_UNSIGNED_BYTE, g_pixels);
+    glBindBuffer(GL_ARRAY_BUFFER, buffer);
+    glMapBufferRange(GL_ARRAY_BUFFER, 0, SIZE, GL_MAP_WRITE_BIT);
+    glUnmapBuffer(GL_ARRAY_BUFFER);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+
+
+int main(void) {
+    if (!glfwInit()) { return (1); }
+
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+
+    GLFWwindow *window = glfwCreateWindow(640, 480, "gload.h - stall detector benchmark", 0, 0);
+    if (!window) { return (1); }
+
+    glfwMakeContextCurrent(window);
+
+    if (!gloadLoadGLLoader((t_gloadLoader) glfwGetProcAddress)) { return (1); }
+
+
+    GLuint color, fbo, buffer;
+    glGenRenderbuffers(1, &color);
+    glBindRenderbuffer(GL_RENDERBUFFER, color);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, SIZE, SIZE);
+    glGenFramebuffers(1, &fbo);
+    glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, color);
+    glViewport(0, 0, SIZE, SIZE);
+    glGenBuffers(1, &buffer);
+    glBindBuffer(GL_ARRAY_BUFFER, buffer);
+    glBufferData(GL_ARRAY_BUFFER, SIZE, 0, GL_DYNAMIC_DRAW);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    frame_run(buffer);
+
+
+    const char *modes[3] = { "direct", "hooked", "armed" };
+    for (int mode = 0; mode < 3; mode++) {
+        if (mode == 1 && !gloadStallDetectorInit()) { return (1); }
+
+        glFinish();
+        double start = glfwGetTime();
+        for (int frame = 0; frame < FRAMES; frame++) {
+            if (mode == 2) { gloadStallDetectorBeginFrame(); }
+            frame_run(buffer);
+            if (mode == 2) { gloadStallDetectorEndFrame(); }
+        }
+        glFinish();
+        printf("%-6s: %.3f ms per frame\n", modes[mode], (glfwGetTime() - start) * 1000.0 / FRAMES);
+    }
+
+    t_gloadStallDetectorStats stats;
+    gloadStallDetectorGetStats(&stats);
+    printf("%llu frames, %llu stalls, %.2f ms in total, %u call sites\n", (unsigned long long) stats.frames,
+           (unsigned long long) stats.stalls, (double) stats.total_ns / 1e6, stats.sites);
+
+    t_gloadStallSite sites[4];
+    GLuint count = gloadStallDetectorGetSites(sites, 4);
+    for (GLuint i = 0; i < count; i++) {
+        printf("  %-17s at %p: %llu calls, %.3f ms in total, %.3f ms at most\n", sites[i].name, sites[i].callers[0],
+               (unsigned long long) sites[i].calls, (double) sites[i].total_ns / 1e6, (double) sites[i].max_ns / 1e6);
+    }
+
+
+    gloadStallDetectorTerminate();
+    glDeleteBuffers(1, &buffer);
+    glDeleteFramebuffers(1, &fbo);
+    glDeleteRenderbuffers(1, &color);
+
+    glfwDestroyWindow(window);
+    glfwTerminate();
+
+    return (0);
+}
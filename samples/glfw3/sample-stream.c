@@ -0,0 +1,109 @@
+#define GLOAD_STREAM_BUFFER
+#define GLOAD_IMPLEMENTATION
+#include "./../../gload.h"
+
+#include <GLFW/glfw3.h>
+#include <stdio.h>
+#include <string.h>
+
+/* Stream buffer benchmark:
+ *  - `persistent` streams vertices through a `t_gloadStreamBuffer` of 3 regions,
+ *  - `orphaning` does the same with a single region, which orphans the buffer every frame.
+ * Every frame writes 16 uploads of 256 KiB into 4 MiB regions and draws each of them as points.
+ * */
+
+#define REGION      (4 << 20)
+#define UPLOAD      (256 << 10)
+#define UPLOADS     16
+#define FRAMES      200
+
+
+
+static const GLchar *g_vertex_glsl =
+"#version 330 core\n"
+"\n"
+"layout (location=0)\n"
+"in vec4 a_pos;\n"
+"\n"
+"void main() {\n"
+"   gl_Position = a_pos;\n"
+"}\n";
+
+
+
+static void bench(GLuint count) {
+    t_gloadStreamBuffer stream;
+
+    if (!gloadStreamBufferCreate(&stream, GL_ARRAY_BUFFER, REGION, count)) { return; }
+
+    double start = glfwGetTime();
+
+    glEnableVertexAttribArray(0);
+    for (int i = 0; i < FRAMES; i++) {
+        for (int j = 0; j < UPLOADS; j++) {
+            GLintptr offset;
+            void *data = gloadStreamBufferMap(&stream, UPLOAD, 256, &offset);
+            if (!data) { break; }
+
+            memset(data, j, UPLOAD);
+            gloadStreamBufferUnmap(&stream);
+            glVertexAttribPointer(0, 4, GL_FLOAT, GL_FALSE, 0, (const void *) offset);
+            glDrawArrays(GL_POINTS, 0, 16);
+        }
+        gloadStreamBufferNextFrame(&stream);
+    }
+    glFinish();
+
+    double elapsed = glfwGetTime() - start;
+    printf("%-10s: %.0f MB/s, %llu waits over %llu frames\n", stream.persistent ? "persistent" : "orphaning",
+           (double) stream.bytes / elapsed / 1e6, (unsigned long long) stream.waits, (unsigned long long) stream.frames);
+
+    gloadStreamBufferDestroy(&stream);
+}
+
+
+
+int main(void) {
+    if (!glfwInit()) { return (1); }
+
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+
+    GLFWwindow *window = glfwCreateWindow(640, 480, "gload.h - stream buffer benchmark", 0, 0);
+    if (!window) { return (1); }
+
+    glfwMakeContextCurrent(window);
+
+    if (!gloadLoadGLLoader((t_gloadLoader) glfwGetProcAddress)) { return (1); }
+
+
+    GLuint sh_v = glCreateShader(GL_VERTEX_SHADER);
+    glShaderSource(sh_v, 1, &g_vertex_glsl, 0);
+    glCompileShader(sh_v);
+
+    GLuint shader = glCreateProgram();
+    glAttachShader(shader, sh_v);
+    glLinkProgram(shader);
+    glDeleteShader(sh_v), sh_v = 0;
+
+    GLuint vao;
+    glGenVertexArrays(1, &vao);
+    glBindVertexArray(vao);
+    glUseProgram(shader);
+    glEnable(GL_RASTERIZER_DISCARD);
+
+
+    bench(3);
+    bench(1);
+
+
+    glDeleteVertexArrays(1, &vao);
+    glDeleteProgram(shader);
+
+    glfwDestroyWindow(window);
+    glfwTerminate();
+
+    return (0);
+}
@@ -0,0 +1,130 @@
+#define GLOAD_TEXTURE_UPLOADER
+#define GLOAD_IMPLEMENTATION
+#include "./../../gload.h"
+
+#include <GLFW/glfw3.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/* Texture streaming benchmark:
+ *  - `sync` uploads every frame with `glTexSubImage2D` on the rendering thread,
+ *  - `async` submits the same frames from a producer thread to a `t_gloadTextureUploader`,
+ *    and the rendering thread only calls `gloadTextureUploaderProcess`.
+ * */
+
+#define WIDTH       3840
+#define HEIGHT      2160
+#define FRAMES      64
+#define TEXTURES    4
+
+
+
+static t_gloadTextureUploader   g_uploader;
+static GLuint                   g_textures[TEXTURES];
+static GLubyte                  *g_pixels;
+
+
+
+static void *producer(void *arg) {
+    (void) arg;
+
+    for (int i = 0; i < FRAMES; i++) {
+        t_gloadTextureUpload upload = {
+            g_textures[i % TEXTURES], GL_TEXTURE_2D, 0,
+            0, 0, 0, WIDTH, HEIGHT, 0,
+            GL_RGBA, GL_UNSIGNED_BYTE
+        };
+
+        gloadTextureUploaderSubmit(&g_uploader, &upload, g_pixels, WIDTH * HEIGHT * 4, 1);
+    }
+    return (0);
+}
+
+
+
+int main(void) {
+    if (!glfwInit()) { return (1); }
+
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+
+    GLFWwindow *window = glfwCreateWindow(640, 480, "gload.h - texture uploader benchmark", 0, 0);
+    if (!window) { return (1); }
+
+    glfwMakeContextCurrent(window);
+
+    if (!gloadLoadGLLoader((t_gloadLoader) glfwGetProcAddress)) { return (1); }
+
+
+    g_pixels = (GLubyte *) malloc(WIDTH * HEIGHT * 4);
+    if (!g_pixels) { return (1); }
+    for (int i = 0; i < WIDTH * HEIGHT * 4; i++) {
+        g_pixels[i] = (GLubyte) (i * 7);
+    }
+
+    glGenTextures(TEXTURES, g_textures);
+    for (int i = 0; i < TEXTURES; i++) {
+        glBindTexture(GL_TEXTURE_2D, g_textures[i]);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, WIDTH, HEIGHT, 0, GL_RGBA, GL_UNSIGNED_BYTE, 0);
+    }
+    glFinish();
+
+
+    /* sync */
+    double start = glfwGetTime();
+    double longest = 0.0;
+
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    for (int i = 0; i < FRAMES; i++) {
+        double call = glfwGetTime();
+
+        glBindTexture(GL_TEXTURE_2D, g_textures[i % TEXTURES]);
+        glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, WIDTH, HEIGHT, GL_RGBA, GL_UNSIGNED_BYTE, g_pixels);
+        call = glfwGetTime() - call;
+        if (call > longest) { longest = call; }
+    }
+    glFinish();
+
+    double elapsed = glfwGetTime() - start;
+    printf("sync:  %.0f MB/s, longest glTexSubImage2D %.2f ms\n",
+           FRAMES * (double) WIDTH * HEIGHT * 4 / elapsed / 1e6, longest * 1e3);
+
+
+    /* async */
+    if (!gloadTextureUploaderCreate(&g_uploader, (GLsizeiptr) WIDTH * HEIGHT * 4 * TEXTURES)) { return (1); }
+
+    pthread_t thread;
+    int calls = 0;
+
+    start = glfwGetTime();
+    longest = 0.0;
+    if (pthread_create(&thread, 0, producer, 0)) { return (1); }
+    /* tickets are sequence numbers, so the last frame is ticket `FRAMES`... */
+    while (!gloadTextureUploaderIsComplete(&g_uploader, FRAMES)) {
+        double call = glfwGetTime();
+
+        gloadTextureUploaderProcess(&g_uploader);
+        call = glfwGetTime() - call;
+        if (call > longest) { longest = call; }
+        calls++;
+    }
+    pthread_join(thread, 0);
+
+    elapsed = glfwGetTime() - start;
+    printf("async: %.0f MB/s, longest gloadTextureUploaderProcess %.2f ms over %d calls, %llu stalls (persistent: %d)\n",
+           FRAMES * (double) WIDTH * HEIGHT * 4 / elapsed / 1e6, longest * 1e3, calls,
+           (unsigned long long) g_uploader.stalls, g_uploader.persistent);
+
+
+    gloadTextureUploaderDestroy(&g_uploader);
+    glDeleteTextures(TEXTURES, g_textures);
+    free(g_pixels);
+
+    glfwDestroyWindow(window);
+    glfwTerminate();
+
+    return (0);
+}